@@ -1,9 +1,171 @@
 #pragma once
 #include "RmlUi/Core/RenderInterface.h"
 
+#include "lve_device.hpp"
+#include "lve_texture.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace lve {
+    // RmlUi render interface that records into FirstApp's command buffers using the shared LveDevice
+    // and swap chain render pass. Geometry is copied into a persistently mapped ring buffer per frame in
+    // flight (with the translation baked in), so consecutive draws that share texture, scissor and
+    // transform collapse into a single vkCmdDrawIndexed.
     class RmlVk : public  Rml::RenderInterface {
+    public:
+        static void init(LveDevice &device, VkRenderPass renderPass);
+        static RmlVk& get();
+
+        RmlVk(LveDevice &device, VkRenderPass renderPass);
+
+        ~RmlVk() override = default;
+        void cleanup();
+
+        RmlVk(const RmlVk &) = delete;
+
+        RmlVk &operator=(const RmlVk &) = delete;
+
+        // The render pass is recreated together with the swap chain
+        void recreatePipeline(VkRenderPass renderPass);
+
+        // Call inside an active render pass; frameIndex selects the ring buffer of the frame in flight
+        void beginFrame(VkCommandBuffer commandBuffer, size_t frameIndex, VkExtent2D extent);
+
+        void endFrame();
+
+        uint32_t getDrawCallCount() const { return drawCallCount; }
+
+        Rml::CompiledGeometryHandle CompileGeometry(Rml::Span<const Rml::Vertex> vertices,
+                                                    Rml::Span<const int> indices) override;
+
+        void RenderGeometry(Rml::CompiledGeometryHandle geometry, Rml::Vector2f translation,
+                            Rml::TextureHandle texture) override;
+
+        void ReleaseGeometry(Rml::CompiledGeometryHandle geometry) override;
+
+        Rml::TextureHandle LoadTexture(Rml::Vector2i &textureDimensions, const Rml::String &source) override;
+
+        Rml::TextureHandle GenerateTexture(Rml::Span<const Rml::byte> source, Rml::Vector2i sourceDimensions) override;
+
+        void ReleaseTexture(Rml::TextureHandle texture) override;
+
+        void EnableScissorRegion(bool enable) override;
+
+        void SetScissorRegion(Rml::Rectanglei region) override;
+
+        void SetTransform(const Rml::Matrix4f *transform) override;
+
+        bool UpdateTexture(Rml::TextureHandle texture, Rml::Span<const Rml::byte> source,
+                           Rml::Rectanglei region) override;
+
+    private:
+        // Matches the uniform block of the RmlUi vertex shader (std140)
+        struct UniformBlock {
+            Rml::Matrix4f transform;
+            Rml::Vector2f translate;
+        };
+
+        struct Geometry {
+            Rml::Span<const Rml::Vertex> vertices;
+            Rml::Span<const int> indices;
+        };
+
+        struct UiTexture {
+            std::unique_ptr<Texture> texture;
+            VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+            VkDescriptorPool descriptorPool = VK_NULL_HANDLE;
+        };
+
+        struct RingBuffer {
+            VkBuffer buffer = VK_NULL_HANDLE;
+            VmaAllocation allocation = VK_NULL_HANDLE;
+            char *mapped = nullptr;
+            VkDeviceSize capacity = 0;
+            VkDeviceSize used = 0;
+        };
+
+        struct FrameData {
+            RingBuffer vertices;
+            RingBuffer indices;
+            RingBuffer uniforms;
+            VkDescriptorSet uniformSet = VK_NULL_HANDLE;
+            VkDescriptorPool uniformPool = VK_NULL_HANDLE;
+
+            // Released while this frame may still be executing, destroyed once its fence was waited on
+            std::vector<RingBuffer> retiredBuffers;
+            std::vector<std::pair<VkDescriptorPool, VkDescriptorSet>> retiredSets;
+            std::vector<std::unique_ptr<UiTexture>> retiredTextures;
+        };
+
+        struct Batch {
+            VkDescriptorSet textureSet = VK_NULL_HANDLE;
+            VkRect2D scissor{};
+            uint32_t uniformOffset = 0;
+            uint32_t firstIndex = 0;
+            uint32_t indexCount = 0;
+        };
+
+        void createDescriptorSetLayouts();
+
+        void createPipelineLayout();
+
+        void createPipeline(VkRenderPass renderPass);
+
+        VkShaderModule createShaderModule(const unsigned char *code, size_t size);
+
+        VkDescriptorSet allocateDescriptorSet(VkDescriptorSetLayout layout, VkDescriptorPool &pool);
+
+        void createRingBuffer(RingBuffer &ring, VkDeviceSize capacity, VkBufferUsageFlags usage);
+
+        void destroyRingBuffer(RingBuffer &ring);
+
+        void reserve(RingBuffer &ring, VkDeviceSize bytes, VkBufferUsageFlags usage);
+
+        void writeUniformSet(FrameData &frame);
+
+        void releaseRetired(FrameData &frame);
+
+        void destroyTexture(UiTexture &texture);
+
+        Rml::TextureHandle createTexture(const unsigned char *pixels, uint32_t width, uint32_t height);
+
+        void flush();
+
+        static std::unique_ptr<RmlVk> instance;  // declaration only
+        LveDevice &lveDevice;
+
+        VkDescriptorSetLayout uniformSetLayout = VK_NULL_HANDLE;
+        VkDescriptorSetLayout textureSetLayout = VK_NULL_HANDLE;
+        VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        std::vector<VkDescriptorPool> descriptorPools;
+
+        std::vector<FrameData> frames;
+        std::unordered_map<Rml::TextureHandle, std::unique_ptr<UiTexture>> textures;
+        Rml::TextureHandle whiteTexture = 0;
+        VkDeviceSize uniformStride = 0;
 
+        // Per-frame recording state
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        FrameData *frame = nullptr;
+        size_t frameIndex = 0;
+        VkExtent2D extent{};
+        Rml::Matrix4f projection = Rml::Matrix4f::Identity();
+        Rml::Matrix4f transform = Rml::Matrix4f::Identity();
+        bool transformDirty = true;
+        bool scissorEnabled = false;
+        VkRect2D scissor{};
+        uint32_t uniformOffset = 0;
+        Batch batch;
+        VkBuffer boundVertexBuffer = VK_NULL_HANDLE;
+        VkBuffer boundIndexBuffer = VK_NULL_HANDLE;
+        VkDescriptorSet boundUniformSet = VK_NULL_HANDLE;
+        VkDescriptorSet boundTextureSet = VK_NULL_HANDLE;
+        uint32_t boundUniformOffset = UINT32_MAX;
+        VkRect2D boundScissor{};
+        bool scissorBound = false;
+        uint32_t drawCallCount = 0;
     };
 }
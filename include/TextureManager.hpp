@@ -4,13 +4,21 @@
 
 #include "lve_texture.hpp"
 #include "lve_device.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <vector>
 #include <bits/ostream.tcc>
 
 namespace lve {
 
+    // Returned by loadTextureAsync; resolves to a placeholder until the upload has completed
+    using TextureId = uint32_t;
+
     class TextureManager {
     public:
         // Initialize singleton (call once at startup)
@@ -27,18 +35,97 @@ namespace lve {
             return *instance_;
         }
 
-        TextureManager(LveDevice& device) : lveDevice(device) {}
-        ~TextureManager()  = default;
+        TextureManager(LveDevice& device);
+        ~TextureManager();
         // Load texture by filepath (returns reference)
         Texture& loadTexture(const std::string& filepath);
 
+        // Decodes on a worker thread and uploads on the transfer queue without blocking the caller
+        TextureId loadTextureAsync(const std::string& filepath);
+
+        // The uploaded texture once resident, the placeholder until then
+        Texture& getTexture(TextureId id);
+
+        bool isResident(TextureId id) const { return asyncTextures.at(id).texture != nullptr; }
+
+        // Call once per frame before recording: retires finished uploads and submits newly decoded images
+        void update();
+
+        // Timeline semaphore signalled by upload batches, for the graphics submit to wait on
+        VkSemaphore getUploadSemaphore() const { return uploadSemaphore; }
+
+        // Highest timeline value already observed complete, so waiting on it never stalls the graphics queue
+        uint64_t getCompletedUploadValue() const { return completedUploadValue; }
+
         // Optional cleanup
         void cleanup();
     private:
+        struct AsyncTexture {
+            std::string filepath;
+            Texture* texture = nullptr;
+        };
+
+        struct DecodeJob {
+            TextureId id;
+            std::string filepath;
+        };
+
+        struct DecodedImage {
+            TextureId id;
+            unsigned char* pixels;
+            uint32_t width;
+            uint32_t height;
+        };
+
+        struct UploadBatch {
+            uint64_t timelineValue = 0;
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+            VkDeviceSize stagingBytes = 0;  // ring bytes to give back, including wrap-around padding
+            std::vector<std::pair<TextureId, std::unique_ptr<Texture>>> textures;
+            // Images larger than the whole ring get their own staging buffer
+            std::vector<std::pair<VkBuffer, VmaAllocation>> dedicatedStaging;
+        };
+
+        // Persistently mapped upload buffer, reclaimed in submission order as batches complete
+        struct StagingRing {
+            VkBuffer buffer = VK_NULL_HANDLE;
+            VmaAllocation allocation = VK_NULL_HANDLE;
+            char* mapped = nullptr;
+            VkDeviceSize capacity = 0;
+            VkDeviceSize head = 0;
+            VkDeviceSize used = 0;
+        };
+
+        void createUploadResources();
+        void workerLoop();
+        void stopWorkers();
+        bool allocateStaging(VkDeviceSize size, VkDeviceSize& offset, VkDeviceSize& consumed);
+        void retireCompletedUploads();
+        void submitDecodedImages();
 
         LveDevice& lveDevice;
         std::unordered_map<std::string, std::unique_ptr<Texture>> textures;
 
+        // Render thread only
+        std::vector<AsyncTexture> asyncTextures;
+        std::unordered_map<std::string, TextureId> asyncIds;
+        std::deque<DecodedImage> pendingUploads;
+        std::deque<UploadBatch> uploadsInFlight;
+        std::unique_ptr<Texture> placeholder;
+        StagingRing staging;
+        VkCommandPool transferCommandPool = VK_NULL_HANDLE;
+        VkSemaphore uploadSemaphore = VK_NULL_HANDLE;
+        uint64_t submittedUploadValue = 0;
+        uint64_t completedUploadValue = 0;
+
+        // Shared with the decode workers
+        std::mutex queueMutex;
+        std::condition_variable jobAvailable;
+        std::deque<DecodeJob> decodeJobs;
+        std::vector<DecodedImage> decodedImages;
+        std::vector<std::thread> workers;
+        bool stopping = false;
+
         static std::unique_ptr<TextureManager> instance_;
     };
 
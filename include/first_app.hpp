@@ -5,6 +5,9 @@
 #include "lve_swap_chain.hpp"
 #include  <iostream>
 #include  "TextureManager.hpp"
+#include "RmlVk.hpp"
+#include "RmlUi/Core.h"
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -21,7 +24,15 @@ namespace lve {
         void run();
 
     private:
+        // Everything recorded for one frame slot; the pool is reset as a whole once its fence has signalled
+        struct FrameResources {
+            VkCommandPool commandPool = VK_NULL_HANDLE;
+            VkCommandBuffer primary = VK_NULL_HANDLE;
+            VkCommandBuffer ui = VK_NULL_HANDLE;  // secondary, re-recorded every frame
+        };
+
         void loadModels();
+        void initRmlUi();
         void createDescriptorPool();
         void createDescriptorSet();
         void updateDescriptorSet();
@@ -29,14 +40,21 @@ namespace lve {
         void createPipelineLayout();
         void createPipeline();
         void recreateSwapChain();
-        void createCommandBuffers();
-        void freeCommandBuffers();
-        void recordCommandBuffer(int imageIndex);
+        void createFrameResources();
+        void destroyFrameResources();
+        void recordStaticCommands();
+        void recordCommandBuffer(FrameResources& frame, uint32_t imageIndex);
         void drawFrame();
         VkDescriptorSetLayout descriptorSetLayout{};
         VkDescriptorPool descriptorPool;
         VkDescriptorSet descriptorSet;
         VkPipelineLayout pipelineLayout;
-        std::vector<VkCommandBuffer> commandBuffers;
+        std::array<FrameResources, LveSwapChain::MAX_FRAMES_IN_FLIGHT> frames{};
+        // Background quad, recorded once per swap chain and executed by every frame
+        VkCommandBuffer staticCommands = VK_NULL_HANDLE;
+        // Shown through the placeholder until the upload completes, then the descriptor set is rewritten
+        TextureId backgroundTexture = 0;
+        bool backgroundResident = false;
+        Rml::Context* rmlContext = nullptr;
     };
 }
@@ -2,6 +2,8 @@
 
 #include "lve_window.hpp"
 
+#include "vma/vk_mem_alloc.h"
+
 // std lib headers
 #include <string>
 #include <vector>
@@ -17,12 +19,25 @@ namespace lve {
     struct QueueFamilyIndices {
         uint32_t graphicsFamily;
         uint32_t presentFamily;
+        // Dedicated transfer-only family when the GPU exposes one, otherwise the graphics family
+        uint32_t transferFamily;
         bool graphicsFamilyHasValue = false;
         bool presentFamilyHasValue = false;
+        bool transferFamilyHasValue = false;
 
         bool isComplete() { return graphicsFamilyHasValue && presentFamilyHasValue; }
     };
 
+    struct MemoryHeapStats {
+        uint32_t heapIndex;
+        VkMemoryHeapFlags flags;
+        uint32_t blockCount;          // VkDeviceMemory blocks owned by the allocator
+        uint32_t allocationCount;     // resources sub-allocated from those blocks
+        VkDeviceSize blockBytes;
+        VkDeviceSize allocationBytes;
+        VkDeviceSize budget;
+    };
+
     class LveDevice {
     public:
 #ifdef NDEBUG
@@ -58,7 +73,9 @@ namespace lve {
                 VkImageUsageFlags usage,
                 VkMemoryPropertyFlags properties,
                 VkImage &image,
-                VkDeviceMemory &imageMemory);
+                VmaAllocation &imageAllocation);
+
+        void destroyImage(VkImage image, VmaAllocation imageAllocation);
 
         VkImageView createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags);
 
@@ -68,6 +85,13 @@ namespace lve {
                 VkImageLayout oldLayout,
                 VkImageLayout newLayout);
 
+        // Records the barrier into an already open command buffer instead of submitting it
+        void transitionImageLayout(
+                VkCommandBuffer commandBuffer,
+                VkImage image,
+                VkImageLayout oldLayout,
+                VkImageLayout newLayout);
+
         VkDevice device() { return device_; }
 
         VkSurfaceKHR surface() { return surface_; }
@@ -76,6 +100,8 @@ namespace lve {
 
         VkQueue presentQueue() { return presentQueue_; }
 
+        VkQueue transferQueue() { return transferQueue_; }
+
         SwapChainSupportDetails getSwapChainSupport() { return querySwapChainSupport(physicalDevice); }
 
         uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
@@ -86,12 +112,23 @@ namespace lve {
                 const std::vector<VkFormat> &candidates, VkImageTiling tiling, VkFormatFeatureFlags features);
 
         // Buffer Helper Functions
+        // Sub-allocated from large per-memory-type blocks; pass mappedData for a persistent mapping
         void createBuffer(
                 VkDeviceSize size,
                 VkBufferUsageFlags usage,
                 VkMemoryPropertyFlags properties,
                 VkBuffer &buffer,
-                VkDeviceMemory &bufferMemory);
+                VmaAllocation &bufferAllocation,
+                void **mappedData = nullptr);
+
+        // Short-lived upload source from the linear staging pool, always mapped
+        void createStagingBuffer(
+                VkDeviceSize size,
+                VkBuffer &buffer,
+                VmaAllocation &bufferAllocation,
+                void **mappedData);
+
+        void destroyBuffer(VkBuffer buffer, VmaAllocation bufferAllocation);
 
         VkCommandBuffer beginSingleTimeCommands();
 
@@ -102,11 +139,21 @@ namespace lve {
         void copyBufferToImage(
                 VkBuffer buffer, VkImage image, uint32_t width, uint32_t height, uint32_t layerCount);
 
+        void copyBufferToImage(
+                VkCommandBuffer commandBuffer,
+                VkBuffer buffer, VkImage image, uint32_t width, uint32_t height, uint32_t layerCount);
+
         void createImageWithInfo(
                 const VkImageCreateInfo &imageInfo,
                 VkMemoryPropertyFlags properties,
                 VkImage &image,
-                VkDeviceMemory &imageMemory);
+                VmaAllocation &imageAllocation);
+
+        std::vector<MemoryHeapStats> getMemoryStatistics();
+
+        void printMemoryStatistics();
+
+        VmaAllocator allocator() { return allocator_; }
 
         VkPhysicalDeviceProperties properties;
 
@@ -123,6 +170,8 @@ namespace lve {
 
         void createCommandPool();
 
+        void createAllocator();
+
         // helper functions
         bool isDeviceSuitable(VkPhysicalDevice device);
 
@@ -150,6 +199,10 @@ namespace lve {
         VkSurfaceKHR surface_;
         VkQueue graphicsQueue_;
         VkQueue presentQueue_;
+        VkQueue transferQueue_;
+
+        VmaAllocator allocator_ = VK_NULL_HANDLE;
+        VmaPool stagingPool = VK_NULL_HANDLE;
 
         const std::vector<const char *> validationLayers = {"VK_LAYER_KHRONOS_validation"};
         const std::vector<const char *> deviceExtensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
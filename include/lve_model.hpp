@@ -43,7 +43,7 @@ namespace lve {
         static std::unique_ptr<LveModel> instance;  // declaration only
         LveDevice &lveDevice;
         VkBuffer vertexBuffer;
-        VkDeviceMemory vertexBufferMemory;
+        VmaAllocation vertexBufferAllocation;
         uint32_t vertexCount;
     };
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -14,7 +14,7 @@ namespace lve {
 
     class LveSwapChain {
     public:
-        static constexpr int MAX_FRAMES_IN_FLIGHT = 2;
+        static constexpr int MAX_FRAMES_IN_FLIGHT = 3;
 
         static void init(LveDevice &deviceRef, VkExtent2D windowExtent);
         static LveSwapChain& get();
@@ -52,7 +52,13 @@ namespace lve {
 
         VkResult acquireNextImage(uint32_t *imageIndex);
 
-        VkResult submitCommandBuffers(const VkCommandBuffer *buffers, uint32_t *imageIndex);
+        // Frame slot whose fence was waited on by the last acquireNextImage
+        size_t getCurrentFrame() const { return currentFrame; }
+
+        // uploadSemaphore/uploadValue: optional timeline semaphore the fragment stage waits on, so
+        // textures finished on the transfer queue are visible to this frame
+        VkResult submitCommandBuffers(const VkCommandBuffer *buffers, uint32_t *imageIndex,
+                                      VkSemaphore uploadSemaphore = VK_NULL_HANDLE, uint64_t uploadValue = 0);
 
     private:
         void init();
@@ -85,7 +91,7 @@ namespace lve {
         VkRenderPass renderPass;
 
         std::vector<VkImage> depthImages;
-        std::vector<VkDeviceMemory> depthImageMemorys;
+        std::vector<VmaAllocation> depthImageAllocations;
         std::vector<VkImageView> depthImageViews;
         std::vector<VkImage> swapChainImages;
         std::vector<VkImageView> swapChainImageViews;
@@ -99,7 +105,6 @@ namespace lve {
         std::vector<VkSemaphore> imageAvailableSemaphores;
         std::vector<VkSemaphore> renderFinishedSemaphores;
         std::vector<VkFence> inFlightFences;
-        std::vector<VkFence> imagesInFlight;
         size_t currentFrame = 0;
     };
 
@@ -10,16 +10,33 @@ namespace lve {
     public:
         Texture(LveDevice &device, const std::string &filepath);
 
+        // Upload raw RGBA8 pixels (e.g. generated by RmlUi) instead of decoding a file
+        Texture(LveDevice &device, const unsigned char *pixels, uint32_t width, uint32_t height,
+                VkFormat format = VK_FORMAT_R8G8B8A8_SRGB);
+
+        // Takes ownership of an image whose contents are uploaded elsewhere (see TextureManager::loadTextureAsync)
+        Texture(LveDevice &device, VkImage image, VmaAllocation allocation, VkFormat format, uint32_t width,
+                uint32_t height);
+
         ~Texture()  = default;
         void cleanup();
 
+        // Overwrite a sub-rectangle with tightly packed pixels in the texture's format, the rest is left untouched
+        void update(const unsigned char *pixels, int32_t x, int32_t y, uint32_t regionWidth, uint32_t regionHeight);
+
         VkImageView getImageView() const { return textureImageView; }
 
         VkSampler getSampler() const { return textureSampler; }
 
+        uint32_t getWidth() const { return width; }
+
+        uint32_t getHeight() const { return height; }
+
     private:
         void createTextureImage(const std::string &filepath);
 
+        void createTextureImage(const unsigned char *pixels, uint32_t texWidth, uint32_t texHeight);
+
         void createTextureImageView();
 
         void createTextureSampler();
@@ -27,9 +44,12 @@ namespace lve {
         LveDevice &lveDevice;
 
         VkImage textureImage;
-        VkDeviceMemory textureImageMemory;
+        VmaAllocation textureImageAllocation;
         VkImageView textureImageView;
         VkSampler textureSampler;
+        VkFormat imageFormat = VK_FORMAT_R8G8B8A8_SRGB;
+        uint32_t width = 0;
+        uint32_t height = 0;
     };
 
 }  // namespace lve
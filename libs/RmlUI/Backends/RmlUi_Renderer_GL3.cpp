@@ -206,6 +206,24 @@ void main() {
 }
 )";
 
+// Glyphs stored as signed distance fields, with the glyph outline at alpha 0.5.
+static const char* shader_frag_distance_field_text = RMLUI_SHADER_HEADER R"(
+uniform sampler2D _tex;
+uniform float _distanceScale;
+uniform float _dilation;
+uniform float _softness;
+
+in vec2 fragTexCoord;
+in vec4 fragColor;
+out vec4 finalColor;
+
+void main() {
+	float distance = (texture(_tex, fragTexCoord).a - 0.5) * _distanceScale + _dilation;
+	float half_width = 0.5 * max(_softness, 1.0);
+	finalColor = fragColor * smoothstep(-half_width, half_width, distance);
+}
+)";
+
 static const char* shader_vert_passthrough = RMLUI_SHADER_HEADER R"(
 in vec2 inPosition;
 in vec2 inTexCoord0;
@@ -316,6 +334,7 @@ enum class ProgramId {
 	Texture,
 	Gradient,
 	Creation,
+	DistanceFieldText,
 	Passthrough,
 	ColorMatrix,
 	BlendMask,
@@ -334,6 +353,7 @@ enum class FragShaderId {
 	Texture,
 	Gradient,
 	Creation,
+	DistanceFieldText,
 	Passthrough,
 	ColorMatrix,
 	BlendMask,
@@ -360,6 +380,9 @@ enum class UniformId {
 	NumStops,
 	Value,
 	Dimensions,
+	DistanceScale,
+	Dilation,
+	Softness,
 	Count,
 };
 
@@ -367,7 +390,7 @@ namespace Gfx {
 
 static const char* const program_uniform_names[(size_t)UniformId::Count] = {"_translate", "_transform", "_tex", "_color", "_color_matrix",
 	"_texelOffset", "_texCoordMin", "_texCoordMax", "_texMask", "_weights[0]", "_func", "_p", "_v", "_stop_colors[0]", "_stop_positions[0]",
-	"_num_stops", "_value", "_dimensions"};
+	"_num_stops", "_value", "_dimensions", "_distanceScale", "_dilation", "_softness"};
 
 enum class VertexAttribute { Position, Color0, TexCoord0, Count };
 static const char* const vertex_attribute_names[(size_t)VertexAttribute::Count] = {"inPosition", "inColor0", "inTexCoord0"};
@@ -396,26 +419,28 @@ static const VertShaderDefinition vert_shader_definitions[] = {
 	{VertShaderId::Blur,        "blur",         shader_vert_blur},
 };
 static const FragShaderDefinition frag_shader_definitions[] = {
-	{FragShaderId::Color,       "color",        shader_frag_color},
-	{FragShaderId::Texture,     "texture",      shader_frag_texture},
-	{FragShaderId::Gradient,    "gradient",     shader_frag_gradient},
-	{FragShaderId::Creation,    "creation",     shader_frag_creation},
-	{FragShaderId::Passthrough, "passthrough",  shader_frag_passthrough},
-	{FragShaderId::ColorMatrix, "color_matrix", shader_frag_color_matrix},
-	{FragShaderId::BlendMask,   "blend_mask",   shader_frag_blend_mask},
-	{FragShaderId::Blur,        "blur",         shader_frag_blur},
-	{FragShaderId::DropShadow,  "drop_shadow",  shader_frag_drop_shadow},
+	{FragShaderId::Color,             "color",               shader_frag_color},
+	{FragShaderId::Texture,           "texture",             shader_frag_texture},
+	{FragShaderId::Gradient,          "gradient",            shader_frag_gradient},
+	{FragShaderId::Creation,          "creation",            shader_frag_creation},
+	{FragShaderId::DistanceFieldText, "distance_field_text", shader_frag_distance_field_text},
+	{FragShaderId::Passthrough,       "passthrough",         shader_frag_passthrough},
+	{FragShaderId::ColorMatrix,       "color_matrix",        shader_frag_color_matrix},
+	{FragShaderId::BlendMask,         "blend_mask",          shader_frag_blend_mask},
+	{FragShaderId::Blur,              "blur",                shader_frag_blur},
+	{FragShaderId::DropShadow,        "drop_shadow",         shader_frag_drop_shadow},
 };
 static const ProgramDefinition program_definitions[] = {
-	{ProgramId::Color,       "color",        VertShaderId::Main,        FragShaderId::Color},
-	{ProgramId::Texture,     "texture",      VertShaderId::Main,        FragShaderId::Texture},
-	{ProgramId::Gradient,    "gradient",     VertShaderId::Main,        FragShaderId::Gradient},
-	{ProgramId::Creation,    "creation",     VertShaderId::Main,        FragShaderId::Creation},
-	{ProgramId::Passthrough, "passthrough",  VertShaderId::Passthrough, FragShaderId::Passthrough},
-	{ProgramId::ColorMatrix, "color_matrix", VertShaderId::Passthrough, FragShaderId::ColorMatrix},
-	{ProgramId::BlendMask,   "blend_mask",   VertShaderId::Passthrough, FragShaderId::BlendMask},
-	{ProgramId::Blur,        "blur",         VertShaderId::Blur,        FragShaderId::Blur},
-	{ProgramId::DropShadow,  "drop_shadow",  VertShaderId::Passthrough, FragShaderId::DropShadow},
+	{ProgramId::Color,             "color",               VertShaderId::Main,        FragShaderId::Color},
+	{ProgramId::Texture,           "texture",             VertShaderId::Main,        FragShaderId::Texture},
+	{ProgramId::Gradient,          "gradient",            VertShaderId::Main,        FragShaderId::Gradient},
+	{ProgramId::Creation,          "creation",            VertShaderId::Main,        FragShaderId::Creation},
+	{ProgramId::DistanceFieldText, "distance_field_text", VertShaderId::Main,        FragShaderId::DistanceFieldText},
+	{ProgramId::Passthrough,       "passthrough",         VertShaderId::Passthrough, FragShaderId::Passthrough},
+	{ProgramId::ColorMatrix,       "color_matrix",        VertShaderId::Passthrough, FragShaderId::ColorMatrix},
+	{ProgramId::BlendMask,         "blend_mask",          VertShaderId::Passthrough, FragShaderId::BlendMask},
+	{ProgramId::Blur,              "blur",                VertShaderId::Blur,        FragShaderId::Blur},
+	{ProgramId::DropShadow,        "drop_shadow",         VertShaderId::Passthrough, FragShaderId::DropShadow},
 };
 // clang-format on
 
@@ -1496,6 +1521,18 @@ void RenderInterface_GL3::SetTransform(const Rml::Matrix4f* new_transform)
 	program_transform_dirty.set();
 }
 
+bool RenderInterface_GL3::UpdateTexture(Rml::TextureHandle texture_handle, Rml::Span<const Rml::byte> source_data, Rml::Rectanglei region)
+{
+	RMLUI_ASSERT(source_data.data() && source_data.size() == size_t(region.Width() * region.Height() * 4));
+
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture_handle);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, region.Left(), region.Top(), region.Width(), region.Height(), GL_RGBA, GL_UNSIGNED_BYTE, source_data.data());
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	Gfx::CheckGLError("UpdateTexture");
+	return true;
+}
+
 enum class FilterType { Invalid = 0, Passthrough, Blur, DropShadow, ColorMatrix, MaskImage };
 struct CompiledFilter {
 	FilterType type;
@@ -1631,7 +1668,7 @@ void RenderInterface_GL3::ReleaseFilter(Rml::CompiledFilterHandle filter)
 	delete reinterpret_cast<CompiledFilter*>(filter);
 }
 
-enum class CompiledShaderType { Invalid = 0, Gradient, Creation };
+enum class CompiledShaderType { Invalid = 0, Gradient, Creation, DistanceFieldText };
 struct CompiledShader {
 	CompiledShaderType type;
 
@@ -1644,6 +1681,11 @@ struct CompiledShader {
 
 	// Shader
 	Rml::Vector2f dimensions;
+
+	// Distance field text
+	float distance_scale;
+	float dilation;
+	float softness;
 };
 
 Rml::CompiledShaderHandle RenderInterface_GL3::CompileShader(const Rml::String& name, const Rml::Dictionary& parameters)
@@ -1704,6 +1746,13 @@ Rml::CompiledShaderHandle RenderInterface_GL3::CompileShader(const Rml::String&
 			shader.dimensions = Rml::Get(parameters, "dimensions", Rml::Vector2f(0.f));
 		}
 	}
+	else if (name == "distance-field-text")
+	{
+		shader.type = CompiledShaderType::DistanceFieldText;
+		shader.distance_scale = Rml::Get(parameters, "distance_scale", 1.f);
+		shader.dilation = Rml::Get(parameters, "dilation", 0.f);
+		shader.softness = Rml::Get(parameters, "softness", 0.f);
+	}
 
 	if (shader.type != CompiledShaderType::Invalid)
 		return reinterpret_cast<Rml::CompiledShaderHandle>(new CompiledShader(std::move(shader)));
@@ -1713,7 +1762,7 @@ Rml::CompiledShaderHandle RenderInterface_GL3::CompileShader(const Rml::String&
 }
 
 void RenderInterface_GL3::RenderShader(Rml::CompiledShaderHandle shader_handle, Rml::CompiledGeometryHandle geometry_handle,
-	Rml::Vector2f translation, Rml::TextureHandle /*texture*/)
+	Rml::Vector2f translation, Rml::TextureHandle texture)
 {
 	RMLUI_ASSERT(shader_handle && geometry_handle);
 	const CompiledShader& shader = *reinterpret_cast<CompiledShader*>(shader_handle);
@@ -1755,6 +1804,21 @@ void RenderInterface_GL3::RenderShader(Rml::CompiledShaderHandle shader_handle,
 		glBindVertexArray(0);
 	}
 	break;
+	case CompiledShaderType::DistanceFieldText:
+	{
+		UseProgram(ProgramId::DistanceFieldText);
+		glUniform1f(GetUniformLocation(UniformId::DistanceScale), shader.distance_scale);
+		glUniform1f(GetUniformLocation(UniformId::Dilation), shader.dilation);
+		glUniform1f(GetUniformLocation(UniformId::Softness), shader.softness);
+		glBindTexture(GL_TEXTURE_2D, (GLuint)texture);
+
+		SubmitTransformUniform(translation);
+		glBindVertexArray(geometry.vao);
+		glDrawElements(GL_TRIANGLES, geometry.draw_count, GL_UNSIGNED_INT, (const GLvoid*)0);
+		glBindVertexArray(0);
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
+	break;
 	case CompiledShaderType::Invalid:
 	{
 		Rml::Log::Message(Rml::Log::LT_WARNING, "Unhandled render shader %d.", (int)type);
@@ -78,6 +78,8 @@ public:
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
 
+	bool UpdateTexture(Rml::TextureHandle texture_handle, Rml::Span<const Rml::byte> source_data, Rml::Rectanglei region) override;
+
 	Rml::LayerHandle PushLayer() override;
 	void CompositeLayers(Rml::LayerHandle source, Rml::LayerHandle destination, Rml::BlendMode blend_mode,
 		Rml::Span<const Rml::CompiledFilterHandle> filters) override;
@@ -58,6 +58,11 @@ public:
 
 	operator Texture() const;
 
+	/// Overwrites a region of the generated texture, or releases it to be generated again if the render interface does not support updates.
+	/// @param[in] source Texture data in 8-bit RGBA (premultiplied) format, covering only the region.
+	/// @param[in] region The area of the texture to overwrite, in pixels.
+	void Update(Span<const byte> source, Rectanglei region) const;
+
 	void Release();
 
 private:
@@ -108,6 +113,9 @@ public:
 
 	Texture GetTexture(RenderManager& render_manager) const;
 
+	/// Applies a partial update to the texture in every render manager it has been generated for.
+	void UpdateTexture(Span<const byte> source, Rectanglei region) const;
+
 private:
 	CallbackTextureFunction callback;
 	mutable SmallUnorderedMap<RenderManager*, CallbackTexture> textures;
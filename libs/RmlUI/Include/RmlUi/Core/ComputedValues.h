@@ -209,86 +209,95 @@ namespace Style {
 		float scrollbar_margin = 0.f;
 	};
 
+	// The values of an element's computed style. Elements with identical style inputs may share the same values, which
+	// must then be treated as immutable.
+	struct SharedValues {
+		CommonValues common;
+		InheritedValues inherited;
+		RareValues rare;
+	};
+	using SharedValuesPtr = SharedPtr<SharedValues>;
+
 	class ComputedValues : NonCopyMoveable {
 	public:
-		explicit ComputedValues(Element* element) : element(element) {}
+		explicit ComputedValues(Element* element) : element(element), data(GetDefaultValues()) {}
 
 		// clang-format off
 
 		// -- Common --
-		LengthPercentageAuto width()               const { return LengthPercentageAuto(common.width_type, common.width_value); }
-		LengthPercentageAuto height()              const { return LengthPercentageAuto(common.height_type, common.height_value); }
-		LengthPercentageAuto margin_top()          const { return LengthPercentageAuto(common.margin_top_type, common.margin_top_value); }
-		LengthPercentageAuto margin_right()        const { return LengthPercentageAuto(common.margin_right_type, common.margin_right_value); }
-		LengthPercentageAuto margin_bottom()       const { return LengthPercentageAuto(common.margin_bottom_type, common.margin_bottom_value); }
-		LengthPercentageAuto margin_left()         const { return LengthPercentageAuto(common.margin_left_type, common.margin_left_value); }
-		LengthPercentage     padding_top()         const { return LengthPercentage(common.padding_top_type, common.padding_top_value); }
-		LengthPercentage     padding_right()       const { return LengthPercentage(common.padding_right_type, common.padding_right_value); }
-		LengthPercentage     padding_bottom()      const { return LengthPercentage(common.padding_bottom_type, common.padding_bottom_value); }
-		LengthPercentage     padding_left()        const { return LengthPercentage(common.padding_left_type, common.padding_left_value); }
-		LengthPercentageAuto top()                 const { return LengthPercentageAuto(common.top_type, common.top_value); }
-		LengthPercentageAuto right()               const { return LengthPercentageAuto(common.right_type, common.right_value); }
-		LengthPercentageAuto bottom()              const { return LengthPercentageAuto(common.bottom_type, common.bottom_value); }
-		LengthPercentageAuto left()                const { return LengthPercentageAuto(common.left_type, common.left_value); }
-		NumberAuto           z_index()             const { return NumberAuto(common.z_index_type, common.z_index_value); }
-		float                border_top_width()    const { return (float)common.border_top_width; }
-		float                border_right_width()  const { return (float)common.border_right_width; }
-		float                border_bottom_width() const { return (float)common.border_bottom_width; }
-		float                border_left_width()   const { return (float)common.border_left_width; }
-		BoxSizing            box_sizing()          const { return common.box_sizing; }
-		Display              display()             const { return common.display; }
-		Position             position()            const { return common.position; }
-		Float                float_()              const { return common.float_; }
-		Clear                clear()               const { return common.clear; }
-		Overflow             overflow_x()          const { return common.overflow_x; }
-		Overflow             overflow_y()          const { return common.overflow_y; }
-		Visibility           visibility()          const { return common.visibility; }
-		Colourb              background_color()    const { return common.background_color; }
-		Colourb              border_top_color()    const { return common.border_top_color; }
-		Colourb              border_right_color()  const { return common.border_right_color; }
-		Colourb              border_bottom_color() const { return common.border_bottom_color; }
-		Colourb              border_left_color()   const { return common.border_left_color; }
-		bool                 has_decorator()       const { return common.has_decorator; }
+		LengthPercentageAuto width()               const { return LengthPercentageAuto(data->common.width_type, data->common.width_value); }
+		LengthPercentageAuto height()              const { return LengthPercentageAuto(data->common.height_type, data->common.height_value); }
+		LengthPercentageAuto margin_top()          const { return LengthPercentageAuto(data->common.margin_top_type, data->common.margin_top_value); }
+		LengthPercentageAuto margin_right()        const { return LengthPercentageAuto(data->common.margin_right_type, data->common.margin_right_value); }
+		LengthPercentageAuto margin_bottom()       const { return LengthPercentageAuto(data->common.margin_bottom_type, data->common.margin_bottom_value); }
+		LengthPercentageAuto margin_left()         const { return LengthPercentageAuto(data->common.margin_left_type, data->common.margin_left_value); }
+		LengthPercentage     padding_top()         const { return LengthPercentage(data->common.padding_top_type, data->common.padding_top_value); }
+		LengthPercentage     padding_right()       const { return LengthPercentage(data->common.padding_right_type, data->common.padding_right_value); }
+		LengthPercentage     padding_bottom()      const { return LengthPercentage(data->common.padding_bottom_type, data->common.padding_bottom_value); }
+		LengthPercentage     padding_left()        const { return LengthPercentage(data->common.padding_left_type, data->common.padding_left_value); }
+		LengthPercentageAuto top()                 const { return LengthPercentageAuto(data->common.top_type, data->common.top_value); }
+		LengthPercentageAuto right()               const { return LengthPercentageAuto(data->common.right_type, data->common.right_value); }
+		LengthPercentageAuto bottom()              const { return LengthPercentageAuto(data->common.bottom_type, data->common.bottom_value); }
+		LengthPercentageAuto left()                const { return LengthPercentageAuto(data->common.left_type, data->common.left_value); }
+		NumberAuto           z_index()             const { return NumberAuto(data->common.z_index_type, data->common.z_index_value); }
+		float                border_top_width()    const { return (float)data->common.border_top_width; }
+		float                border_right_width()  const { return (float)data->common.border_right_width; }
+		float                border_bottom_width() const { return (float)data->common.border_bottom_width; }
+		float                border_left_width()   const { return (float)data->common.border_left_width; }
+		BoxSizing            box_sizing()          const { return data->common.box_sizing; }
+		Display              display()             const { return data->common.display; }
+		Position             position()            const { return data->common.position; }
+		Float                float_()              const { return data->common.float_; }
+		Clear                clear()               const { return data->common.clear; }
+		Overflow             overflow_x()          const { return data->common.overflow_x; }
+		Overflow             overflow_y()          const { return data->common.overflow_y; }
+		Visibility           visibility()          const { return data->common.visibility; }
+		Colourb              background_color()    const { return data->common.background_color; }
+		Colourb              border_top_color()    const { return data->common.border_top_color; }
+		Colourb              border_right_color()  const { return data->common.border_right_color; }
+		Colourb              border_bottom_color() const { return data->common.border_bottom_color; }
+		Colourb              border_left_color()   const { return data->common.border_left_color; }
+		bool                 has_decorator()       const { return data->common.has_decorator; }
 
 		// -- Inherited --
 		String         font_family()      const;
 		String         cursor()           const;
-		FontFaceHandle font_face_handle() const { return inherited.font_face_handle; }
-		float          font_size()        const { return inherited.font_size; }
+		FontFaceHandle font_face_handle() const { return data->inherited.font_face_handle; }
+		float          font_size()        const { return data->inherited.font_size; }
 		float          letter_spacing()   const;
-		bool           has_font_effect()  const { return inherited.has_font_effect; }
-		FontStyle      font_style()       const { return inherited.font_style; }
-		FontWeight     font_weight()      const { return inherited.font_weight; }
-		PointerEvents  pointer_events()   const { return inherited.pointer_events; }
-		Focus          focus()            const { return inherited.focus; }
-		TextAlign      text_align()       const { return inherited.text_align; }
-		TextDecoration text_decoration()  const { return inherited.text_decoration; }
-		TextTransform  text_transform()   const { return inherited.text_transform; }
-		WhiteSpace     white_space()      const { return inherited.white_space; }
-		WordBreak      word_break()       const { return inherited.word_break; }
-		Colourb        color()            const { return inherited.color; }
-		float          opacity()          const { return inherited.opacity; }
-		LineHeight     line_height()      const { return LineHeight(inherited.line_height, inherited.line_height_inherit_type, inherited.line_height_inherit); }
-		const String&  language()         const { return inherited.language; }
-		Direction      direction()        const { return inherited.direction; }
+		bool           has_font_effect()  const { return data->inherited.has_font_effect; }
+		FontStyle      font_style()       const { return data->inherited.font_style; }
+		FontWeight     font_weight()      const { return data->inherited.font_weight; }
+		PointerEvents  pointer_events()   const { return data->inherited.pointer_events; }
+		Focus          focus()            const { return data->inherited.focus; }
+		TextAlign      text_align()       const { return data->inherited.text_align; }
+		TextDecoration text_decoration()  const { return data->inherited.text_decoration; }
+		TextTransform  text_transform()   const { return data->inherited.text_transform; }
+		WhiteSpace     white_space()      const { return data->inherited.white_space; }
+		WordBreak      word_break()       const { return data->inherited.word_break; }
+		Colourb        color()            const { return data->inherited.color; }
+		float          opacity()          const { return data->inherited.opacity; }
+		LineHeight     line_height()      const { return LineHeight(data->inherited.line_height, data->inherited.line_height_inherit_type, data->inherited.line_height_inherit); }
+		const String&  language()         const { return data->inherited.language; }
+		Direction      direction()        const { return data->inherited.direction; }
 
 		// -- Rare --
-		MinWidth          min_width()                  const { return LengthPercentage(rare.min_width_type, rare.min_width); }
-		MaxWidth          max_width()                  const { return LengthPercentage(rare.max_width_type, rare.max_width); }
-		MinHeight         min_height()                 const { return LengthPercentage(rare.min_height_type, rare.min_height); }
-		MaxHeight         max_height()                 const { return LengthPercentage(rare.max_height_type, rare.max_height); }
-		VerticalAlign     vertical_align()             const { return VerticalAlign(rare.vertical_align_type, rare.vertical_align_length); }
+		MinWidth          min_width()                  const { return LengthPercentage(data->rare.min_width_type, data->rare.min_width); }
+		MaxWidth          max_width()                  const { return LengthPercentage(data->rare.max_width_type, data->rare.max_width); }
+		MinHeight         min_height()                 const { return LengthPercentage(data->rare.min_height_type, data->rare.min_height); }
+		MaxHeight         max_height()                 const { return LengthPercentage(data->rare.max_height_type, data->rare.max_height); }
+		VerticalAlign     vertical_align()             const { return VerticalAlign(data->rare.vertical_align_type, data->rare.vertical_align_length); }
 		const             AnimationList* animation()   const;
 		const             TransitionList* transition() const;
-		float             perspective()                const { return rare.perspective; }
-		PerspectiveOrigin perspective_origin_x()       const { return LengthPercentage(rare.perspective_origin_x_type, rare.perspective_origin_x); }
-		PerspectiveOrigin perspective_origin_y()       const { return LengthPercentage(rare.perspective_origin_y_type, rare.perspective_origin_y); }
+		float             perspective()                const { return data->rare.perspective; }
+		PerspectiveOrigin perspective_origin_x()       const { return LengthPercentage(data->rare.perspective_origin_x_type, data->rare.perspective_origin_x); }
+		PerspectiveOrigin perspective_origin_y()       const { return LengthPercentage(data->rare.perspective_origin_y_type, data->rare.perspective_origin_y); }
 		TransformPtr      transform()                  const { return GetLocalProperty(PropertyId::Transform, TransformPtr()); }
-		TransformOrigin   transform_origin_x()         const { return LengthPercentage(rare.transform_origin_x_type, rare.transform_origin_x); }
-		TransformOrigin   transform_origin_y()         const { return LengthPercentage(rare.transform_origin_y_type, rare.transform_origin_y); }
-		float             transform_origin_z()         const { return rare.transform_origin_z; }
-		bool              has_local_transform()        const { return rare.has_local_transform; }
-		bool              has_local_perspective()      const { return rare.has_local_perspective; }
+		TransformOrigin   transform_origin_x()         const { return LengthPercentage(data->rare.transform_origin_x_type, data->rare.transform_origin_x); }
+		TransformOrigin   transform_origin_y()         const { return LengthPercentage(data->rare.transform_origin_y_type, data->rare.transform_origin_y); }
+		float             transform_origin_z()         const { return data->rare.transform_origin_z; }
+		bool              has_local_transform()        const { return data->rare.has_local_transform; }
+		bool              has_local_perspective()      const { return data->rare.has_local_perspective; }
 		AlignContent      align_content()              const { return GetLocalPropertyKeyword(PropertyId::AlignContent, AlignContent::Stretch); }
 		AlignItems        align_items()                const { return GetLocalPropertyKeyword(PropertyId::AlignItems, AlignItems::Stretch); }
 		AlignSelf         align_self()                 const { return GetLocalPropertyKeyword(PropertyId::AlignSelf, AlignSelf::Auto); }
@@ -297,123 +306,138 @@ namespace Style {
 		JustifyContent    justify_content()            const { return GetLocalPropertyKeyword(PropertyId::JustifyContent, JustifyContent::FlexStart); }
 		float             flex_grow()                  const { return GetLocalProperty(PropertyId::FlexGrow, 0.f); }
 		float             flex_shrink()                const { return GetLocalProperty(PropertyId::FlexShrink, 1.f); }
-		FlexBasis         flex_basis()                 const { return LengthPercentageAuto(rare.flex_basis_type, rare.flex_basis); }
-		float             border_top_left_radius()     const { return (float)rare.border_top_left_radius; }
-		float             border_top_right_radius()    const { return (float)rare.border_top_right_radius; }
-		float             border_bottom_right_radius() const { return (float)rare.border_bottom_right_radius; }
-		float             border_bottom_left_radius()  const { return (float)rare.border_bottom_left_radius; }
-		CornerSizes       border_radius()              const { return {(float)rare.border_top_left_radius,     (float)rare.border_top_right_radius,
-		                                                               (float)rare.border_bottom_right_radius, (float)rare.border_bottom_left_radius}; }
-		Clip              clip()                       const { return rare.clip; }
-		Drag              drag()                       const { return rare.drag; }
-		TabIndex          tab_index()                  const { return rare.tab_index; }
-		Colourb           image_color()                const { return rare.image_color; }
-		LengthPercentage  row_gap()                    const { return LengthPercentage(rare.row_gap_type, rare.row_gap); }
-		LengthPercentage  column_gap()                 const { return LengthPercentage(rare.column_gap_type, rare.column_gap); }
-		OverscrollBehavior overscroll_behavior()       const { return rare.overscroll_behavior; }
-		float             scrollbar_margin()           const { return rare.scrollbar_margin; }
-		bool              has_mask_image()             const { return rare.has_mask_image; }
-		bool              has_filter()                 const { return rare.has_filter; }
-		bool              has_backdrop_filter()        const { return rare.has_backdrop_filter; }
-		bool              has_box_shadow()             const { return rare.has_box_shadow; }
+		FlexBasis         flex_basis()                 const { return LengthPercentageAuto(data->rare.flex_basis_type, data->rare.flex_basis); }
+		float             border_top_left_radius()     const { return (float)data->rare.border_top_left_radius; }
+		float             border_top_right_radius()    const { return (float)data->rare.border_top_right_radius; }
+		float             border_bottom_right_radius() const { return (float)data->rare.border_bottom_right_radius; }
+		float             border_bottom_left_radius()  const { return (float)data->rare.border_bottom_left_radius; }
+		CornerSizes       border_radius()              const { return {(float)data->rare.border_top_left_radius,     (float)data->rare.border_top_right_radius,
+		                                                               (float)data->rare.border_bottom_right_radius, (float)data->rare.border_bottom_left_radius}; }
+		Clip              clip()                       const { return data->rare.clip; }
+		Drag              drag()                       const { return data->rare.drag; }
+		TabIndex          tab_index()                  const { return data->rare.tab_index; }
+		Colourb           image_color()                const { return data->rare.image_color; }
+		LengthPercentage  row_gap()                    const { return LengthPercentage(data->rare.row_gap_type, data->rare.row_gap); }
+		LengthPercentage  column_gap()                 const { return LengthPercentage(data->rare.column_gap_type, data->rare.column_gap); }
+		OverscrollBehavior overscroll_behavior()       const { return data->rare.overscroll_behavior; }
+		float             scrollbar_margin()           const { return data->rare.scrollbar_margin; }
+		bool              has_mask_image()             const { return data->rare.has_mask_image; }
+		bool              has_filter()                 const { return data->rare.has_filter; }
+		bool              has_backdrop_filter()        const { return data->rare.has_backdrop_filter; }
+		bool              has_box_shadow()             const { return data->rare.has_box_shadow; }
 
 		// -- Assignment --
 		// Common
-		void width              (LengthPercentageAuto value) { common.width_type          = value.type; common.width_value          = value.value; }
-		void height             (LengthPercentageAuto value) { common.height_type         = value.type; common.height_value         = value.value; }
-		void margin_top         (LengthPercentageAuto value) { common.margin_top_type     = value.type; common.margin_top_value     = value.value; }
-		void margin_right       (LengthPercentageAuto value) { common.margin_right_type   = value.type; common.margin_right_value   = value.value; }
-		void margin_bottom      (LengthPercentageAuto value) { common.margin_bottom_type  = value.type; common.margin_bottom_value  = value.value; }
-		void margin_left        (LengthPercentageAuto value) { common.margin_left_type    = value.type; common.margin_left_value    = value.value; }
-		void padding_top        (LengthPercentage value)     { common.padding_top_type    = value.type; common.padding_top_value    = value.value; }
-		void padding_right      (LengthPercentage value)     { common.padding_right_type  = value.type; common.padding_right_value  = value.value; }
-		void padding_bottom     (LengthPercentage value)     { common.padding_bottom_type = value.type; common.padding_bottom_value = value.value; }
-		void padding_left       (LengthPercentage value)     { common.padding_left_type   = value.type; common.padding_left_value   = value.value; }
-		void top                (LengthPercentageAuto value) { common.top_type            = value.type; common.top_value            = value.value; }
-		void right              (LengthPercentageAuto value) { common.right_type          = value.type; common.right_value          = value.value; }
-		void bottom             (LengthPercentageAuto value) { common.bottom_type         = value.type; common.bottom_value         = value.value; }
-		void left               (LengthPercentageAuto value) { common.left_type           = value.type; common.left_value           = value.value; }
-		void z_index            (NumberAuto value)           { common.z_index_type        = value.type; common.z_index_value        = value.value; }
-		void border_top_width   (int16_t value)              { common.border_top_width    = value; }
-		void border_right_width (int16_t value)              { common.border_right_width  = value; }
-		void border_bottom_width(int16_t value)              { common.border_bottom_width = value; }
-		void border_left_width  (int16_t value)              { common.border_left_width   = value; }
-		void box_sizing         (BoxSizing value)            { common.box_sizing          = value; }
-		void display            (Display value)              { common.display             = value; }
-		void position           (Position value)             { common.position            = value; }
-		void float_             (Float value)                { common.float_              = value; }
-		void clear              (Clear value)                { common.clear               = value; }
-		void overflow_x         (Overflow value)             { common.overflow_x          = value; }
-		void overflow_y         (Overflow value)             { common.overflow_y          = value; }
-		void visibility         (Visibility value)           { common.visibility          = value; }
-		void background_color   (Colourb value)              { common.background_color    = value; }
-		void border_top_color   (Colourb value)              { common.border_top_color    = value; }
-		void border_right_color (Colourb value)              { common.border_right_color  = value; }
-		void border_bottom_color(Colourb value)              { common.border_bottom_color = value; }
-		void border_left_color  (Colourb value)              { common.border_left_color   = value; }
-		void has_decorator      (bool value)                 { common.has_decorator       = value; }
+		void width              (LengthPercentageAuto value) { Mutable().common.width_type          = value.type; Mutable().common.width_value          = value.value; }
+		void height             (LengthPercentageAuto value) { Mutable().common.height_type         = value.type; Mutable().common.height_value         = value.value; }
+		void margin_top         (LengthPercentageAuto value) { Mutable().common.margin_top_type     = value.type; Mutable().common.margin_top_value     = value.value; }
+		void margin_right       (LengthPercentageAuto value) { Mutable().common.margin_right_type   = value.type; Mutable().common.margin_right_value   = value.value; }
+		void margin_bottom      (LengthPercentageAuto value) { Mutable().common.margin_bottom_type  = value.type; Mutable().common.margin_bottom_value  = value.value; }
+		void margin_left        (LengthPercentageAuto value) { Mutable().common.margin_left_type    = value.type; Mutable().common.margin_left_value    = value.value; }
+		void padding_top        (LengthPercentage value)     { Mutable().common.padding_top_type    = value.type; Mutable().common.padding_top_value    = value.value; }
+		void padding_right      (LengthPercentage value)     { Mutable().common.padding_right_type  = value.type; Mutable().common.padding_right_value  = value.value; }
+		void padding_bottom     (LengthPercentage value)     { Mutable().common.padding_bottom_type = value.type; Mutable().common.padding_bottom_value = value.value; }
+		void padding_left       (LengthPercentage value)     { Mutable().common.padding_left_type   = value.type; Mutable().common.padding_left_value   = value.value; }
+		void top                (LengthPercentageAuto value) { Mutable().common.top_type            = value.type; Mutable().common.top_value            = value.value; }
+		void right              (LengthPercentageAuto value) { Mutable().common.right_type          = value.type; Mutable().common.right_value          = value.value; }
+		void bottom             (LengthPercentageAuto value) { Mutable().common.bottom_type         = value.type; Mutable().common.bottom_value         = value.value; }
+		void left               (LengthPercentageAuto value) { Mutable().common.left_type           = value.type; Mutable().common.left_value           = value.value; }
+		void z_index            (NumberAuto value)           { Mutable().common.z_index_type        = value.type; Mutable().common.z_index_value        = value.value; }
+		void border_top_width   (int16_t value)              { Mutable().common.border_top_width    = value; }
+		void border_right_width (int16_t value)              { Mutable().common.border_right_width  = value; }
+		void border_bottom_width(int16_t value)              { Mutable().common.border_bottom_width = value; }
+		void border_left_width  (int16_t value)              { Mutable().common.border_left_width   = value; }
+		void box_sizing         (BoxSizing value)            { Mutable().common.box_sizing          = value; }
+		void display            (Display value)              { Mutable().common.display             = value; }
+		void position           (Position value)             { Mutable().common.position            = value; }
+		void float_             (Float value)                { Mutable().common.float_              = value; }
+		void clear              (Clear value)                { Mutable().common.clear               = value; }
+		void overflow_x         (Overflow value)             { Mutable().common.overflow_x          = value; }
+		void overflow_y         (Overflow value)             { Mutable().common.overflow_y          = value; }
+		void visibility         (Visibility value)           { Mutable().common.visibility          = value; }
+		void background_color   (Colourb value)              { Mutable().common.background_color    = value; }
+		void border_top_color   (Colourb value)              { Mutable().common.border_top_color    = value; }
+		void border_right_color (Colourb value)              { Mutable().common.border_right_color  = value; }
+		void border_bottom_color(Colourb value)              { Mutable().common.border_bottom_color = value; }
+		void border_left_color  (Colourb value)              { Mutable().common.border_left_color   = value; }
+		void has_decorator      (bool value)                 { Mutable().common.has_decorator       = value; }
 		// Inherited
-		void font_face_handle  (FontFaceHandle value) { inherited.font_face_handle   = value; }
-		void font_size         (float value)          { inherited.font_size          = value; }
-		void has_letter_spacing(bool value)           { inherited.has_letter_spacing = value; }
-		void has_font_effect   (bool value)           { inherited.has_font_effect    = value; }
-		void font_style        (FontStyle value)      { inherited.font_style         = value; }
-		void font_weight       (FontWeight value)     { inherited.font_weight        = value; }
-		void pointer_events    (PointerEvents value)  { inherited.pointer_events     = value; }
-		void focus             (Focus value)          { inherited.focus              = value; }
-		void text_align        (TextAlign value)      { inherited.text_align         = value; }
-		void text_decoration   (TextDecoration value) { inherited.text_decoration    = value; }
-		void text_transform    (TextTransform value)  { inherited.text_transform     = value; }
-		void white_space       (WhiteSpace value)     { inherited.white_space        = value; }
-		void word_break        (WordBreak value)      { inherited.word_break         = value; }
-		void color             (Colourb value)        { inherited.color              = value; }
-		void opacity           (float value)          { inherited.opacity            = value; }
-		void line_height       (LineHeight value)     { inherited.line_height = value.value; inherited.line_height_inherit_type = value.inherit_type; inherited.line_height_inherit = value.inherit_value;  }
-		void language          (const String& value)  { inherited.language           = value; }
-		void direction         (Direction value)      { inherited.direction          = value; }
+		void font_face_handle  (FontFaceHandle value) { Mutable().inherited.font_face_handle   = value; }
+		void font_size         (float value)          { Mutable().inherited.font_size          = value; }
+		void has_letter_spacing(bool value)           { Mutable().inherited.has_letter_spacing = value; }
+		void has_font_effect   (bool value)           { Mutable().inherited.has_font_effect    = value; }
+		void font_style        (FontStyle value)      { Mutable().inherited.font_style         = value; }
+		void font_weight       (FontWeight value)     { Mutable().inherited.font_weight        = value; }
+		void pointer_events    (PointerEvents value)  { Mutable().inherited.pointer_events     = value; }
+		void focus             (Focus value)          { Mutable().inherited.focus              = value; }
+		void text_align        (TextAlign value)      { Mutable().inherited.text_align         = value; }
+		void text_decoration   (TextDecoration value) { Mutable().inherited.text_decoration    = value; }
+		void text_transform    (TextTransform value)  { Mutable().inherited.text_transform     = value; }
+		void white_space       (WhiteSpace value)     { Mutable().inherited.white_space        = value; }
+		void word_break        (WordBreak value)      { Mutable().inherited.word_break         = value; }
+		void color             (Colourb value)        { Mutable().inherited.color              = value; }
+		void opacity           (float value)          { Mutable().inherited.opacity            = value; }
+		void line_height       (LineHeight value)     { Mutable().inherited.line_height = value.value; Mutable().inherited.line_height_inherit_type = value.inherit_type; Mutable().inherited.line_height_inherit = value.inherit_value;  }
+		void language          (const String& value)  { Mutable().inherited.language           = value; }
+		void direction         (Direction value)      { Mutable().inherited.direction          = value; }
 		// Rare
-		void min_width                 (MinWidth value)          { rare.min_width_type             = value.type; rare.min_width                  = value.value; }
-		void max_width                 (MaxWidth value)          { rare.max_width_type             = value.type; rare.max_width                  = value.value; }
-		void min_height                (MinHeight value)         { rare.min_height_type            = value.type; rare.min_height                 = value.value; }
-		void max_height                (MaxHeight value)         { rare.max_height_type            = value.type; rare.max_height                 = value.value; }
-		void vertical_align            (VerticalAlign value)     { rare.vertical_align_type        = value.type; rare.vertical_align_length      = value.value; }
-		void perspective_origin_x      (PerspectiveOrigin value) { rare.perspective_origin_x_type  = value.type; rare.perspective_origin_x       = value.value; }
-		void perspective_origin_y      (PerspectiveOrigin value) { rare.perspective_origin_y_type  = value.type; rare.perspective_origin_y       = value.value; }
-		void transform_origin_x        (TransformOrigin value)   { rare.transform_origin_x_type    = value.type; rare.transform_origin_x         = value.value; }
-		void transform_origin_y        (TransformOrigin value)   { rare.transform_origin_y_type    = value.type; rare.transform_origin_y         = value.value; }
-		void row_gap                   (LengthPercentage value)  { rare.row_gap_type               = value.type; rare.row_gap                    = value.value; }
-		void column_gap                (LengthPercentage value)  { rare.column_gap_type            = value.type; rare.column_gap                 = value.value; }
-		void flex_basis                (FlexBasis value)         { rare.flex_basis_type            = value.type; rare.flex_basis                 = value.value; }
-		void transform_origin_z        (float value)             { rare.transform_origin_z         = value; }
-		void perspective               (float value)             { rare.perspective                = value; }
-		void has_local_perspective     (bool value)              { rare.has_local_perspective      = value; }
-		void has_local_transform       (bool value)              { rare.has_local_transform        = value; }
-		void border_top_left_radius    (float value)             { rare.border_top_left_radius     = (int16_t)value; }
-		void border_top_right_radius   (float value)             { rare.border_top_right_radius    = (int16_t)value; }
-		void border_bottom_right_radius(float value)             { rare.border_bottom_right_radius = (int16_t)value; }
-		void border_bottom_left_radius (float value)             { rare.border_bottom_left_radius  = (int16_t)value; }
-		void clip                      (Clip value)              { rare.clip                       = value; }
-		void drag                      (Drag value)              { rare.drag                       = value; }
-		void tab_index                 (TabIndex value)          { rare.tab_index                  = value; }
-		void image_color               (Colourb value)           { rare.image_color                = value; }
-		void overscroll_behavior       (OverscrollBehavior value){ rare.overscroll_behavior        = value; }
-		void scrollbar_margin          (float value)             { rare.scrollbar_margin           = value; }
-		void has_mask_image            (bool value)              { rare.has_mask_image             = value; }
-		void has_filter                (bool value)              { rare.has_filter                 = value; }
-		void has_backdrop_filter       (bool value)              { rare.has_backdrop_filter        = value; }
-		void has_box_shadow            (bool value)              { rare.has_box_shadow             = value; }
+		void min_width                 (MinWidth value)          { Mutable().rare.min_width_type             = value.type; Mutable().rare.min_width                  = value.value; }
+		void max_width                 (MaxWidth value)          { Mutable().rare.max_width_type             = value.type; Mutable().rare.max_width                  = value.value; }
+		void min_height                (MinHeight value)         { Mutable().rare.min_height_type            = value.type; Mutable().rare.min_height                 = value.value; }
+		void max_height                (MaxHeight value)         { Mutable().rare.max_height_type            = value.type; Mutable().rare.max_height                 = value.value; }
+		void vertical_align            (VerticalAlign value)     { Mutable().rare.vertical_align_type        = value.type; Mutable().rare.vertical_align_length      = value.value; }
+		void perspective_origin_x      (PerspectiveOrigin value) { Mutable().rare.perspective_origin_x_type  = value.type; Mutable().rare.perspective_origin_x       = value.value; }
+		void perspective_origin_y      (PerspectiveOrigin value) { Mutable().rare.perspective_origin_y_type  = value.type; Mutable().rare.perspective_origin_y       = value.value; }
+		void transform_origin_x        (TransformOrigin value)   { Mutable().rare.transform_origin_x_type    = value.type; Mutable().rare.transform_origin_x         = value.value; }
+		void transform_origin_y        (TransformOrigin value)   { Mutable().rare.transform_origin_y_type    = value.type; Mutable().rare.transform_origin_y         = value.value; }
+		void row_gap                   (LengthPercentage value)  { Mutable().rare.row_gap_type               = value.type; Mutable().rare.row_gap                    = value.value; }
+		void column_gap                (LengthPercentage value)  { Mutable().rare.column_gap_type            = value.type; Mutable().rare.column_gap                 = value.value; }
+		void flex_basis                (FlexBasis value)         { Mutable().rare.flex_basis_type            = value.type; Mutable().rare.flex_basis                 = value.value; }
+		void transform_origin_z        (float value)             { Mutable().rare.transform_origin_z         = value; }
+		void perspective               (float value)             { Mutable().rare.perspective                = value; }
+		void has_local_perspective     (bool value)              { Mutable().rare.has_local_perspective      = value; }
+		void has_local_transform       (bool value)              { Mutable().rare.has_local_transform        = value; }
+		void border_top_left_radius    (float value)             { Mutable().rare.border_top_left_radius     = (int16_t)value; }
+		void border_top_right_radius   (float value)             { Mutable().rare.border_top_right_radius    = (int16_t)value; }
+		void border_bottom_right_radius(float value)             { Mutable().rare.border_bottom_right_radius = (int16_t)value; }
+		void border_bottom_left_radius (float value)             { Mutable().rare.border_bottom_left_radius  = (int16_t)value; }
+		void clip                      (Clip value)              { Mutable().rare.clip                       = value; }
+		void drag                      (Drag value)              { Mutable().rare.drag                       = value; }
+		void tab_index                 (TabIndex value)          { Mutable().rare.tab_index                  = value; }
+		void image_color               (Colourb value)           { Mutable().rare.image_color                = value; }
+		void overscroll_behavior       (OverscrollBehavior value){ Mutable().rare.overscroll_behavior        = value; }
+		void scrollbar_margin          (float value)             { Mutable().rare.scrollbar_margin           = value; }
+		void has_mask_image            (bool value)              { Mutable().rare.has_mask_image             = value; }
+		void has_filter                (bool value)              { Mutable().rare.has_filter                 = value; }
+		void has_backdrop_filter       (bool value)              { Mutable().rare.has_backdrop_filter        = value; }
+		void has_box_shadow            (bool value)              { Mutable().rare.has_box_shadow             = value; }
 
 		// clang-format on
 
 		// -- Management --
 		void CopyNonInherited(const ComputedValues& other)
 		{
-			common = other.common;
-			rare = other.rare;
+			SharedValues& values = Mutable();
+			values.common = other.data->common;
+			values.rare = other.data->rare;
 		}
-		void CopyInherited(const ComputedValues& parent) { inherited = parent.inherited; }
+		void CopyInherited(const ComputedValues& parent) { Mutable().inherited = parent.data->inherited; }
+
+		// Refers to the given values from now on, they are copied before any modification while shared.
+		void SetSharedValues(SharedValuesPtr values) { data = std::move(values); }
+		const SharedValuesPtr& GetSharedValues() const { return data; }
 
 	private:
+		// Returns the values for modification, first making a copy if they are shared with other elements.
+		SharedValues& Mutable()
+		{
+			if (data.use_count() != 1)
+				data = MakeShared<SharedValues>(*data);
+			return *data;
+		}
+
+		static const SharedValuesPtr& GetDefaultValues();
+
 		template <typename T>
 		inline T GetLocalPropertyKeyword(PropertyId id, T default_value) const
 		{
@@ -430,10 +454,7 @@ namespace Style {
 		}
 
 		Element* element = nullptr;
-
-		CommonValues common;
-		InheritedValues inherited;
-		RareValues rare;
+		SharedValuesPtr data;
 	};
 
 } // namespace Style
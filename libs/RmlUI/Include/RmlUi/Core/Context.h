@@ -39,13 +39,19 @@
 namespace Rml {
 
 class Stream;
+class AnimationTimeline;
 class ContextInstancer;
 class ElementDocument;
+class EventDispatcher;
 class EventListener;
 class DataModel;
 class DataModelConstructor;
 class DataTypeRegister;
+struct EventDispatchBuffers;
+struct EventParameters;
+class RenderCommandList;
 class ScrollController;
+class ThreadPool;
 class RenderManager;
 class TextInputHandler;
 enum class EventId : uint16_t;
@@ -249,6 +255,21 @@ public:
 	/// @param[in] speed_factor A factor for adjusting the final smooth scrolling speed, must be strictly positive, defaults to 1.0.
 	void SetDefaultScrollBehavior(ScrollBehavior scroll_behavior, float speed_factor);
 
+	/// Sets the number of worker threads used to look up the style definitions of elements during Update(). Only updates that restyle many
+	/// elements at once are split between the threads, such as after changing the active theme or style sheet. Disabled by default.
+	/// @param[in] num_threads The number of worker threads in addition to the calling thread, or zero to resolve styles on the calling thread only.
+	void SetStyleThreadCount(int num_threads);
+	/// Returns the number of worker threads used to look up style definitions.
+	int GetStyleThreadCount() const;
+
+	/// Enables retained rendering, where the render commands of the documents are recorded once and replayed during the following calls to
+	/// Render(). Elements that change only their colors are rendered again, while any other change records all the commands again. Disabled by default.
+	/// @param[in] enable True to enable retained rendering.
+	/// @note The render interface is still called for every command, this only avoids the work of visiting and preparing the elements.
+	void EnableRetainedRendering(bool enable);
+	/// Returns true if retained rendering is enabled.
+	bool IsRetainedRenderingEnabled() const;
+
 	/// Retrieves the render manager which can be used to submit changes to the render state.
 	RenderManager& GetRenderManager();
 
@@ -347,6 +368,15 @@ private:
 	// Controller for various scroll behavior modes.
 	UniquePtr<ScrollController> scroll_controller; // [not-null]
 
+	// The elements with running animations, advanced on every update.
+	UniquePtr<AnimationTimeline> animation_timeline; // [not-null]
+
+	// Worker threads for resolving element definitions, only set when enabled.
+	UniquePtr<ThreadPool> style_thread_pool;
+
+	// The recorded render commands when retained rendering is enabled, otherwise null.
+	UniquePtr<RenderCommandList> render_commands;
+
 	// Enables cursor handling.
 	bool enable_cursor;
 	String cursor_name;
@@ -376,12 +406,18 @@ private:
 
 	TextInputHandler* text_input_handler;
 
+	// Buffers for collecting listeners during event dispatch, reused between events. See EventDispatcher.
+	Vector<UniquePtr<EventDispatchBuffers>> event_dispatch_buffers;
+
 	// Time in seconds until Update and Render should be called again. This allows applications to only redraw the ui if needed.
 	// See RequestNextUpdate() and NextUpdateRequested() for details.
 	double next_update_timeout = 0;
 
 	// Internal callback for when an element is detached or removed from the hierarchy.
 	void OnElementDetach(Element* element);
+	// Requires all render commands to be recorded again, or only the ones of the given element.
+	void DirtyRenderCommands();
+	void DirtyRenderCommands(Element* element);
 	// Internal callback for when a new element gains focus.
 	bool OnFocusChange(Element* element, bool focus_visible);
 
@@ -389,8 +425,8 @@ private:
 	void GenerateClickEvent(Element* element);
 
 	// Updates the current hover elements, sending required events.
-	void UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_state = 0, Dictionary* out_parameters = nullptr,
-		Dictionary* out_drag_parameters = nullptr);
+	void UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_state = 0, EventParameters* out_parameters = nullptr,
+		EventParameters* out_drag_parameters = nullptr);
 
 	// Creates the drag clone from the given element. The old drag clone will be released if necessary.
 	void CreateDragClone(Element* element);
@@ -404,21 +440,23 @@ private:
 	DataModel* GetDataModelPtr(const String& name) const;
 
 	// Builds the parameters for a generic key event.
-	void GenerateKeyEventParameters(Dictionary& parameters, Input::KeyIdentifier key_identifier);
+	void GenerateKeyEventParameters(EventParameters& parameters, Input::KeyIdentifier key_identifier);
 	// Builds the parameters for a generic mouse event.
-	void GenerateMouseEventParameters(Dictionary& parameters, int button_index = -1);
+	void GenerateMouseEventParameters(EventParameters& parameters, int button_index = -1);
 	// Builds the parameters for the key modifier state.
-	void GenerateKeyModifierEventParameters(Dictionary& parameters, int key_modifier_state);
+	void GenerateKeyModifierEventParameters(EventParameters& parameters, int key_modifier_state);
 	// Builds the parameters for a drag event.
-	void GenerateDragEventParameters(Dictionary& parameters);
+	void GenerateDragEventParameters(EventParameters& parameters);
 
 	// Releases all unloaded documents pending destruction.
 	void ReleaseUnloadedDocuments();
 
 	// Sends the specified event to all elements in new_items that don't appear in old_items.
-	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
+	template <typename Parameters>
+	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Parameters& parameters);
 
 	friend class Rml::Element;
+	friend class Rml::EventDispatcher;
 };
 
 } // namespace Rml
@@ -79,6 +79,8 @@ public:
 	/// @param[in] source_dimensions The size of the source region (in pixels). The stride is assumed to be equivalent to the horizontal width.
 	/// @param[in] source_offset The offset of the source region from the destination region. This is usually the same as the kernel size.
 	/// @param[in] source_color_format Determines the representation of the bytes in the source texture, only the alpha channel will be used.
+	/// @note Separable kernels of the sum operation are evaluated in two one-dimensional passes, which may differ from the direct evaluation by
+	/// rounding errors.
 	void Run(byte* destination, Vector2i destination_dimensions, int destination_stride, ColorFormat destination_color_format, const byte* source,
 		Vector2i source_dimensions, Vector2i source_offset, ColorFormat source_color_format) const;
 
@@ -150,6 +150,12 @@ RMLUICORE_API bool LoadFontFace(const String& file_path, bool fallback_face = fa
 /// @lifetime The pointed to 'data' must remain available until after the call to Rml::Shutdown.
 RMLUICORE_API bool LoadFontFace(Span<const byte> data, const String& family, Style::FontStyle style,
 	Style::FontWeight weight = Style::FontWeight::Auto, bool fallback_face = false, int face_index = 0);
+/// Renders text of the default font engine by scaling glyphs rasterized once as signed distance fields, instead of rasterizing each font size
+/// separately. Font effects are then applied while rendering, and custom font effects only supported if they describe themselves in terms of
+/// distance fields. Requires the render interface to support the 'distance-field-text' shader, see the GL3 renderer for a reference.
+/// @param[in] enable True to render scalable font faces from distance fields, false to rasterize all glyphs at their rendered size.
+/// @note Releases font resources when changed after initialisation, which invalidates all existing FontFaceHandles.
+RMLUICORE_API void SetFontDistanceFieldGlyphs(bool enable);
 
 /// Registers a generic RmlUi plugin.
 RMLUICORE_API void RegisterPlugin(Plugin* plugin);
@@ -45,23 +45,28 @@
 
 namespace Rml {
 
+class AnimationTimeline;
 class Context;
 class DataModel;
 class Decorator;
 class ElementInstancer;
 class EventDispatcher;
 class EventListener;
+struct EventParameters;
 class ElementBackgroundBorder;
 class ElementDefinition;
 class ElementDocument;
 class ElementScroll;
 class ElementStyle;
+class HitTestGrid;
+class LayoutCache;
 class LayoutEngine;
 class ContainerBox;
 class InlineLevelBox;
 class ReplacedBox;
 class PropertiesIteratorView;
 class PropertyDictionary;
+class RenderCommandList;
 class RenderManager;
 class StyleSheet;
 class StyleSheetContainer;
@@ -349,6 +354,13 @@ public:
 	/// Returns the element's render manager.
 	/// @return The render manager responsible for this element.
 	RenderManager* GetRenderManager() const;
+	/// Renders this element again during the next frame when retained rendering is enabled for its context.
+	/// @note Only needed by elements whose OnRender() output changes without any change to their properties, attributes, or layout.
+	void DirtyRender();
+	/// Updates this element during the next context update, calling OnUpdate().
+	/// @note Elements are only updated when they have pending work, such as dirty properties or running animations. Only needed by elements
+	/// that do their own work in OnUpdate(), such as polling or timers.
+	void RequestUpdate();
 
 	/** @name DOM Properties
 	 */
@@ -514,6 +526,8 @@ public:
 	bool DispatchEvent(const String& type, const Dictionary& parameters, bool interruptible, bool bubbles = true);
 	/// Sends an event to this element by event id.
 	bool DispatchEvent(EventId id, const Dictionary& parameters);
+	/// Sends an event to this element by event id, using typed parameters which avoids building a dictionary.
+	bool DispatchEvent(EventId id, const EventParameters& parameters);
 
 	/// Scrolls the parent element's contents so that this element is visible.
 	/// @param[in] options Scroll parameters that control the desired element alignment relative to the parent.
@@ -625,7 +639,7 @@ protected:
 	/// Forces the element to generate a local stacking context, regardless of the value of its z-index property.
 	void ForceLocalStackingContext();
 
-	/// Called during the update loop after children are updated.
+	/// Called during the update loop before children are updated, whenever the element has pending work or RequestUpdate() has been called.
 	virtual void OnUpdate();
 	/// Called during render after backgrounds, borders, decorators, but before children, are rendered.
 	virtual void OnRender();
@@ -691,6 +705,13 @@ private:
 	void UpdateAbsoluteOffsetAndRenderBoxData();
 	void UpdateOffset();
 	void SetBaseline(float baseline);
+	// Notifies the owner document that the position, size, or transform of this element has changed.
+	void DirtyGeometry();
+	// Requires the context to record all of its render commands again, if retained rendering is enabled.
+	void DirtyRenderCommands();
+
+	// Renders the background, border, decorators, and contents of this element, but not its stacking context.
+	void RenderSelf();
 
 	void BuildLocalStackingContext();
 	void AddChildrenToStackingContext(Vector<StackingContextChild>& stacking_children);
@@ -728,6 +749,15 @@ private:
 
 	/// Advances the animations (including transitions) forward in time.
 	void AdvanceAnimations();
+	/// Adds this element to its context's animation timeline if it has any animations, so that they are advanced on every context update.
+	void ScheduleAnimations();
+
+	/// Applies an animated value of a property that only affects how the element is drawn, directly to our computed values and render state.
+	/// This avoids resolving our style and dirtying layout on every animation step.
+	/// @return False if the property needs to be set normally.
+	bool SetAnimatedRenderProperty(PropertyId id, const Property& property);
+	/// Sets the computed opacity of this element and the descendants inheriting it.
+	void SetInheritedOpacity(float opacity);
 
 	// State flags are packed together for compact data layout.
 	bool local_stacking_context;
@@ -749,6 +779,8 @@ private:
 	bool dirty_transform : 1;
 	bool dirty_perspective : 1;
 
+	bool update_dirty : 1; // Set if this element or any of its descendants need to be updated, then it is also set on all our ancestors.
+
 	OwnedElementList children;
 	int num_non_dom_children;
 
@@ -807,16 +839,22 @@ private:
 	UniquePtr<TransformState> transform_state;
 
 	ElementAnimationList animations;
+	// Our index in the context's animation timeline, or -1 if we are not part of it.
+	int animation_timeline_index;
 
 	ElementMeta* meta;
 
+	friend class Rml::AnimationTimeline;
 	friend class Rml::Context;
 	friend class Rml::ElementStyle;
+	friend class Rml::HitTestGrid;
 	friend class Rml::ContainerBox;
 	friend class Rml::InlineLevelBox;
 	friend class Rml::ReplacedBox;
+	friend class Rml::LayoutCache;
 	friend class Rml::LayoutEngine;
 	friend class Rml::ElementScroll;
+	friend class Rml::RenderCommandList;
 	friend RMLUICORE_API void Rml::ReleaseFontResources();
 };
 
@@ -33,12 +33,16 @@
 
 namespace Rml {
 
+class AncestorFilter;
 class Context;
 class Stream;
 class DocumentHeader;
 class ElementText;
+class HitTestGrid;
+class LayoutCache;
 class StyleSheet;
 class StyleSheetContainer;
+class StyleSharingCache;
 enum class NavigationSearchDirection;
 
 /** ModalFlag controls the modal state of the document. */
@@ -162,8 +166,6 @@ private:
 	/// Find the next element to navigate to, starting at the current element.
 	Element* FindNextNavigationElement(Element* current_element, NavigationSearchDirection direction, const Property& property);
 
-	/// Sets the dirty flag on the layout so the document will format its children before the next render.
-	void DirtyLayout() override;
 	/// Returns true if the document has been marked as needing a re-layout.
 	bool IsLayoutDirty() override;
 
@@ -194,8 +196,20 @@ private:
 	bool layout_dirty;
 	bool position_dirty;
 
+	// Incremented whenever the position, size, or transform of any element in the document changes.
+	uint64_t geometry_generation;
+
+	// Recently computed values which may be shared by other elements in the document.
+	UniquePtr<StyleSharingCache> style_sharing_cache;
+	// The ancestors of the elements currently being updated, used to speed up selector matching.
+	UniquePtr<AncestorFilter> ancestor_filter;
+
 	friend class Rml::Context;
+	friend class Rml::Element;
+	friend class Rml::ElementStyle;
 	friend class Rml::Factory;
+	friend class Rml::HitTestGrid;
+	friend class Rml::LayoutCache;
 };
 
 } // namespace Rml
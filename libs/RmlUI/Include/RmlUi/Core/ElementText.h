@@ -110,6 +110,7 @@ private:
 	struct TexturedGeometry {
 		Geometry geometry;
 		Texture texture;
+		const CompiledShader* shader = nullptr;
 	};
 	Vector<TexturedGeometry> geometry;
 
@@ -87,6 +87,12 @@ public:
 	/// @param[in] prior_character The character placed just before this string, used for kerning.
 	/// @return The string width, in pixels.
 	static int GetStringWidth(Element* element, StringView string, Character prior_character = Character::Null);
+	/// Returns the width of every leading part of a string rendered within the context of the given element.
+	/// @param[in] element The element to measure the string from.
+	/// @param[in] string The string to measure.
+	/// @param[out] prefix_widths Entry 'i' is set to the width of the first 'i' characters of the string, in pixels.
+	/// @param[in] prior_character The character placed just before this string, used for kerning.
+	static void GetStringPrefixWidths(Element* element, StringView string, Vector<int>& prefix_widths, Character prior_character = Character::Null);
 
 	/// Generates the clipping region for an element.
 	/// @param[in] element The element to generate the clipping region for.
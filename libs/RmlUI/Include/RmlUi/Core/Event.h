@@ -32,6 +32,7 @@
 #include "Dictionary.h"
 #include "Header.h"
 #include "ID.h"
+#include "Input.h"
 #include "ScriptInterface.h"
 
 namespace Rml {
@@ -44,6 +45,38 @@ struct EventSpecification;
 enum class EventPhase { None, Capture = 1, Target = 2, Bubble = 4 };
 enum class DefaultActionPhase { None, Target = (int)EventPhase::Target, TargetAndBubble = ((int)Target | (int)EventPhase::Bubble) };
 
+/**
+    Typed parameters for the built-in mouse, key, drag and scroll events.
+
+    Events dispatched with these parameters do not need to build a dictionary. The dictionary is only generated on demand,
+    when the parameters are requested by name from the event.
+ */
+struct RMLUICORE_API EventParameters {
+	enum Flags {
+		None = 0,
+		Mouse = 1 << 0,        // 'mouse_x' and 'mouse_y'
+		Button = 1 << 1,       // 'button'
+		Key = 1 << 2,          // 'key_identifier'
+		KeyModifiers = 1 << 3, // 'ctrl_key', 'shift_key', 'alt_key', 'meta_key', 'caps_lock_key', 'num_lock_key', 'scroll_lock_key'
+		Drag = 1 << 4,         // 'drag_element'
+		Wheel = 1 << 5,        // 'wheel_delta_x' and 'wheel_delta_y'
+		Autoscroll = 1 << 6,   // 'autoscroll'
+	};
+
+	// Combination of the above flags, determines which of the following members are specified.
+	int flags = None;
+
+	Vector2i mouse_position;
+	int button = -1;
+	Input::KeyIdentifier key_identifier = Input::KI_UNKNOWN;
+	int key_modifier_state = 0;
+	Element* drag_element = nullptr;
+	Vector2f wheel_delta;
+
+	/// Adds the specified parameters to the given dictionary, using the names of the parameters listed above.
+	void ToDictionary(Dictionary& dictionary) const;
+};
+
 /**
     An event that propagates through the element hierarchy. Events follow the DOM3 event specification. See
     http://www.w3.org/TR/DOM-Level-3-Events/events.html.
@@ -62,6 +95,13 @@ public:
 	/// @param[in] parameters The event parameters
 	/// @param[in] interruptible Can this event have is propagation stopped?
 	Event(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible);
+	/// Constructor
+	/// @param[in] target The target element of this event
+	/// @param[in] id The event id
+	/// @param[in] type The event type
+	/// @param[in] parameters The typed event parameters
+	/// @param[in] interruptible Can this event have is propagation stopped?
+	Event(Element* target, EventId id, const String& type, const EventParameters& parameters, bool interruptible);
 	/// Destructor
 	virtual ~Event();
 
@@ -108,7 +148,7 @@ public:
 	template <typename T>
 	T GetParameter(const String& key, const T& default_value) const
 	{
-		return Get(parameters, key, default_value);
+		return Get(GetParameters(), key, default_value);
 	}
 	/// Access the dictionary of parameters
 	/// @return The dictionary of parameters
@@ -118,8 +158,19 @@ public:
 	/// Note: Only specified for events with 'mouse_x' and 'mouse_y' parameters.
 	Vector2f GetUnprojectedMouseScreenPos() const;
 
+	/// Returns the mouse position projected to the current element, equivalent to the 'mouse_x' and 'mouse_y' parameters.
+	/// Note: Only specified for events with 'mouse_x' and 'mouse_y' parameters, otherwise returns (0, 0).
+	Vector2f GetMousePosition() const;
+	/// Returns the mouse button index, equivalent to the 'button' parameter, or -1 if not specified.
+	int GetMouseButton() const;
+	/// Returns the key identifier, equivalent to the 'key_identifier' parameter, or KI_UNKNOWN if not specified.
+	Input::KeyIdentifier GetKeyIdentifier() const;
+	/// Returns the key modifier state as a combination of Input::KeyModifier flags, equivalent to the modifier key parameters.
+	int GetKeyModifierState() const;
+
 protected:
-	Dictionary parameters;
+	// Generated on demand for events constructed from typed parameters.
+	mutable Dictionary parameters;
 
 	Element* target_element = nullptr;
 	Element* current_element = nullptr;
@@ -128,6 +179,8 @@ private:
 	/// Project the mouse coordinates to the current element to enable
 	/// interacting with transformed elements.
 	void ProjectMouse(Element* element);
+	/// Set the mouse position, updating the dictionary parameters if they are present.
+	void SetMousePosition(Vector2f position);
 
 	/// Release this event through its instancer.
 	void Release() override;
@@ -140,7 +193,14 @@ private:
 	bool interrupted_immediate = false;
 
 	bool has_mouse_position = false;
+	bool mouse_position_projected = false;
 	Vector2f mouse_screen_position = Vector2f(0, 0);
+	Vector2f mouse_position = Vector2f(0, 0);
+
+	// Only used when constructed from typed parameters, in which case the dictionary is generated on first access.
+	bool has_typed_parameters = false;
+	mutable bool typed_parameters_generated = false;
+	EventParameters typed_parameters;
 
 	EventPhase phase = EventPhase::None;
 
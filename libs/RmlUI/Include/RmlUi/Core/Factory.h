@@ -57,6 +57,7 @@ class PropertySpecification;
 class DecoratorInstancerInterface;
 class RenderManager;
 class TextInputHandler;
+struct EventParameters;
 enum class EventId : uint16_t;
 
 /**
@@ -177,6 +178,14 @@ public:
 	/// @param[in] interruptible If the event propagation can be stopped.
 	/// @return The instanced event.
 	static EventPtr InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible);
+	/// Instance an event object from typed parameters, see EventParameters.
+	/// @param[in] target Target element of this event.
+	/// @param[in] id ID of this event.
+	/// @param[in] type Name of this event type.
+	/// @param[in] parameters Typed parameters for this event.
+	/// @param[in] interruptible If the event propagation can be stopped.
+	/// @return The instanced event.
+	static EventPtr InstanceEvent(Element* target, EventId id, const String& type, const EventParameters& parameters, bool interruptible);
 
 	/// Register the instancer to be used for all event listeners, or nullptr to clear an existing instancer.
 	/// @lifetime The instancer must be kept alive until after the call to Rml::Shutdown, or until a new instancer is set.
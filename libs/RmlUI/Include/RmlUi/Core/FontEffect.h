@@ -42,6 +42,16 @@ public:
 	// Behind or in front of the main text.
 	enum class Layer { Back, Front };
 
+	// Describes how to render the effect from the distance fields of the glyphs, all lengths in pixels.
+	struct DistanceFieldParameters {
+		// Grows the glyph outlines outwards.
+		float dilation = 0;
+		// Widens the anti-aliased transition across the glyph outlines.
+		float softness = 0;
+		// Offsets the rendered glyphs.
+		Vector2f offset;
+	};
+
 	FontEffect();
 	virtual ~FontEffect();
 
@@ -66,6 +76,12 @@ public:
 	/// @param[in] glyph The glyph the effect is being asked to generate an effect texture for.
 	virtual void GenerateGlyphTexture(byte* destination_data, Vector2i destination_dimensions, int destination_stride, const FontGlyph& glyph) const;
 
+	/// Requests the effect to describe itself in terms of the glyph distance fields. Used instead of generating glyph textures when the font
+	/// engine renders text from distance fields, effects not supporting this are not rendered in that case.
+	/// @param[out] parameters The parameters to render the effect with.
+	/// @return True if the effect can be rendered from distance fields, false if not. The default implementation returns false.
+	virtual bool GetDistanceFieldParameters(DistanceFieldParameters& parameters) const;
+
 	/// Sets the colour of the effect's geometry.
 	void SetColour(Colourb colour);
 	/// Returns the effect's colour.
@@ -104,6 +104,17 @@ public:
 	virtual int GetStringWidth(FontFaceHandle handle, StringView string, const TextShapingContext& text_shaping_context,
 		Character prior_character = Character::Null);
 
+	/// Called by RmlUi when it wants to retrieve the width of every leading part of a string, such as when breaking words
+	/// or placing a cursor. The default implementation measures each prefix using GetStringWidth().
+	/// @param[in] handle The font handle.
+	/// @param[in] string The string to measure.
+	/// @param[in] text_shaping_context Additional parameters that provide context for text shaping.
+	/// @param[in] prior_character The optionally-specified character that immediately precedes the string.
+	/// @param[out] prefix_widths Entry 'i' is set to the width of the first 'i' characters of the string, the number of entries is one more
+	/// than the number of characters.
+	virtual void GetStringPrefixWidths(FontFaceHandle handle, StringView string, const TextShapingContext& text_shaping_context,
+		Character prior_character, Vector<int>& prefix_widths);
+
 	/// Called by RmlUi when it wants to retrieve the meshes required to render a single line of text.
 	/// @param[in] render_manager The render manager responsible for rendering the string.
 	/// @param[in] face_handle The font handle.
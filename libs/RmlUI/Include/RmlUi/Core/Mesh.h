@@ -44,9 +44,13 @@ struct RMLUICORE_API Mesh {
 	friend bool operator!=(const Mesh& lhs, const Mesh& rhs) { return !(lhs == rhs); }
 };
 
+class CompiledShader;
+
 struct RMLUICORE_API TexturedMesh {
 	Mesh mesh;
 	Texture texture;
+	// Optional shader to render the mesh with, owned by the producer of the mesh.
+	const CompiledShader* shader = nullptr;
 };
 
 using TexturedMeshList = Vector<TexturedMesh>;
@@ -123,6 +123,14 @@ public:
 	/// @note The transform applies to all functions that render with a geometry handle, and only those.
 	virtual void SetTransform(const Matrix4f* transform);
 
+	/// Called by RmlUi when it wants to overwrite part of a texture previously returned by GenerateTexture().
+	/// @param[in] texture The texture handle to update.
+	/// @param[in] source The raw texture data for the region only, in the same format as for GenerateTexture().
+	/// @param[in] region The area of the texture to overwrite, in pixels.
+	/// @return True if the texture was updated. Otherwise, the texture is released and generated again in full.
+	/// @note Used by the font engine to add new glyphs to an existing atlas page.
+	virtual bool UpdateTexture(TextureHandle texture, Span<const byte> source, Rectanglei region);
+
 	/// Called by RmlUi when it wants to push a new layer onto the render stack, setting it as the new render target.
 	/// @return An application-specified handle representing the new layer. The value 'zero' is reserved for the initial base layer.
 	/// @note The new layer should be initialized to transparent black within the current scissor region.
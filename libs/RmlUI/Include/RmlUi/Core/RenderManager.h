@@ -40,6 +40,7 @@ namespace Rml {
 class Geometry;
 class CompiledFilter;
 class CompiledShader;
+class RenderCommandList;
 class TextureDatabase;
 class Texture;
 class RenderManagerAccess;
@@ -66,6 +67,15 @@ struct RenderState {
 	Matrix4f transform = Matrix4f::Identity();
 };
 
+struct RenderStatistics {
+	// Elements submitted for rendering during the last render pass.
+	int elements_drawn = 0;
+	// Elements skipped during the last render pass, because they were located outside the active clipping region.
+	int elements_culled = 0;
+	// Render commands replayed during the last render pass without rendering their elements, see Context::EnableRetainedRendering().
+	int commands_replayed = 0;
+};
+
 /**
     A wrapper over the render interface, which tracks its state and resources.
 
@@ -96,6 +106,9 @@ public:
 	void SetState(const RenderState& next);
 	void ResetState();
 
+	// Statistics of the current render pass, reset when preparing a new render pass.
+	const RenderStatistics& GetStatistics() const { return statistics; }
+
 	Geometry MakeGeometry(Mesh&& mesh);
 
 	Texture LoadTexture(const String& source, const String& document_path = String());
@@ -120,6 +133,11 @@ private:
 	CompiledGeometryHandle GetCompiledGeometryHandle(StableVectorIndex index);
 
 	void Render(const Geometry& geometry, Vector2f translation, Texture texture, const CompiledShader& shader);
+	void RenderGeometry(StableVectorIndex geometry, Vector2f translation, Texture texture, CompiledShaderHandle shader);
+
+	// Layers are recorded by their depth in the render stack, with -1 for the base layer.
+	int GetLayerDepth(LayerHandle layer) const;
+	LayerHandle GetLayerAtDepth(int depth) const;
 
 	void GetTextureSourceList(StringList& source_list) const;
 	const Mesh& GetMesh(const Geometry& geometry) const;
@@ -149,8 +167,17 @@ private:
 	RenderState state;
 	Vector2i viewport_dimensions;
 
+	RenderStatistics statistics;
+
 	Vector<LayerHandle> render_stack;
 
+	// Commands submitted to the render manager are recorded into this list when set, see RenderCommandList.
+	RenderCommandList* command_list = nullptr;
+	// Number of resources released, used to detect when recorded commands may refer to released resources. Geometry is counted separately, as
+	// it is owned by a single element, unlike textures, filters, and shaders which may be shared.
+	int num_released_resources = 0;
+	int num_released_geometry = 0;
+
 	friend class RenderManagerAccess;
 };
 
@@ -33,9 +33,11 @@
 #include "Spritesheet.h"
 #include "StyleSheetTypes.h"
 #include "Traits.h"
+#include <mutex>
 
 namespace Rml {
 
+class AncestorFilter;
 class Element;
 class ElementDefinition;
 class StyleSheetNode;
@@ -82,7 +84,8 @@ public:
 	const Sprite* GetSprite(const String& name) const;
 
 	/// Returns the compiled element definition for a given element and its hierarchy.
-	SharedPtr<const ElementDefinition> GetElementDefinition(const Element* element) const;
+	/// @param[in] ancestor_filter Optionally, a filter of the element's ancestors to speed up matching of descendant selectors.
+	SharedPtr<const ElementDefinition> GetElementDefinition(const Element* element, const AncestorFilter* ancestor_filter = nullptr) const;
 
 	/// Returns a list of instanced decorators from the declarations. The instances are cached for faster future retrieval.
 	const DecoratorPtrList& InstanceDecorators(RenderManager& render_manager, const DecoratorDeclarationList& declaration_list,
@@ -116,6 +119,8 @@ private:
 	// Index of node sets to element definitions.
 	using ElementDefinitionCache = UnorderedMap<StyleSheetIndex::NodeList, SharedPtr<const ElementDefinition>>;
 	mutable ElementDefinitionCache node_cache;
+	// Guards the node cache, element definitions may be looked up from several threads at once.
+	mutable std::mutex node_cache_mutex;
 
 	// Cached decorator instances.
 	using DecoratorCache = UnorderedMap<String, Vector<SharedPtr<const Decorator>>>;
@@ -102,10 +102,11 @@ using MediaBlockList = Vector<MediaBlock>;
  */
 struct StyleSheetIndex {
 	using NodeList = Vector<const StyleSheetNode*>;
+	// Keyed by the value of the atom interned for the id, class, or tag name, the pseudo class id, or the hash of the attribute name.
 	using NodeIndex = UnorderedMap<size_t, NodeList>;
 
 	// The following objects are given in prioritized order. Any nodes in the first object will not be contained in the next one and so on.
-	NodeIndex ids, classes, tags;
+	NodeIndex ids, classes, tags, pseudo_classes, attributes;
 	NodeList other;
 };
 } // namespace Rml
@@ -81,6 +81,9 @@ void ElementGame::ProcessEvent(Rml::Event& event)
 void ElementGame::OnUpdate()
 {
 	game->Update(Rml::GetSystemInterface()->GetElapsedTime());
+
+	// The game is advanced on every update.
+	RequestUpdate();
 }
 
 void ElementGame::OnRender()
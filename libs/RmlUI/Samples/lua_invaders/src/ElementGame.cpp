@@ -82,6 +82,9 @@ void ElementGame::OnUpdate()
 {
 	game->Update(Rml::GetSystemInterface()->GetElapsedTime());
 
+	// The game is advanced on every update.
+	RequestUpdate();
+
 	if (game->IsGameOver())
 		DispatchEvent("gameover", Rml::Dictionary());
 }
@@ -0,0 +1,163 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "AncestorFilter.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "ElementStyle.h"
+#include <string.h>
+
+namespace Rml {
+
+uint32_t AncestorFilter::GetHash(Atom name, NameType type)
+{
+	uint32_t hash = ((uint32_t(name) << 2) | uint32_t(type)) * 0x9E3779B1u;
+	return hash ^ (hash >> 16);
+}
+
+void AncestorFilter::Push(const Element* element)
+{
+	RMLUI_ASSERT(IsValidFor(element));
+
+	ancestors.push_back(Ancestor{element, hashes.size()});
+
+	const ElementStyle* style = element->GetStyle();
+	hashes.push_back(GetHash(style->GetTagAtom(), NameType::Tag));
+	if (style->GetIdAtom() != Atom::Invalid)
+		hashes.push_back(GetHash(style->GetIdAtom(), NameType::Id));
+	for (Atom class_atom : style->GetClassAtoms())
+		hashes.push_back(GetHash(class_atom, NameType::Class));
+
+	for (size_t i = ancestors.back().hashes_begin; i < hashes.size(); i++)
+		AddHash(hashes[i]);
+}
+
+void AncestorFilter::Pop(const Element* element)
+{
+	RMLUI_ASSERT(!ancestors.empty() && ancestors.back().element == element);
+	(void)element;
+
+	const size_t hashes_begin = ancestors.back().hashes_begin;
+	for (size_t i = hashes_begin; i < hashes.size(); i++)
+		RemoveHash(hashes[i]);
+
+	hashes.resize(hashes_begin);
+	ancestors.pop_back();
+}
+
+void AncestorFilter::SetAncestorsOf(const Element* element)
+{
+	const Element* parent = element->GetParentNode();
+	if (IsValidFor(element))
+		return;
+
+	// Moving down to the first child of the previous element.
+	if (parent && IsValidFor(parent))
+	{
+		Push(parent);
+		return;
+	}
+
+	// Moving back up to a sibling of one of the ancestors.
+	for (size_t i = ancestors.size(); i-- > 0;)
+	{
+		if (ancestors[i].element == parent)
+		{
+			while (ancestors.size() > i + 1)
+				Pop(ancestors.back().element);
+			return;
+		}
+	}
+
+	// Otherwise, rebuild the filter from the element's ancestor chain, keeping any common ancestors.
+	chain.clear();
+	for (const Element* ancestor = parent; ancestor; ancestor = ancestor->GetParentNode())
+		chain.push_back(ancestor);
+
+	size_t num_common = 0;
+	while (num_common < ancestors.size() && num_common < chain.size() && ancestors[num_common].element == chain[chain.size() - 1 - num_common])
+		num_common += 1;
+
+	while (ancestors.size() > num_common)
+		Pop(ancestors.back().element);
+
+	for (size_t i = chain.size() - num_common; i-- > 0;)
+		Push(chain[i]);
+
+	RMLUI_ASSERT(IsValidFor(element));
+}
+
+void AncestorFilter::Clear()
+{
+	ancestors.clear();
+	hashes.clear();
+	memset(counters, 0, sizeof(counters));
+}
+
+bool AncestorFilter::IsEmpty() const
+{
+	return ancestors.empty();
+}
+
+bool AncestorFilter::IsValidFor(const Element* element) const
+{
+	const Element* parent = element->GetParentNode();
+	if (ancestors.empty())
+		return parent == nullptr;
+	return ancestors.back().element == parent;
+}
+
+bool AncestorFilter::MightContainAll(const Vector<uint32_t>& name_hashes) const
+{
+	for (uint32_t hash : name_hashes)
+	{
+		if (counters[hash & CounterMask] == 0 || counters[(hash >> 12) & CounterMask] == 0)
+			return false;
+	}
+	return true;
+}
+
+void AncestorFilter::AddHash(uint32_t hash)
+{
+	for (uint32_t index : {hash & CounterMask, (hash >> 12) & CounterMask})
+	{
+		if (counters[index] != MaxCount)
+			counters[index] += 1;
+	}
+}
+
+void AncestorFilter::RemoveHash(uint32_t hash)
+{
+	for (uint32_t index : {hash & CounterMask, (hash >> 12) & CounterMask})
+	{
+		RMLUI_ASSERT(counters[index] > 0);
+		if (counters[index] != MaxCount)
+			counters[index] -= 1;
+	}
+}
+
+} // namespace Rml
@@ -0,0 +1,92 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ANCESTORFILTER_H
+#define RMLUI_CORE_ANCESTORFILTER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "Atom.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+    A counting Bloom filter of the tag, id, and class names of an element's ancestors.
+
+    Used during selector matching to reject descendant and child selectors in constant time, whenever the filter shows that none of the
+    ancestors has one of the names required by the selector. The filter may report false positives, but never false negatives.
+ */
+class AncestorFilter {
+public:
+	enum class NameType : uint32_t { Tag, Id, Class };
+
+	/// Returns the hash used to look up the given name in the filter.
+	static uint32_t GetHash(Atom name, NameType type);
+
+	/// Adds the element as the innermost ancestor of the elements to be matched next.
+	void Push(const Element* element);
+	/// Removes the innermost ancestor, which must be the given element.
+	void Pop(const Element* element);
+	/// Pushes and pops ancestors as necessary so that the filter represents exactly the ancestors of the given element.
+	/// @note Cheap when elements are visited in tree order, as the previous ancestors can mostly be reused.
+	void SetAncestorsOf(const Element* element);
+	/// Removes all ancestors from the filter.
+	void Clear();
+
+	/// Returns true if no ancestors have been added.
+	bool IsEmpty() const;
+	/// Returns true if the filter represents exactly the ancestors of the given element.
+	bool IsValidFor(const Element* element) const;
+	/// Returns false if any of the hashes is definitely not found among the ancestors.
+	bool MightContainAll(const Vector<uint32_t>& name_hashes) const;
+
+private:
+	static constexpr uint32_t NumCounters = 4096;
+	static constexpr uint32_t CounterMask = NumCounters - 1;
+	static constexpr uint8_t MaxCount = 255;
+
+	void AddHash(uint32_t hash);
+	void RemoveHash(uint32_t hash);
+
+	struct Ancestor {
+		const Element* element;
+		size_t hashes_begin;
+	};
+	Vector<Ancestor> ancestors;
+	// The hashes added for each ancestor, so that they can be removed again even if the element's names have changed in the meantime.
+	Vector<uint32_t> hashes;
+	// Temporary list used when looking up a new ancestor chain.
+	Vector<const Element*> chain;
+
+	// Each hash increments two counters, saturated counters are never decremented.
+	uint8_t counters[NumCounters] = {};
+};
+
+} // namespace Rml
+#endif
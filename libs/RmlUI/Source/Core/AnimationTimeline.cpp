@@ -0,0 +1,97 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "AnimationTimeline.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include <algorithm>
+
+namespace Rml {
+
+void AnimationTimeline::Add(Element* element)
+{
+	if (element->animation_timeline_index >= 0)
+		return;
+
+	element->animation_timeline_index = (int)elements.size();
+	elements.push_back(element);
+}
+
+void AnimationTimeline::Remove(Element* element)
+{
+	if (element->animation_timeline_index >= 0)
+		RemoveAt((size_t)element->animation_timeline_index);
+
+	// The descendants of a document are not notified when the document itself is removed from the context.
+	if (element->GetOwnerDocument() == element)
+	{
+		for (size_t i = 0; i < elements.size(); i++)
+		{
+			if (elements[i] && elements[i]->GetOwnerDocument() == element)
+				RemoveAt(i);
+		}
+	}
+}
+
+bool AnimationTimeline::Advance()
+{
+	bool running_visible = false;
+
+	// Elements added during the pass are appended and advanced in the same pass, while removed elements leave their slot empty.
+	for (size_t i = 0; i < elements.size(); i++)
+	{
+		Element* element = elements[i];
+		if (!element)
+			continue;
+
+		element->AdvanceAnimations();
+
+		if (!elements[i])
+			continue;
+
+		if (element->animations.empty())
+			RemoveAt(i);
+		else if (!running_visible && element->IsVisible(true))
+			running_visible = true;
+	}
+
+	auto it_end = std::remove(elements.begin(), elements.end(), nullptr);
+	elements.erase(it_end, elements.end());
+	for (size_t i = 0; i < elements.size(); i++)
+		elements[i]->animation_timeline_index = (int)i;
+
+	return running_visible;
+}
+
+void AnimationTimeline::RemoveAt(size_t index)
+{
+	elements[index]->animation_timeline_index = -1;
+	elements[index] = nullptr;
+}
+
+} // namespace Rml
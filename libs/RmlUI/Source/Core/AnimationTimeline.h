@@ -26,49 +26,36 @@
  *
  */
 
-#ifndef TEXTURELAYOUTTEXTURE_H
-#define TEXTURELAYOUTTEXTURE_H
+#ifndef RMLUI_CORE_ANIMATIONTIMELINE_H
+#define RMLUI_CORE_ANIMATIONTIMELINE_H
 
-#include "../../Include/RmlUi/Core/Texture.h"
-#include "TextureLayoutRow.h"
+#include "../../Include/RmlUi/Core/Types.h"
 
 namespace Rml {
 
-class TextureLayout;
+class Element;
 
 /**
-    A texture layout texture is a single rectangular area which sub-rectangles are placed on within
-    a complete texture layout.
+    The elements with running animations or transitions in a context, advanced together in a single pass before the element tree is updated.
 
-    @author Peter
+    Elements are kept in a flat list and remember their own index into it. Removed elements leave an empty slot behind which is compacted after
+    the next pass, so that elements can safely be added and removed while advancing, such as from animation event listeners.
  */
-
-class TextureLayoutTexture {
+class AnimationTimeline {
 public:
-	TextureLayoutTexture();
-	~TextureLayoutTexture();
-
-	/// Returns the texture's dimensions. This is only valid after the texture has been generated.
-	/// @return The texture's dimensions.
-	Vector2i GetDimensions() const;
-
-	/// Attempts to position unplaced rectangles from the layout into this texture. The size of
-	/// this texture will be determined by its contents.
-	/// @param[in] layout The layout to position rectangles from.
-	/// @param[in] maximum_dimensions The maximum dimensions of this texture. If this is not big enough to place all the rectangles, then as many will
-	/// be placed as possible.
-	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int maximum_dimensions);
+	/// Adds the element to the timeline, unless it is already added.
+	void Add(Element* element);
+	/// Removes the element from the timeline. Removing a document also removes all of its descendants.
+	void Remove(Element* element);
 
-	/// Allocates the texture.
-	/// @return The allocated texture data.
-	Vector<byte> AllocateTexture();
+	/// Advances the animations of all elements, and removes the elements whose animations have all completed.
+	/// @return True if any animations are still running on visible elements.
+	bool Advance();
 
 private:
-	using RowList = Vector<TextureLayoutRow>;
+	void RemoveAt(size_t index);
 
-	Vector2i dimensions;
-	RowList rows;
+	Vector<Element*> elements;
 };
 
 } // namespace Rml
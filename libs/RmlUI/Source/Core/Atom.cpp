@@ -0,0 +1,122 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "Atom.h"
+#include "ControlledLifetimeResource.h"
+
+namespace Rml {
+
+template <typename ID>
+class AtomNameMap {
+public:
+	AtomNameMap() { names.emplace_back(); }
+
+	ID GetOrInsert(const String& name)
+	{
+		if (name.empty())
+			return ID::Invalid;
+
+		auto result = lookup.emplace(name, ID(names.size()));
+		if (result.second)
+			names.push_back(name);
+		return result.first->second;
+	}
+
+	ID Get(const String& name) const
+	{
+		auto it = lookup.find(name);
+		if (it != lookup.end())
+			return it->second;
+		return ID::Invalid;
+	}
+
+	const String& GetName(ID id) const
+	{
+		if (size_t(id) < names.size())
+			return names[size_t(id)];
+		return names[size_t(ID::Invalid)];
+	}
+
+private:
+	// IDs are indices into the names list.
+	Vector<String> names;
+	UnorderedMap<String, ID> lookup;
+};
+
+struct AtomTableData {
+	AtomNameMap<Atom> atoms;
+	AtomNameMap<PseudoClassId> pseudo_classes;
+};
+
+static ControlledLifetimeResource<AtomTableData> atom_table_data;
+
+namespace AtomTable {
+
+	void Initialize()
+	{
+		atom_table_data.Initialize();
+	}
+
+	void Shutdown()
+	{
+		atom_table_data.Shutdown();
+	}
+
+	Atom GetOrInsert(const String& name)
+	{
+		return atom_table_data->atoms.GetOrInsert(name);
+	}
+
+	Atom Get(const String& name)
+	{
+		return atom_table_data->atoms.Get(name);
+	}
+
+	const String& GetName(Atom atom)
+	{
+		return atom_table_data->atoms.GetName(atom);
+	}
+
+	PseudoClassId GetOrInsertPseudoClass(const String& name)
+	{
+		return atom_table_data->pseudo_classes.GetOrInsert(name);
+	}
+
+	PseudoClassId GetPseudoClass(const String& name)
+	{
+		return atom_table_data->pseudo_classes.Get(name);
+	}
+
+	const String& GetPseudoClassName(PseudoClassId id)
+	{
+		return atom_table_data->pseudo_classes.GetName(id);
+	}
+
+} // namespace AtomTable
+
+} // namespace Rml
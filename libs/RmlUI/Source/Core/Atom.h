@@ -0,0 +1,75 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ATOM_H
+#define RMLUI_CORE_ATOM_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    Atoms are interned names, such as tag names, ids, and class names. Each distinct name is given a unique 32-bit id, so that selector
+    matching can compare and hash them as integers instead of strings.
+
+    The empty string, as well as any name that has never been inserted, maps to the invalid atom.
+ */
+enum class Atom : uint32_t { Invalid = 0 };
+using AtomList = Vector<Atom>;
+
+/**
+    Pseudo class names are numbered separately and densely from zero, so that an element's pseudo class state can be stored as a small bitset.
+ */
+enum class PseudoClassId : uint32_t { Invalid = 0 };
+using PseudoClassIdList = Vector<PseudoClassId>;
+
+namespace AtomTable {
+
+	void Initialize();
+	void Shutdown();
+
+	// Get the atom for the given name.
+	// If not found: Inserts a new atom.
+	Atom GetOrInsert(const String& name);
+	// Get the atom for the given name, or the invalid atom if the name has never been inserted.
+	Atom Get(const String& name);
+	// Get the name of the given atom.
+	const String& GetName(Atom atom);
+
+	// Get the pseudo class id for the given name.
+	// If not found: Inserts a new id.
+	PseudoClassId GetOrInsertPseudoClass(const String& name);
+	// Get the pseudo class id for the given name, or the invalid id if the name has never been inserted.
+	PseudoClassId GetPseudoClass(const String& name);
+	// Get the name of the given pseudo class id.
+	const String& GetPseudoClassName(PseudoClassId id);
+
+} // namespace AtomTable
+
+} // namespace Rml
+#endif
@@ -41,6 +41,12 @@ void CallbackTexture::Release()
 	}
 }
 
+void CallbackTexture::Update(Span<const byte> source, Rectanglei region) const
+{
+	if (resource_handle != StableVectorIndex::Invalid)
+		RenderManagerAccess::UpdateTexture(render_manager, resource_handle, source, region);
+}
+
 Rml::CallbackTexture::operator Texture() const
 {
 	return Texture(render_manager, resource_handle);
@@ -109,4 +115,10 @@ Texture CallbackTextureSource::GetTexture(RenderManager& render_manager) const
 	return Texture(texture);
 }
 
+void CallbackTextureSource::UpdateTexture(Span<const byte> source, Rectanglei region) const
+{
+	for (const auto& pair : textures)
+		pair.second.Update(source, region);
+}
+
 } // namespace Rml
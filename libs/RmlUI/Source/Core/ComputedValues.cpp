@@ -32,6 +32,12 @@
 
 namespace Rml {
 
+const Style::SharedValuesPtr& Style::ComputedValues::GetDefaultValues()
+{
+	static const SharedValuesPtr default_values = MakeShared<SharedValues>();
+	return default_values;
+}
+
 const AnimationList* Style::ComputedValues::animation() const
 {
 	if (auto p = element->GetLocalProperty(PropertyId::Animation))
@@ -70,7 +76,7 @@ String Style::ComputedValues::cursor() const
 
 float Style::ComputedValues::letter_spacing() const
 {
-	if (inherited.has_letter_spacing)
+	if (data->inherited.has_letter_spacing)
 	{
 		if (auto p = element->GetProperty(PropertyId::LetterSpacing))
 			return element->ResolveLength(p->GetNumericValue());
@@ -39,11 +39,16 @@
 #include "../../Include/RmlUi/Core/RenderManager.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "AnimationTimeline.h"
 #include "DataModel.h"
+#include "ElementMeta.h"
+#include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "PluginRegistry.h"
+#include "RenderCommandList.h"
 #include "ScrollController.h"
 #include "StreamFile.h"
+#include "ThreadPool.h"
 #include <algorithm>
 #include <clocale>
 #include <iterator>
@@ -123,6 +128,7 @@ Context::Context(const String& name, RenderManager* render_manager, TextInputHan
 	enable_cursor = true;
 
 	scroll_controller = MakeUnique<ScrollController>();
+	animation_timeline = MakeUnique<AnimationTimeline>();
 }
 
 Context::~Context()
@@ -151,6 +157,7 @@ void Context::SetDimensions(const Vector2i _dimensions)
 	{
 		dimensions = _dimensions;
 		render_manager->SetViewport(dimensions);
+		DirtyRenderCommands();
 		root->SetBox(Box(Vector2f(dimensions)));
 		root->DirtyLayout();
 
@@ -221,6 +228,13 @@ bool Context::Update()
 	root->dirty_definition = false;
 	root->dirty_child_definitions = false;
 
+	// Advance all running animations, their changes to the style are then resolved in the element update below.
+	if (animation_timeline->Advance())
+		RequestNextUpdate(0);
+
+	if (style_thread_pool)
+		ElementStyle::ResolveDefinitions(root.get(), *style_thread_pool);
+
 	root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
 
 	for (int i = 0; i < root->GetNumChildren(); ++i)
@@ -244,7 +258,12 @@ bool Context::Render()
 
 	render_manager->PrepareRender(dimensions);
 
-	root->Render();
+	if (!render_commands)
+		root->Render();
+	else if (render_commands->IsDirty(*render_manager))
+		render_commands->Record(*render_manager, root.get());
+	else
+		render_commands->Replay(*render_manager);
 
 	// Render the cursor proxy so that any attached drag clone will be rendered below the cursor.
 	if (drag_clone)
@@ -257,6 +276,9 @@ bool Context::Render()
 
 	render_manager->ResetState();
 
+	RMLUI_TracyPlot("Elements drawn", int64_t(render_manager->GetStatistics().elements_drawn));
+	RMLUI_TracyPlot("Elements culled", int64_t(render_manager->GetStatistics().elements_culled));
+
 	return true;
 }
 
@@ -546,7 +568,7 @@ void Context::RemoveEventListener(const String& event, EventListener* listener,
 bool Context::ProcessKeyDown(Input::KeyIdentifier key_identifier, int key_modifier_state)
 {
 	// Generate the parameters for the key event.
-	Dictionary parameters;
+	EventParameters parameters;
 	GenerateKeyEventParameters(parameters, key_identifier);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
 
@@ -559,7 +581,7 @@ bool Context::ProcessKeyDown(Input::KeyIdentifier key_identifier, int key_modifi
 bool Context::ProcessKeyUp(Input::KeyIdentifier key_identifier, int key_modifier_state)
 {
 	// Generate the parameters for the key event.
-	Dictionary parameters;
+	EventParameters parameters;
 	GenerateKeyEventParameters(parameters, key_identifier);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
 
@@ -605,7 +627,7 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 	mouse_active = true;
 
 	// Update the current hover chain. This will send all necessary 'onmouseout', 'onmouseover', 'ondragout' and 'ondragover' messages.
-	Dictionary parameters, drag_parameters;
+	EventParameters parameters, drag_parameters;
 	UpdateHoverChain(old_mouse_position, key_modifier_state, &parameters, &drag_parameters);
 
 	// Dispatch any 'onmousemove' events.
@@ -639,7 +661,7 @@ static Element* FindFocusElement(Element* element)
 
 bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 {
-	Dictionary parameters;
+	EventParameters parameters;
 	GenerateMouseEventParameters(parameters, button_index);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
 
@@ -728,10 +750,10 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 	}
 	else if (button_index == 2 && hover && propagate)
 	{
-		Dictionary scroll_parameters;
+		EventParameters scroll_parameters;
 		GenerateMouseEventParameters(scroll_parameters);
 		GenerateKeyModifierEventParameters(scroll_parameters, key_modifier_state);
-		scroll_parameters["autoscroll"] = true;
+		scroll_parameters.flags |= EventParameters::Autoscroll;
 
 		// Dispatch a mouse scroll event, this gives elements an opportunity to block autoscroll from being initialized.
 		if (hover->DispatchEvent(EventId::Mousescroll, scroll_parameters))
@@ -743,7 +765,7 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 
 bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 {
-	Dictionary parameters;
+	EventParameters parameters;
 	GenerateMouseEventParameters(parameters, button_index);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
 
@@ -776,7 +798,7 @@ bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 		{
 			if (drag_started)
 			{
-				Dictionary drag_parameters;
+				EventParameters drag_parameters;
 				GenerateMouseEventParameters(drag_parameters);
 				GenerateDragEventParameters(drag_parameters);
 				GenerateKeyModifierEventParameters(drag_parameters, key_modifier_state);
@@ -838,11 +860,11 @@ bool Context::ProcessMouseWheel(Vector2f wheel_delta, int key_modifier_state)
 		return true;
 	}
 
-	Dictionary scroll_parameters;
+	EventParameters scroll_parameters;
 	GenerateMouseEventParameters(scroll_parameters);
 	GenerateKeyModifierEventParameters(scroll_parameters, key_modifier_state);
-	scroll_parameters["wheel_delta_x"] = wheel_delta.x;
-	scroll_parameters["wheel_delta_y"] = wheel_delta.y;
+	scroll_parameters.flags |= EventParameters::Wheel;
+	scroll_parameters.wheel_delta = wheel_delta;
 
 	// Dispatch a mouse scroll event, this gives elements an opportunity to block scrolling from being performed.
 	if (!hover->DispatchEvent(EventId::Mousescroll, scroll_parameters))
@@ -880,6 +902,34 @@ void Context::SetDefaultScrollBehavior(ScrollBehavior scroll_behavior, float spe
 	scroll_controller->SetDefaultScrollBehavior(scroll_behavior, speed_factor);
 }
 
+void Context::SetStyleThreadCount(int num_threads)
+{
+	if (num_threads == GetStyleThreadCount())
+		return;
+
+	style_thread_pool.reset();
+	if (num_threads > 0)
+		style_thread_pool = MakeUnique<ThreadPool>(num_threads);
+}
+
+void Context::EnableRetainedRendering(bool enable)
+{
+	if (enable && !render_commands)
+		render_commands = MakeUnique<RenderCommandList>();
+	else if (!enable)
+		render_commands.reset();
+}
+
+bool Context::IsRetainedRenderingEnabled() const
+{
+	return render_commands != nullptr;
+}
+
+int Context::GetStyleThreadCount() const
+{
+	return style_thread_pool ? style_thread_pool->GetNumThreads() : 0;
+}
+
 RenderManager& Context::GetRenderManager()
 {
 	return *render_manager;
@@ -942,10 +992,14 @@ bool Context::RemoveDataModel(const String& name)
 
 void Context::OnElementDetach(Element* element)
 {
+	DirtyRenderCommands();
+
+	animation_timeline->Remove(element);
+
 	auto it_hover = hover_chain.find(element);
 	if (it_hover != hover_chain.end())
 	{
-		Dictionary parameters;
+		EventParameters parameters;
 		GenerateMouseEventParameters(parameters, -1);
 		element->DispatchEvent(EventId::Mouseout, parameters);
 
@@ -1005,6 +1059,18 @@ void Context::OnElementDetach(Element* element)
 		scroll_controller->Reset();
 }
 
+void Context::DirtyRenderCommands()
+{
+	if (render_commands)
+		render_commands->DirtyAll();
+}
+
+void Context::DirtyRenderCommands(Element* element)
+{
+	if (render_commands)
+		render_commands->DirtyElement(element);
+}
+
 bool Context::OnFocusChange(Element* new_focus, bool focus_visible)
 {
 	RMLUI_ASSERT(new_focus);
@@ -1080,19 +1146,20 @@ bool Context::OnFocusChange(Element* new_focus, bool focus_visible)
 
 void Context::GenerateClickEvent(Element* element)
 {
-	Dictionary parameters;
+	EventParameters parameters;
 	GenerateMouseEventParameters(parameters, 0);
 
 	element->DispatchEvent(EventId::Click, parameters);
 }
 
-void Context::UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_state, Dictionary* out_parameters, Dictionary* out_drag_parameters)
+void Context::UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_state, EventParameters* out_parameters,
+	EventParameters* out_drag_parameters)
 {
 	const Vector2f position(mouse_position);
 
-	Dictionary local_parameters, local_drag_parameters;
-	Dictionary& parameters = out_parameters ? *out_parameters : local_parameters;
-	Dictionary& drag_parameters = out_drag_parameters ? *out_drag_parameters : local_drag_parameters;
+	EventParameters local_parameters, local_drag_parameters;
+	EventParameters& parameters = out_parameters ? *out_parameters : local_parameters;
+	EventParameters& drag_parameters = out_drag_parameters ? *out_drag_parameters : local_drag_parameters;
 
 	// Generate the parameters for the mouse events (there could be a few!).
 	GenerateMouseEventParameters(parameters);
@@ -1109,9 +1176,8 @@ void Context::UpdateHoverChain(Vector2i old_mouse_position, int key_modifier_sta
 		{
 			if (!drag_started)
 			{
-				Dictionary drag_start_parameters = drag_parameters;
-				drag_start_parameters["mouse_x"] = old_mouse_position.x;
-				drag_start_parameters["mouse_y"] = old_mouse_position.y;
+				EventParameters drag_start_parameters = drag_parameters;
+				drag_start_parameters.mouse_position = old_mouse_position;
 				drag->DispatchEvent(EventId::Dragstart, drag_start_parameters);
 				drag_started = true;
 
@@ -1214,9 +1280,17 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 		if (element->stacking_context_dirty)
 			element->BuildLocalStackingContext();
 
-		for (int i = (int)element->stacking_context.size() - 1; i >= 0; --i)
+		// Only visit the children whose boxes may contain the point, the rest can't be hit.
+		UniquePtr<HitTestGrid>& hit_test_grid = element->meta->hit_test_grid;
+		if (!hit_test_grid)
+			hit_test_grid = MakeUnique<HitTestGrid>();
+
+		const Vector<int>* candidates = hit_test_grid->GetCandidates(element, point);
+		const int num_candidates = (candidates ? (int)candidates->size() : (int)element->stacking_context.size());
+
+		for (int i = num_candidates - 1; i >= 0; --i)
 		{
-			Element* stacking_child = element->stacking_context[i];
+			Element* stacking_child = element->stacking_context[candidates ? (*candidates)[i] : i];
 			if (ignore_element)
 			{
 				// Check if the element is a descendant of the element we're ignoring.
@@ -1334,31 +1408,33 @@ DataModel* Context::GetDataModelPtr(const String& name) const
 	return nullptr;
 }
 
-void Context::GenerateKeyEventParameters(Dictionary& parameters, Input::KeyIdentifier key_identifier)
+void Context::GenerateKeyEventParameters(EventParameters& parameters, Input::KeyIdentifier key_identifier)
 {
-	parameters["key_identifier"] = (int)key_identifier;
+	parameters.flags |= EventParameters::Key;
+	parameters.key_identifier = key_identifier;
 }
 
-void Context::GenerateMouseEventParameters(Dictionary& parameters, int button_index)
+void Context::GenerateMouseEventParameters(EventParameters& parameters, int button_index)
 {
-	parameters.reserve(3);
-	parameters["mouse_x"] = mouse_position.x;
-	parameters["mouse_y"] = mouse_position.y;
+	parameters.flags |= EventParameters::Mouse;
+	parameters.mouse_position = mouse_position;
 	if (button_index >= 0)
-		parameters["button"] = button_index;
+	{
+		parameters.flags |= EventParameters::Button;
+		parameters.button = button_index;
+	}
 }
 
-void Context::GenerateKeyModifierEventParameters(Dictionary& parameters, int key_modifier_state)
+void Context::GenerateKeyModifierEventParameters(EventParameters& parameters, int key_modifier_state)
 {
-	static const String property_names[] = {"ctrl_key", "shift_key", "alt_key", "meta_key", "caps_lock_key", "num_lock_key", "scroll_lock_key"};
-
-	for (int i = 0; i < 7; i++)
-		parameters[property_names[i]] = (int)((key_modifier_state & (1 << i)) > 0);
+	parameters.flags |= EventParameters::KeyModifiers;
+	parameters.key_modifier_state = key_modifier_state;
 }
 
-void Context::GenerateDragEventParameters(Dictionary& parameters)
+void Context::GenerateDragEventParameters(EventParameters& parameters)
 {
-	parameters["drag_element"] = (void*)drag;
+	parameters.flags |= EventParameters::Drag;
+	parameters.drag_element = drag;
 }
 
 void Context::ReleaseUnloadedDocuments()
@@ -1400,7 +1476,8 @@ private:
 	ElementObserverList* elements;
 };
 
-void Context::SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters)
+template <typename Parameters>
+void Context::SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Parameters& parameters)
 {
 	// We put our elements in observer pointers in case some of them are deleted during dispatch.
 	ElementObserverList elements;
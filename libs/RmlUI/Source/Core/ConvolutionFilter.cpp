@@ -67,12 +67,90 @@ float* ConvolutionFilter::operator[](int kernel_y_index)
 	return kernel.get() + kernel_size.x * kernel_y_index;
 }
 
+// Returns true if the kernel can be written as the outer product of a column and a row vector, in which case a two-dimensional
+// sum can be evaluated as a horizontal pass followed by a vertical pass.
+static bool SeparateKernel(const float* kernel, const Vector2i kernel_size, Vector<float>& out_row, Vector<float>& out_column)
+{
+	// Use the largest value as the pivot, for numerical stability.
+	int pivot = 0;
+	for (int i = 0; i < kernel_size.x * kernel_size.y; i++)
+	{
+		if (Math::Absolute(kernel[i]) > Math::Absolute(kernel[pivot]))
+			pivot = i;
+	}
+
+	const float pivot_value = kernel[pivot];
+	if (pivot_value == 0.f)
+		return false;
+
+	const int pivot_x = pivot % kernel_size.x;
+	const int pivot_y = pivot / kernel_size.x;
+
+	out_row.assign(kernel + pivot_y * kernel_size.x, kernel + (pivot_y + 1) * kernel_size.x);
+	out_column.resize(kernel_size.y);
+	for (int y = 0; y < kernel_size.y; y++)
+		out_column[y] = kernel[y * kernel_size.x + pivot_x] / pivot_value;
+
+	const float tolerance = 1e-5f * Math::Absolute(pivot_value);
+	for (int y = 0; y < kernel_size.y; y++)
+	{
+		for (int x = 0; x < kernel_size.x; x++)
+		{
+			if (Math::Absolute(kernel[y * kernel_size.x + x] - out_column[y] * out_row[x]) > tolerance)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+// Adds the weighted sum of the one-dimensional kernel applied along the given step to each output value.
+static void ConvolveSum(float* output, int output_width, const float* source, int source_step, const float* kernel, int kernel_length)
+{
+	for (int k = 0; k < kernel_length; k++)
+	{
+		const float weight = kernel[k];
+		if (weight == 0.f)
+			continue;
+
+		const float* source_row = source + k * source_step;
+		for (int x = 0; x < output_width; x++)
+			output[x] += weight * source_row[x];
+	}
+}
+
+// Sets each output value to the maximum of itself and the 'window' consecutive source values starting at the same index. Uses the van Herk/Gil-Werman
+// algorithm, which needs a constant number of comparisons per value regardless of the window size.
+static void RunningMax(float* output, int output_width, const float* source, int window, float* prefix_max, float* suffix_max)
+{
+	const int source_width = output_width + window - 1;
+
+	for (int block_begin = 0; block_begin < source_width; block_begin += window)
+	{
+		const int block_end = Math::Min(block_begin + window, source_width);
+
+		prefix_max[block_begin] = source[block_begin];
+		for (int i = block_begin + 1; i < block_end; i++)
+			prefix_max[i] = Math::Max(prefix_max[i - 1], source[i]);
+
+		suffix_max[block_end - 1] = source[block_end - 1];
+		for (int i = block_end - 2; i >= block_begin; i--)
+			suffix_max[i] = Math::Max(suffix_max[i + 1], source[i]);
+	}
+
+	for (int x = 0; x < output_width; x++)
+		output[x] = Math::Max(output[x], Math::Max(suffix_max[x], prefix_max[x + window - 1]));
+}
+
 void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimensions, const int destination_stride,
 	const ColorFormat destination_color_format, const byte* source, const Vector2i source_dimensions, const Vector2i source_offset,
 	const ColorFormat source_color_format) const
 {
 	RMLUI_ZoneScopedNC("ConvFilter::Run", 0xd6bf49);
 
+	if (destination_dimensions.x <= 0 || destination_dimensions.y <= 0)
+		return;
+
 	const int destination_bytes_per_pixel = (destination_color_format == ColorFormat::RGBA8 ? 4 : 1);
 	const int destination_alpha_offset = (destination_color_format == ColorFormat::RGBA8 ? 3 : 0);
 	const int source_bytes_per_pixel = (source_color_format == ColorFormat::RGBA8 ? 4 : 1);
@@ -80,39 +158,113 @@ void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimens
 
 	const Vector2i kernel_radius = (kernel_size - Vector2i(1)) / 2;
 
-	for (int y = 0; y < destination_dimensions.y; ++y)
+	// Copy the source opacity into a zero-padded buffer covering every value read by the kernel, so that the loops below need no bounds checks. The
+	// destination pixel (x, y) reads the padded values from (x, y) to (x, y) + kernel_size - 1.
+	const Vector2i padded_dimensions = destination_dimensions + kernel_size - Vector2i(1);
+	const Vector2i padded_offset = source_offset + kernel_radius;
+	Vector<float> padded(padded_dimensions.x * padded_dimensions.y, 0.f);
+
+	const int copy_begin_x = Math::Max(0, -padded_offset.x);
+	const int copy_end_x = Math::Min(source_dimensions.x, padded_dimensions.x - padded_offset.x);
+	const int copy_begin_y = Math::Max(0, -padded_offset.y);
+	const int copy_end_y = Math::Min(source_dimensions.y, padded_dimensions.y - padded_offset.y);
+	for (int source_y = copy_begin_y; source_y < copy_end_y; ++source_y)
+	{
+		const byte* source_row = source + source_y * source_dimensions.x * source_bytes_per_pixel + source_alpha_offset;
+		float* padded_row = padded.data() + (source_y + padded_offset.y) * padded_dimensions.x + padded_offset.x;
+		for (int source_x = copy_begin_x; source_x < copy_end_x; ++source_x)
+			padded_row[source_x] = float(source_row[source_x * source_bytes_per_pixel]);
+	}
+
+	const int width = destination_dimensions.x;
+	Vector<float> opacity(width * destination_dimensions.y, 0.f);
+
+	switch (operation)
 	{
-		for (int x = 0; x < destination_dimensions.x; ++x)
+	case FilterOperation::Sum:
+	{
+		Vector<float> kernel_row, kernel_column;
+		if (kernel_size.x > 1 && kernel_size.y > 1 && SeparateKernel(kernel.get(), kernel_size, kernel_row, kernel_column))
 		{
-			float opacity = 0.f;
+			// Horizontal pass over every padded row, followed by a vertical pass.
+			Vector<float> horizontal(width * padded_dimensions.y, 0.f);
+			for (int y = 0; y < padded_dimensions.y; ++y)
+				ConvolveSum(&horizontal[y * width], width, &padded[y * padded_dimensions.x], 1, kernel_row.data(), kernel_size.x);
 
-			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+			for (int y = 0; y < destination_dimensions.y; ++y)
+				ConvolveSum(&opacity[y * width], width, &horizontal[y * width], width, kernel_column.data(), kernel_size.y);
+		}
+		else
+		{
+			for (int y = 0; y < destination_dimensions.y; ++y)
 			{
-				const int source_y = y - source_offset.y - kernel_radius.y + kernel_y;
+				for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+				{
+					ConvolveSum(&opacity[y * width], width, &padded[(y + kernel_y) * padded_dimensions.x], 1, kernel.get() + kernel_y * kernel_size.x,
+						kernel_size.x);
+				}
+			}
+		}
+	}
+	break;
+	case FilterOperation::Dilation:
+	{
+		Vector<float> prefix_max(padded_dimensions.x), suffix_max(padded_dimensions.x);
 
-				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+		for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+		{
+			const float* kernel_row = kernel.get() + kernel_y * kernel_size.x;
+
+			// Find the longest span of unit weights in this row, whose maximum can be found with a running maximum. The remaining weights are
+			// applied one by one, these are typically the few anti-aliased values on the rim of a circular kernel.
+			int span_begin = 0, span_length = 0;
+			for (int kernel_x = 0; kernel_x < kernel_size.x;)
+			{
+				int kernel_x_end = kernel_x;
+				while (kernel_x_end < kernel_size.x && kernel_row[kernel_x_end] == 1.f)
+					++kernel_x_end;
+				if (kernel_x_end - kernel_x > span_length)
 				{
-					const int source_x = x - source_offset.x - kernel_radius.x + kernel_x;
-					if (source_y >= 0 && source_y < source_dimensions.y && source_x >= 0 && source_x < source_dimensions.x)
-					{
-						const int source_index = (source_y * source_dimensions.x + source_x) * source_bytes_per_pixel + source_alpha_offset;
-						const float pixel_opacity = float(source[source_index]) * kernel[kernel_y * kernel_size.x + kernel_x];
-
-						switch (operation)
-						{
-						case FilterOperation::Sum: opacity += pixel_opacity; break;
-						case FilterOperation::Dilation: opacity = Math::Max(opacity, pixel_opacity); break;
-						}
-					}
+					span_begin = kernel_x;
+					span_length = kernel_x_end - kernel_x;
 				}
+				kernel_x = kernel_x_end + 1;
 			}
+			constexpr int min_running_max_span = 3;
+			if (span_length < min_running_max_span)
+				span_length = 0;
+
+			for (int y = 0; y < destination_dimensions.y; ++y)
+			{
+				const float* padded_row = &padded[(y + kernel_y) * padded_dimensions.x];
+				float* opacity_row = &opacity[y * width];
+
+				if (span_length > 0)
+					RunningMax(opacity_row, width, padded_row + span_begin, span_length, prefix_max.data(), suffix_max.data());
 
-			opacity = Math::Min(255.f, opacity);
+				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+				{
+					const float weight = kernel_row[kernel_x];
+					if (weight == 0.f || (kernel_x >= span_begin && kernel_x < span_begin + span_length))
+						continue;
 
-			const int destination_index = y * destination_stride + x * destination_bytes_per_pixel + destination_alpha_offset;
-			destination[destination_index] = byte(opacity);
+					const float* source_row = padded_row + kernel_x;
+					for (int x = 0; x < width; ++x)
+						opacity_row[x] = Math::Max(opacity_row[x], weight * source_row[x]);
+				}
+			}
 		}
 	}
+	break;
+	}
+
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		const float* opacity_row = &opacity[y * width];
+		byte* destination_row = destination + y * destination_stride + destination_alpha_offset;
+		for (int x = 0; x < width; ++x)
+			destination_row[x * destination_bytes_per_pixel] = byte(Math::Min(255.f, opacity_row[x]));
+	}
 }
 
 } // namespace Rml
@@ -40,11 +40,13 @@
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/TextInputHandler.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "Atom.h"
 #include "ComputeProperty.h"
 #include "ControlledLifetimeResource.h"
 #include "ElementMeta.h"
 #include "EventSpecification.h"
 #include "FileInterfaceDefault.h"
+#include "GeometryBoxShadow.h"
 #include "Layout/LayoutPools.h"
 #include "PluginRegistry.h"
 #include "RenderManagerAccess.h"
@@ -54,6 +56,7 @@
 
 #ifdef RMLUI_FONT_ENGINE_FREETYPE
 	#include "FontEngineDefault/FontEngineInterfaceDefault.h"
+	#include "FontEngineDefault/FontProvider.h"
 #endif
 
 #ifdef RMLUI_LOTTIE_PLUGIN
@@ -112,6 +115,7 @@ bool Initialise()
 
 	InitializeMemoryPools();
 	InitializeComputeProperty();
+	GeometryBoxShadow::Initialize();
 
 	core_data.Initialize();
 
@@ -150,6 +154,7 @@ bool Initialise()
 		text_input_handler = core_data->default_text_input_handler.get();
 	}
 
+	AtomTable::Initialize();
 	EventSpecificationInterface::Initialize();
 
 	Detail::InitializeObserverPtrPool();
@@ -201,6 +206,8 @@ void Shutdown()
 
 	font_interface->Shutdown();
 
+	GeometryBoxShadow::Shutdown();
+
 	core_data->render_managers.clear();
 
 	Detail::ShutdownObserverPtrPool();
@@ -216,6 +223,7 @@ void Shutdown()
 	core_data.Shutdown();
 
 	EventSpecificationInterface::Shutdown();
+	AtomTable::Shutdown();
 
 	ShutdownComputeProperty();
 	ReleaseMemoryPools();
@@ -366,6 +374,22 @@ bool LoadFontFace(Span<const byte> data, const String& family, Style::FontStyle
 	return font_interface->LoadFontFace(data, face_index, family, style, weight, fallback_face);
 }
 
+void SetFontDistanceFieldGlyphs(bool enable)
+{
+#ifdef RMLUI_FONT_ENGINE_FREETYPE
+	if (enable == FontProvider::IsDistanceFieldGlyphsEnabled())
+		return;
+
+	FontProvider::SetDistanceFieldGlyphs(enable);
+
+	// Regenerate all font handles in the new mode.
+	if (initialised)
+		ReleaseFontResources();
+#else
+	(void)enable;
+#endif
+}
+
 void RegisterPlugin(Plugin* plugin)
 {
 	if (initialised)
@@ -89,6 +89,15 @@ enum class Instruction {
 	CastToInt       = 'I',     //       R = (int)R
 	Jump            = 'J',     //       Jumps to instruction index D
 	JumpIfZero      = 'Z',     //       If R is false, jumps to instruction index D
+
+	// Emitted by the compiler only, see DataCompiler.
+	MoveToL         = 'M',     //       L = R  (R is always overwritten by the following instruction)
+	AddNumbers      = 'a',     //       R = L + R  (Neither operand is a string)
+	AddStrings      = 's',     //       R = L + R  (At least one operand is a string)
+	EqualNumbers    = 'e',     //       R = L == R  (Neither operand is a string)
+	EqualStrings    = 'q',     //       R = L == R  (At least one operand is a string)
+	NotEqualNumbers = 'n',     //       R = L != R  (Neither operand is a string)
+	NotEqualStrings = 'x',     //       R = L != R  (At least one operand is a string)
 	// clang-format on
 };
 
@@ -920,12 +929,324 @@ static String DumpProgram(const Program& program)
 	return str;
 }
 
-class DataInterpreter {
+// Applies an operator instruction to the registers, storing the result in R. Returns false if the instruction is not an operator.
+static bool EvaluateOperator(const Instruction instruction, const Variant& L, Variant& R)
+{
+	auto AnyString = [](const Variant& v1, const Variant& v2) { return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING; };
+
+	switch (instruction)
+	{
+	case Instruction::Add:
+	{
+		if (AnyString(L, R))
+			R = Variant(L.Get<String>() + R.Get<String>());
+		else
+			R = Variant(L.Get<double>() + R.Get<double>());
+	}
+	break;
+	case Instruction::Equal:
+	{
+		if (AnyString(L, R))
+			R = Variant(L.Get<String>() == R.Get<String>());
+		else
+			R = Variant(L.Get<double>() == R.Get<double>());
+	}
+	break;
+	case Instruction::NotEqual:
+	{
+		if (AnyString(L, R))
+			R = Variant(L.Get<String>() != R.Get<String>());
+		else
+			R = Variant(L.Get<double>() != R.Get<double>());
+	}
+	break;
+		// clang-format off
+	case Instruction::AddNumbers:      R = Variant(L.Get<double>() + R.Get<double>());  break;
+	case Instruction::AddStrings:      R = Variant(L.Get<String>() + R.Get<String>());  break;
+	case Instruction::EqualNumbers:    R = Variant(L.Get<double>() == R.Get<double>()); break;
+	case Instruction::EqualStrings:    R = Variant(L.Get<String>() == R.Get<String>()); break;
+	case Instruction::NotEqualNumbers: R = Variant(L.Get<double>() != R.Get<double>()); break;
+	case Instruction::NotEqualStrings: R = Variant(L.Get<String>() != R.Get<String>()); break;
+	case Instruction::Subtract:        R = Variant(L.Get<double>() - R.Get<double>());  break;
+	case Instruction::Multiply:        R = Variant(L.Get<double>() * R.Get<double>());  break;
+	case Instruction::Divide:          R = Variant(L.Get<double>() / R.Get<double>());  break;
+	case Instruction::Not:             R = Variant(!R.Get<bool>());                     break;
+	case Instruction::And:             R = Variant(L.Get<bool>() && R.Get<bool>());     break;
+	case Instruction::Or:              R = Variant(L.Get<bool>() || R.Get<bool>());     break;
+	case Instruction::Less:            R = Variant(L.Get<double>() < R.Get<double>());  break;
+	case Instruction::LessEq:          R = Variant(L.Get<double>() <= R.Get<double>()); break;
+	case Instruction::Greater:         R = Variant(L.Get<double>() > R.Get<double>());  break;
+	case Instruction::GreaterEq:       R = Variant(L.Get<double>() >= R.Get<double>()); break;
+		// clang-format on
+	case Instruction::Push:
+	case Instruction::Pop:
+	case Instruction::Literal:
+	case Instruction::Variable:
+	case Instruction::NumArguments:
+	case Instruction::TransformFnc:
+	case Instruction::EventFnc:
+	case Instruction::Assign:
+	case Instruction::DynamicVariable:
+	case Instruction::CastToInt:
+	case Instruction::Jump:
+	case Instruction::JumpIfZero:
+	case Instruction::MoveToL: return false;
+	}
+	return true;
+}
+
+/*
+    Optimizes a parsed program and resolves its variable addresses.
+
+    The compiler runs the following passes:
+        1. Stack round-trips around a single literal or variable are replaced by a register move.
+        2. Operators and conditional jumps on literals are folded into their resulting literal or jump.
+        3. Add and (in)equality operators whose operand types are statically known are replaced by typed instructions.
+
+    Passes 1 and 2 are repeated until the program no longer changes. Finally, the root variable of each address is resolved
+    from the data model, so that the interpreter can read and write variables without looking up their names.
+*/
+class DataCompiler {
 public:
-	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface) :
+	DataCompiler(Program& program, const AddressList& addresses, DataExpressionInterface expression_interface) :
 		program(program), addresses(addresses), expression_interface(expression_interface)
 	{}
 
+	void Compile()
+	{
+		bool modified = true;
+		while (modified)
+		{
+			modified = false;
+			for (size_t i = 0; i < program.size(); i++)
+				modified |= (EliminateStack(i) || FoldConstants(i));
+		}
+
+		SelectTypedInstructions();
+
+		variables.clear();
+		variables.reserve(addresses.size());
+		for (const DataAddress& address : addresses)
+			variables.push_back(expression_interface.GetRootVariable(address));
+	}
+
+	VariableList ReleaseVariables() { return std::move(variables); }
+
+private:
+	enum class ValueType { Unknown, Number, String };
+
+	static bool IsJump(const InstructionData& data) { return data.instruction == Instruction::Jump || data.instruction == Instruction::JumpIfZero; }
+
+	bool IsJumpTarget(size_t index) const
+	{
+		for (const InstructionData& data : program)
+		{
+			if (IsJump(data) && data.data.Get<size_t>(0) == index)
+				return true;
+		}
+		return false;
+	}
+
+	// Replaces 'count' instructions starting at 'index'. Only the first of the replaced instructions may be the target of a jump.
+	bool Replace(size_t index, size_t count, Vector<InstructionData> replacement)
+	{
+		RMLUI_ASSERT(index + count <= program.size() && replacement.size() <= count);
+		for (size_t i = index + 1; i < index + count; i++)
+		{
+			if (IsJumpTarget(i))
+				return false;
+		}
+
+		const size_t num_removed = count - replacement.size();
+		auto RelocateJump = [&](InstructionData& data) {
+			if (!IsJump(data))
+				return;
+			const size_t target = data.data.Get<size_t>(0);
+			if (target > index)
+				data.data = Variant(uint64_t(target - num_removed));
+		};
+		for (InstructionData& data : program)
+			RelocateJump(data);
+		for (InstructionData& data : replacement)
+			RelocateJump(data);
+
+		program.erase(program.begin() + index, program.begin() + index + count);
+		program.insert(program.begin() + index, MakeMoveIterator(replacement.begin()), MakeMoveIterator(replacement.end()));
+		return true;
+	}
+
+	bool EliminateStack(size_t i)
+	{
+		if (i + 2 >= program.size() || program[i].instruction != Instruction::Push || program[i + 2].instruction != Instruction::Pop ||
+			Register(program[i + 2].data.Get<int>(-1)) != Register::L)
+			return false;
+
+		const Instruction load = program[i + 1].instruction;
+		if (load != Instruction::Literal && load != Instruction::Variable)
+			return false;
+
+		return Replace(i, 3, {InstructionData{Instruction::MoveToL, Variant()}, program[i + 1]});
+	}
+
+	bool FoldConstants(size_t i)
+	{
+		if (i + 1 >= program.size() || program[i].instruction != Instruction::Literal)
+			return false;
+
+		const Variant& literal = program[i].data;
+
+		if (i + 3 < program.size() && program[i + 1].instruction == Instruction::MoveToL && program[i + 2].instruction == Instruction::Literal)
+		{
+			Variant result = program[i + 2].data;
+			if (EvaluateOperator(program[i + 3].instruction, literal, result))
+				return Replace(i, 4, {InstructionData{Instruction::Literal, std::move(result)}});
+		}
+
+		switch (program[i + 1].instruction)
+		{
+		case Instruction::Not:
+		{
+			Variant result = literal;
+			EvaluateOperator(Instruction::Not, Variant(), result);
+			return Replace(i, 2, {InstructionData{Instruction::Literal, std::move(result)}});
+		}
+		case Instruction::CastToInt:
+		{
+			int result = 0;
+			if (literal.GetInto(result))
+				return Replace(i, 2, {InstructionData{Instruction::Literal, Variant(result)}});
+		}
+		break;
+		case Instruction::JumpIfZero:
+		{
+			// The literal stays in R when the jump is never taken, in case it is the result of the program.
+			if (literal.Get<bool>())
+				return Replace(i, 2, {program[i]});
+			return Replace(i, 2, {InstructionData{Instruction::Jump, program[i + 1].data}});
+		}
+		default: break;
+		}
+
+		return false;
+	}
+
+	void SelectTypedInstructions()
+	{
+		ValueType R = ValueType::Unknown;
+		ValueType L = ValueType::Unknown;
+		Vector<ValueType> stack;
+		int num_arguments = 0;
+
+		for (size_t i = 0; i < program.size(); i++)
+		{
+			// Values may arrive from several branches at jump targets.
+			if (IsJumpTarget(i))
+			{
+				R = L = ValueType::Unknown;
+				for (ValueType& type : stack)
+					type = ValueType::Unknown;
+			}
+
+			InstructionData& data = program[i];
+			auto SelectTyped = [&](Instruction numbers, Instruction strings) {
+				if (L == ValueType::String || R == ValueType::String)
+					data.instruction = strings;
+				else if (L == ValueType::Number && R == ValueType::Number)
+					data.instruction = numbers;
+			};
+
+			switch (data.instruction)
+			{
+			case Instruction::Push:
+			{
+				stack.push_back(R);
+				R = ValueType::Unknown;
+			}
+			break;
+			case Instruction::Pop:
+			{
+				const ValueType type = (stack.empty() ? ValueType::Unknown : stack.back());
+				if (!stack.empty())
+					stack.pop_back();
+				(Register(data.data.Get<int>(-1)) == Register::L ? L : R) = type;
+			}
+			break;
+			case Instruction::MoveToL: L = R; break;
+			case Instruction::Literal: R = (data.data.GetType() == Variant::STRING ? ValueType::String : ValueType::Number); break;
+			case Instruction::Add:
+			case Instruction::AddNumbers:
+			case Instruction::AddStrings:
+			{
+				SelectTyped(Instruction::AddNumbers, Instruction::AddStrings);
+				R = (data.instruction == Instruction::AddStrings ? ValueType::String
+						: data.instruction == Instruction::AddNumbers ? ValueType::Number
+																	  : ValueType::Unknown);
+			}
+			break;
+			case Instruction::Equal:
+			case Instruction::EqualNumbers:
+			case Instruction::EqualStrings:
+			{
+				SelectTyped(Instruction::EqualNumbers, Instruction::EqualStrings);
+				R = ValueType::Number;
+			}
+			break;
+			case Instruction::NotEqual:
+			case Instruction::NotEqualNumbers:
+			case Instruction::NotEqualStrings:
+			{
+				SelectTyped(Instruction::NotEqualNumbers, Instruction::NotEqualStrings);
+				R = ValueType::Number;
+			}
+			break;
+			case Instruction::NumArguments:
+			{
+				num_arguments = data.data.Get<int>(0);
+				R = ValueType::Number;
+			}
+			break;
+			case Instruction::TransformFnc:
+			case Instruction::EventFnc:
+			{
+				const size_t num_popped = size_t(num_arguments < 0 ? 0 : num_arguments);
+				stack.resize(stack.size() > num_popped ? stack.size() - num_popped : 0);
+				R = ValueType::Unknown;
+			}
+			break;
+			case Instruction::Subtract:
+			case Instruction::Multiply:
+			case Instruction::Divide:
+			case Instruction::Not:
+			case Instruction::And:
+			case Instruction::Or:
+			case Instruction::Less:
+			case Instruction::LessEq:
+			case Instruction::Greater:
+			case Instruction::GreaterEq:
+			case Instruction::CastToInt: R = ValueType::Number; break;
+			case Instruction::Variable:
+			case Instruction::DynamicVariable: R = ValueType::Unknown; break;
+			case Instruction::Assign:
+			case Instruction::Jump:
+			case Instruction::JumpIfZero: break;
+			}
+		}
+	}
+
+	Program& program;
+	const AddressList& addresses;
+	DataExpressionInterface expression_interface;
+
+	VariableList variables;
+};
+
+class DataInterpreter {
+public:
+	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface,
+		const VariableList* variables = nullptr) :
+		program(program), addresses(addresses), variables(variables), expression_interface(expression_interface)
+	{}
+
 	bool Error(const String& message) const
 	{
 		Log::Message(Log::LT_WARNING, "Error during execution. %s", message.c_str());
@@ -970,12 +1291,17 @@ private:
 
 	const Program& program;
 	const AddressList& addresses;
+	const VariableList* variables;
 	DataExpressionInterface expression_interface;
 
-	bool Execute(const Instruction instruction, const Variant& data, size_t& next_instruction)
+	// Returns the resolved root variable of the given address, if available from the compiler.
+	DataVariable RootVariable(size_t variable_index) const
 	{
-		auto AnyString = [](const Variant& v1, const Variant& v2) { return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING; };
+		return variables && variable_index < variables->size() ? (*variables)[variable_index] : DataVariable();
+	}
 
+	bool Execute(const Instruction instruction, const Variant& data, size_t& next_instruction)
+	{
 		switch (instruction)
 		{
 		case Instruction::Push:
@@ -993,8 +1319,8 @@ private:
 			switch (reg)
 			{
 				// clang-format off
-			case Register::R:  R = stack.back(); stack.pop_back(); break;
-			case Register::L:  L = stack.back(); stack.pop_back(); break;
+			case Register::R:  R = std::move(stack.back()); stack.pop_back(); break;
+			case Register::L:  L = std::move(stack.back()); stack.pop_back(); break;
 				// clang-format on
 			default: return Error(CreateString("Invalid register %d.", int(reg)));
 			}
@@ -1018,45 +1344,37 @@ private:
 		{
 			size_t variable_index = size_t(data.Get<int>(-1));
 			if (variable_index < addresses.size())
-				R = expression_interface.GetValue(addresses[variable_index]);
+				R = expression_interface.GetValue(addresses[variable_index], RootVariable(variable_index));
 			else
 				return Error("Variable address not found.");
 		}
 		break;
-		case Instruction::Add:
+		case Instruction::MoveToL:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() + R.Get<String>());
-			else
-				R = Variant(L.Get<double>() + R.Get<double>());
+			L = std::move(R);
 		}
 		break;
-			// clang-format off
-		case Instruction::Subtract:  R = Variant(L.Get<double>() - R.Get<double>());  break;
-		case Instruction::Multiply:  R = Variant(L.Get<double>() * R.Get<double>());  break;
-		case Instruction::Divide:    R = Variant(L.Get<double>() / R.Get<double>());  break;
-		case Instruction::Not:       R = Variant(!R.Get<bool>());                     break;
-		case Instruction::And:       R = Variant(L.Get<bool>() && R.Get<bool>());     break;
-		case Instruction::Or:        R = Variant(L.Get<bool>() || R.Get<bool>());     break;
-		case Instruction::Less:      R = Variant(L.Get<double>() < R.Get<double>());  break;
-		case Instruction::LessEq:    R = Variant(L.Get<double>() <= R.Get<double>()); break;
-		case Instruction::Greater:   R = Variant(L.Get<double>() > R.Get<double>());  break;
-		case Instruction::GreaterEq: R = Variant(L.Get<double>() >= R.Get<double>()); break;
-			// clang-format on
+		case Instruction::Add:
+		case Instruction::AddNumbers:
+		case Instruction::AddStrings:
+		case Instruction::Subtract:
+		case Instruction::Multiply:
+		case Instruction::Divide:
+		case Instruction::Not:
+		case Instruction::And:
+		case Instruction::Or:
+		case Instruction::Less:
+		case Instruction::LessEq:
+		case Instruction::Greater:
+		case Instruction::GreaterEq:
 		case Instruction::Equal:
-		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() == R.Get<String>());
-			else
-				R = Variant(L.Get<double>() == R.Get<double>());
-		}
-		break;
+		case Instruction::EqualNumbers:
+		case Instruction::EqualStrings:
 		case Instruction::NotEqual:
+		case Instruction::NotEqualNumbers:
+		case Instruction::NotEqualStrings:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() != R.Get<String>());
-			else
-				R = Variant(L.Get<double>() != R.Get<double>());
+			EvaluateOperator(instruction, L, R);
 		}
 		break;
 		case Instruction::NumArguments:
@@ -1095,7 +1413,7 @@ private:
 			size_t variable_index = size_t(data.Get<int>(-1));
 			if (variable_index < addresses.size())
 			{
-				if (!expression_interface.SetValue(addresses[variable_index], R))
+				if (!expression_interface.SetValue(addresses[variable_index], R, RootVariable(variable_index)))
 					return Error("Could not assign to variable.");
 			}
 			else
@@ -1156,12 +1474,23 @@ bool DataExpression::Parse(const DataExpressionInterface& expression_interface,
 	program = parser.ReleaseProgram();
 	addresses = parser.ReleaseAddresses();
 
+	DataCompiler compiler(program, addresses, expression_interface);
+	compiler.Compile();
+	variables = compiler.ReleaseVariables();
+
 	return true;
 }
 
 bool DataExpression::Run(const DataExpressionInterface& expression_interface, Variant& out_value)
 {
-	DataInterpreter interpreter(program, addresses, expression_interface);
+	// Constant expressions are folded into a single literal by the compiler.
+	if (program.size() == 1 && program[0].instruction == Instruction::Literal)
+	{
+		out_value = program[0].data;
+		return true;
+	}
+
+	DataInterpreter interpreter(program, addresses, expression_interface, &variables);
 
 	if (!interpreter.Run())
 		return false;
@@ -1182,6 +1511,16 @@ StringList DataExpression::GetVariableNameList() const
 	return list;
 }
 
+bool DataExpression::HasDirtyVariable(const DataModel& model) const
+{
+	for (const DataAddress& address : addresses)
+	{
+		if (!address.empty() && model.IsVariableDirty(address[0].name))
+			return true;
+	}
+	return false;
+}
+
 DataExpressionInterface::DataExpressionInterface(DataModel* data_model, Element* element, Event* event) :
 	data_model(data_model), element(element), event(event)
 {}
@@ -1193,10 +1532,34 @@ DataAddress DataExpressionInterface::ParseAddress(const String& address_str) con
 
 	return data_model ? data_model->ResolveAddress(address_str, element) : DataAddress();
 }
-Variant DataExpressionInterface::GetValue(const DataAddress& address) const
+
+static DataVariable GetChildVariable(DataVariable root_variable, const DataAddress& address)
+{
+	DataVariable variable = root_variable;
+	for (size_t i = 1; i < address.size() && variable; i++)
+		variable = variable.Child(address[i]);
+	return variable;
+}
+
+DataVariable DataExpressionInterface::GetRootVariable(const DataAddress& address) const
+{
+	// Event parameters are looked up on the event that is passed to each run.
+	if (!data_model || address.empty() || address.front().name == "ev")
+		return DataVariable();
+
+	return data_model->GetVariable(DataAddress{address.front()});
+}
+
+Variant DataExpressionInterface::GetValue(const DataAddress& address, DataVariable root_variable) const
 {
 	Variant result;
-	if (event && address.size() == 2 && address.front().name == "ev")
+	if (root_variable)
+	{
+		DataVariable variable = GetChildVariable(root_variable, address);
+		if (!variable || !variable.Get(result))
+			Log::Message(Log::LT_WARNING, "Could not get value from data variable '%s'.", address.front().name.c_str());
+	}
+	else if (event && address.size() == 2 && address.front().name == "ev")
 	{
 		auto& parameters = event->GetParameters();
 		auto it = parameters.find(address.back().name);
@@ -1210,12 +1573,12 @@ Variant DataExpressionInterface::GetValue(const DataAddress& address) const
 	return result;
 }
 
-bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant& value) const
+bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant& value, DataVariable root_variable) const
 {
 	bool result = false;
 	if (data_model && !address.empty())
 	{
-		if (DataVariable variable = data_model->GetVariable(address))
+		if (DataVariable variable = (root_variable ? GetChildVariable(root_variable, address) : data_model->GetVariable(address)))
 			result = variable.Set(value);
 
 		if (result)
@@ -30,6 +30,7 @@
 #define RMLUI_CORE_DATAEXPRESSION_H
 
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "../../Include/RmlUi/Core/DataVariable.h"
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
@@ -40,6 +41,7 @@ class DataModel;
 struct InstructionData;
 using Program = Vector<InstructionData>;
 using AddressList = Vector<DataAddress>;
+using VariableList = Vector<DataVariable>;
 
 class DataExpressionInterface {
 public:
@@ -47,8 +49,11 @@ public:
 	DataExpressionInterface(DataModel* data_model, Element* element, Event* event = nullptr);
 
 	DataAddress ParseAddress(const String& address_str) const;
-	Variant GetValue(const DataAddress& address) const;
-	bool SetValue(const DataAddress& address, const Variant& value) const;
+	// Returns the variable at the root of the address, or an invalid variable if the root must be looked up on every access.
+	DataVariable GetRootVariable(const DataAddress& address) const;
+	// When a valid root variable is given, the address is resolved from it instead of looking up its name in the data model.
+	Variant GetValue(const DataAddress& address, DataVariable root_variable = DataVariable()) const;
+	bool SetValue(const DataAddress& address, const Variant& value, DataVariable root_variable = DataVariable()) const;
 	bool CallTransform(const String& name, const VariantList& arguments, Variant& out_result);
 	bool EventCallback(const String& name, const VariantList& arguments);
 
@@ -70,11 +75,15 @@ public:
 	// Available after Parse()
 	StringList GetVariableNameList() const;
 
+	// Returns true if any of the referenced variables are dirty in the given model. Available after Parse().
+	bool HasDirtyVariable(const DataModel& model) const;
+
 private:
 	String expression;
 
 	Program program;
 	AddressList addresses;
+	VariableList variables;
 };
 
 } // namespace Rml
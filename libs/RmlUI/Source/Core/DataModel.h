@@ -70,6 +70,9 @@ public:
 	bool IsVariableDirty(const String& variable_name) const;
 	void DirtyAllVariables();
 
+	// Updates the view during the next update, even if none of its variables are dirty.
+	void DirtyView(DataView* view);
+
 	bool CallTransform(const String& name, const VariantList& arguments, Variant& out_result) const;
 
 	// Elements declaring 'data-model' need to be attached.
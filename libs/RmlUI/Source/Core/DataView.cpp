@@ -74,19 +74,44 @@ void DataViews::Add(DataViewPtr view)
 
 void DataViews::OnElementRemove(Element* element)
 {
-	for (auto it = views.begin(); it != views.end();)
+	auto range = element_view_map.equal_range(element);
+	if (range.first == range.second)
+		return;
+
+	for (auto it = range.first; it != range.second; ++it)
 	{
-		auto& view = *it;
-		if (view && view->GetElement() == element)
+		DataView* view = it->second;
+		RMLUI_ASSERT(view && view == views[view->views_index].get());
+
+		view->removed = true;
+		views_to_remove.push_back(std::move(views[view->views_index]));
+
+		// Swap with the last view to unlink in constant time.
+		if (view->views_index + 1 != views.size())
 		{
-			views_to_remove.push_back(std::move(view));
-			it = views.erase(it);
+			views[view->views_index] = std::move(views.back());
+			views[view->views_index]->views_index = view->views_index;
 		}
-		else
-			++it;
+		views.pop_back();
+	}
+
+	element_view_map.erase(range.first, range.second);
+
+	if (!dirty_views_next_update.empty())
+	{
+		auto it_remove =
+			std::remove_if(dirty_views_next_update.begin(), dirty_views_next_update.end(), [](DataView* view) { return view->removed; });
+		dirty_views_next_update.erase(it_remove, dirty_views_next_update.end());
 	}
 }
 
+void DataViews::DirtyView(DataView* view)
+{
+	RMLUI_ASSERT(view);
+	if (std::find(dirty_views_next_update.begin(), dirty_views_next_update.end(), view) == dirty_views_next_update.end())
+		dirty_views_next_update.push_back(view);
+}
+
 bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 {
 	bool result = false;
@@ -99,17 +124,40 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 	{
 		num_dirty_variables_prev = dirty_variables.size();
 
-		Vector<DataView*> dirty_views;
+		dirty_generation += 1;
+		DataViewList dirty_views;
+
+		auto AddDirtyView = [this, &dirty_views](DataView* view) {
+			if (view->dirty_generation != dirty_generation && !view->removed)
+			{
+				view->dirty_generation = dirty_generation;
+				dirty_views.push_back(view);
+			}
+		};
+
+		// Views dirtied during this update are deferred until the next one, so only pick them up on the first iteration.
+		if (i == 0 && !dirty_views_next_update.empty())
+		{
+			for (DataView* view : dirty_views_next_update)
+				AddDirtyView(view);
+			dirty_views_next_update.clear();
+		}
 
 		if (!views_to_add.empty())
 		{
 			views.reserve(views.size() + views_to_add.size());
 			for (auto&& view : views_to_add)
 			{
-				dirty_views.push_back(view.get());
-				for (const String& variable_name : view->GetVariableNameList())
-					name_view_map.emplace(variable_name, view.get());
+				AddDirtyView(view.get());
+
+				view->variable_names = view->GetVariableNameList();
+				for (const String& variable_name : view->variable_names)
+					name_view_map[variable_name].push_back(view.get());
+
+				if (Element* element = view->attached_element.get())
+					element_view_map.emplace(element, view.get());
 
+				view->views_index = views.size();
 				views.push_back(std::move(view));
 			}
 			views_to_add.clear();
@@ -117,16 +165,14 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 
 		for (const String& variable_name : dirty_variables)
 		{
-			auto pair = name_view_map.equal_range(variable_name);
-			for (auto it = pair.first; it != pair.second; ++it)
-				dirty_views.push_back(it->second);
+			auto it = name_view_map.find(variable_name);
+			if (it != name_view_map.end())
+			{
+				for (DataView* view : it->second)
+					AddDirtyView(view);
+			}
 		}
 
-		// Remove duplicate entries
-		std::sort(dirty_views.begin(), dirty_views.end());
-		auto it_remove = std::unique(dirty_views.begin(), dirty_views.end());
-		dirty_views.erase(it_remove, dirty_views.end());
-
 		// Sort by the element's depth in the document tree so that any structural changes due to a changed variable are reflected in the element's
 		// children. Eg. the 'data-for' view will remove children if any of its data variable array size is reduced.
 		std::sort(dirty_views.begin(), dirty_views.end(), [](auto&& left, auto&& right) { return left->GetSortOrder() < right->GetSortOrder(); });
@@ -137,23 +183,31 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 			if (!view)
 				continue;
 
-			if (view->IsValid())
+			// Views may be removed by the update of a view earlier in the list.
+			if (view->IsValid() && !view->removed)
 				result |= view->Update(model);
 		}
 
-		// Destroy views marked for destruction
-		// @performance: Horrible...
+		// Destroy views marked for destruction, erasing them once from each of their variable names.
 		if (!views_to_remove.empty())
 		{
+			SmallUnorderedSet<String> removed_variable_names;
 			for (const auto& view : views_to_remove)
 			{
-				for (auto it = name_view_map.begin(); it != name_view_map.end();)
-				{
-					if (it->second == view.get())
-						it = name_view_map.erase(it);
-					else
-						++it;
-				}
+				for (const String& variable_name : view->variable_names)
+					removed_variable_names.insert(variable_name);
+			}
+
+			for (const String& variable_name : removed_variable_names)
+			{
+				auto it = name_view_map.find(variable_name);
+				if (it == name_view_map.end())
+					continue;
+
+				DataViewList& name_views = it->second;
+				name_views.erase(std::remove_if(name_views.begin(), name_views.end(), [](DataView* view) { return view->removed; }), name_views.end());
+				if (name_views.empty())
+					name_view_map.erase(it);
 			}
 
 			views_to_remove.clear();
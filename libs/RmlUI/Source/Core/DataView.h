@@ -101,6 +101,13 @@ protected:
 private:
 	ObserverPtr<Element> attached_element;
 	int sort_order;
+
+	// Bookkeeping used by DataViews.
+	friend class DataViews;
+	StringList variable_names;
+	size_t views_index = 0;
+	uint64_t dirty_generation = 0;
+	bool removed = false;
 };
 
 class DataViews : NonCopyMoveable {
@@ -112,18 +119,32 @@ public:
 
 	void OnElementRemove(Element* element);
 
+	// Updates the view during the next call to Update(), independent of the dirty variables.
+	void DirtyView(DataView* view);
+
 	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
 
 private:
-	using DataViewList = Vector<DataViewPtr>;
+	using DataViewList = Vector<DataView*>;
+	using DataViewPtrList = Vector<DataViewPtr>;
 
-	DataViewList views;
+	// Each view knows its own index in this list, so that it can be unlinked in constant time.
+	DataViewPtrList views;
 
-	DataViewList views_to_add;
-	DataViewList views_to_remove;
+	DataViewPtrList views_to_add;
+	DataViewPtrList views_to_remove;
+	DataViewList dirty_views_next_update;
 
-	using NameViewMap = UnorderedMultimap<String, DataView*>;
+	// Views to update whenever the given variable name is dirty. Entries of removed views are erased in batches at the
+	// end of each update, only from the names they were registered with.
+	using NameViewMap = UnorderedMap<String, DataViewList>;
 	NameViewMap name_view_map;
+
+	using ElementViewMap = UnorderedMultimap<Element*, DataView*>;
+	ElementViewMap element_view_map;
+
+	// Incremented for every collection of dirty views, views stamped with the current generation are already collected.
+	uint64_t dirty_generation = 0;
 };
 
 } // namespace Rml
@@ -27,10 +27,13 @@
  */
 
 #include "DataViewDefault.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/DataVariable.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/Variant.h"
@@ -376,9 +379,15 @@ bool DataViewText::Update(DataModel& model)
 		for (DataEntry& entry : data_entries)
 		{
 			RMLUI_ASSERT(entry.data_expression);
+
+			// The view is dirty when any of its entries are, only re-evaluate the entries whose own variables changed.
+			if (entry.evaluated && !entry.data_expression->HasDirtyVariable(model))
+				continue;
+
 			Variant variant;
 			bool result = entry.data_expression->Run(expression_interface, variant);
 			const String value = variant.Get<String>();
+			entry.evaluated = result;
 			if (result && entry.value != value)
 			{
 				entry.value = value;
@@ -454,7 +463,22 @@ String DataViewText::BuildText() const
 
 DataViewFor::DataViewFor(Element* element) : DataView(element, 0) {}
 
-bool DataViewFor::Initialize(DataModel& model, Element* element, const String& in_expression, const String& /*modifier*/)
+DataViewFor::~DataViewFor()
+{
+	if (Element* container = scroll_container.get())
+		container->RemoveEventListener(EventId::Scroll, this);
+
+	for (ObserverPtr<Element>* spacer : {&spacer_before, &spacer_after})
+	{
+		if (Element* spacer_element = spacer->get())
+		{
+			if (Element* parent = spacer_element->GetParentNode())
+				parent->RemoveChild(spacer_element);
+		}
+	}
+}
+
+bool DataViewFor::Initialize(DataModel& model, Element* element, const String& in_expression, const String& modifier)
 {
 	StringList iterator_container_pair;
 	StringUtilities::ExpandString(iterator_container_pair, in_expression, ':');
@@ -499,6 +523,25 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 	if (container_address.empty())
 		return false;
 
+	if (modifier == "virtual")
+	{
+		Element* container = element->GetParentNode();
+		if (!container)
+		{
+			Log::Message(Log::LT_WARNING, "Virtualized data-for requires a parent scroll container: %s", element->GetAddress().c_str());
+			return false;
+		}
+
+		virtualized = true;
+		scroll_container = container->GetObserverPtr();
+		container->AddEventListener(EventId::Scroll, this);
+	}
+	else if (!modifier.empty())
+	{
+		Log::Message(Log::LT_WARNING, "Unknown modifier '%s' in data-for view on element %s", modifier.c_str(), element->GetAddress().c_str());
+		return false;
+	}
+
 	element->SetProperty(PropertyId::Display, Property(Style::Display::None));
 
 	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all
@@ -511,9 +554,10 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 		return false;
 	}
 	attributes.reserve(element_attributes.size() - num_data_for_attributes);
+	const auto& structural_attribute_names = Factory::GetStructuralDataViewAttributeNames();
 	for (const auto& attribute : element->GetAttributes())
 	{
-		if (attribute.first == "data-for" || attribute.first == "rmlui-inner-rml")
+		if (structural_attribute_names.find(attribute.first) != structural_attribute_names.end() || attribute.first == "rmlui-inner-rml")
 			continue;
 		attributes.emplace(attribute.first, attribute.second);
 	}
@@ -529,6 +573,10 @@ bool DataViewFor::Update(DataModel& model)
 
 	bool result = false;
 	const int size = variable.Size();
+
+	if (virtualized)
+		return UpdateVirtual(model, size);
+
 	const int num_elements = (int)elements.size();
 	Element* element = GetElement();
 
@@ -536,30 +584,12 @@ bool DataViewFor::Update(DataModel& model)
 	{
 		if (i >= num_elements)
 		{
-			ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
-
-			DataAddress iterator_address;
-			iterator_address.reserve(container_address.size() + 1);
-			iterator_address = container_address;
-			iterator_address.push_back(DataAddressEntry(i));
-
-			DataAddress iterator_index_address = {{"literal"}, {"int"}, {i}};
-
-			model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
-			model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
-
-			Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), element);
-			elements.push_back(new_element);
-
-			const String* rml_contents = RMLContents();
-			elements[i]->SetInnerRML(rml_contents ? *rml_contents : "");
-
+			elements.push_back(InsertRow(model, i, element));
 			RMLUI_ASSERT(i < (int)elements.size());
 		}
 		if (i >= size)
 		{
-			model.EraseAliases(elements[i]);
-			elements[i]->GetParentNode()->RemoveChild(elements[i]).reset();
+			RemoveRow(model, elements[i]);
 			elements[i] = nullptr;
 		}
 	}
@@ -570,12 +600,214 @@ bool DataViewFor::Update(DataModel& model)
 	return result;
 }
 
+bool DataViewFor::UpdateVirtual(DataModel& model, const int size)
+{
+	Element* element = GetElement();
+	Element* container = scroll_container.get();
+	if (!element || !container)
+		return false;
+
+	Element* parent = element->GetParentNode();
+	if (!spacer_before && !spacer_after && elements.empty())
+	{
+		for (ObserverPtr<Element>* spacer : {&spacer_before, &spacer_after})
+		{
+			ElementPtr spacer_ptr = Factory::InstanceElement(nullptr, "*", "#spacer", XMLAttributes());
+			spacer_ptr->SetProperty(PropertyId::Display, Property(Style::Display::Block));
+			*spacer = parent->InsertBefore(std::move(spacer_ptr), element)->GetObserverPtr();
+		}
+	}
+
+	// The spacers may have been removed together with other contents of the parent.
+	if (!spacer_before || !spacer_after)
+		return false;
+
+	// Measure the rows as they were placed during the last layout, spacing between rows accounts for collapsed margins.
+	const int num_elements = (int)elements.size();
+	const float previous_row_height = row_height;
+	float measured_row_height = 0.f;
+	if (num_elements >= 2)
+		measured_row_height = (elements.back()->GetAbsoluteOffset(BoxArea::Border).y - elements.front()->GetAbsoluteOffset(BoxArea::Border).y) /
+			float(num_elements - 1);
+	else if (num_elements == 1)
+		measured_row_height = elements.front()->GetBox().GetSize(BoxArea::Margin).y;
+	if (measured_row_height > 0.f)
+		row_height = measured_row_height;
+
+	// Until the rows have been laid out, instance a single row to measure.
+	constexpr int overscan_rows = 2;
+	int new_first_index = 0;
+	int new_num_elements = Math::Min(size, 1);
+
+	const float viewport_height = container->GetClientHeight();
+	if (row_height > 0.f && viewport_height > 0.f)
+	{
+		// Scroll position relative to the top of the list, which may be placed below other contents in the container.
+		const float list_scroll = container->GetAbsoluteOffset(BoxArea::Padding).y - spacer_before->GetAbsoluteOffset(BoxArea::Border).y;
+		new_first_index = Math::Clamp(int(list_scroll / row_height) - overscan_rows, 0, Math::Max(size - 1, 0));
+		new_num_elements = Math::Min(Math::RoundUpToInteger(viewport_height / row_height) + 1 + 2 * overscan_rows, size - new_first_index);
+	}
+
+	// Shift the window of rows, rows already bound to an index inside the new window are left untouched.
+	const int kept_begin = Math::Max(first_index, new_first_index);
+	const int kept_end = Math::Min(first_index + num_elements, new_first_index + new_num_elements);
+
+	if (kept_begin < kept_end)
+	{
+		// Rows that scrolled out of the window are moved to the other end, or removed if the window shrinks.
+		ElementList free_rows;
+		for (int i = 0; i < num_elements; i++)
+		{
+			if (first_index + i < kept_begin || first_index + i >= kept_end)
+				free_rows.push_back(elements[i]);
+		}
+
+		auto PlaceRow = [&](int index, Element* before) {
+			if (free_rows.empty())
+				return InsertRow(model, index, before);
+			Element* row = free_rows.back();
+			free_rows.pop_back();
+			MoveRow(model, row, index, before);
+			return row;
+		};
+
+		ElementList new_elements;
+		new_elements.reserve(new_num_elements);
+
+		Element* first_kept_row = elements[kept_begin - first_index];
+		for (int index = new_first_index; index < kept_begin; index++)
+			new_elements.push_back(PlaceRow(index, first_kept_row));
+
+		new_elements.insert(new_elements.end(), elements.begin() + (kept_begin - first_index), elements.begin() + (kept_end - first_index));
+
+		for (int index = kept_end; index < new_first_index + new_num_elements; index++)
+			new_elements.push_back(PlaceRow(index, spacer_after.get()));
+
+		for (Element* row : free_rows)
+			RemoveRow(model, row);
+
+		elements = std::move(new_elements);
+	}
+	else
+	{
+		// The window moved past all the existing rows, rebind them in place.
+		for (int i = new_num_elements; i < num_elements; i++)
+			RemoveRow(model, elements[i]);
+		elements.resize(Math::Min(num_elements, new_num_elements));
+
+		if (new_first_index != first_index)
+		{
+			for (int i = 0; i < (int)elements.size(); i++)
+				RebindRow(model, elements[i], new_first_index + i);
+		}
+
+		for (int i = (int)elements.size(); i < new_num_elements; i++)
+			elements.push_back(InsertRow(model, new_first_index + i, spacer_after.get()));
+	}
+
+	const int num_rows_after = size - new_first_index - new_num_elements;
+	spacer_before->SetProperty(PropertyId::Height, Property(float(new_first_index) * row_height, Unit::PX));
+	spacer_after->SetProperty(PropertyId::Height, Property(float(num_rows_after) * row_height, Unit::PX));
+
+	// Layout is needed to measure the rows and the scroll position, check again after the next layout whenever the rows change.
+	if (new_first_index != first_index || new_num_elements != num_elements || row_height != previous_row_height || row_height <= 0.f)
+	{
+		if (size > 0)
+		{
+			model.DirtyView(this);
+			if (Context* context = element->GetContext())
+				context->RequestNextUpdate(0);
+		}
+	}
+
+	first_index = new_first_index;
+
+	return false;
+}
+
+Element* DataViewFor::InsertRow(DataModel& model, int index, Element* before)
+{
+	Element* element = GetElement();
+	ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+
+	InsertAliases(model, new_element_ptr.get(), index);
+
+	Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), before);
+
+	InstanceContents(new_element);
+
+	return new_element;
+}
+
+void DataViewFor::InsertAliases(DataModel& model, Element* row, int index)
+{
+	DataAddress iterator_address;
+	iterator_address.reserve(container_address.size() + 1);
+	iterator_address = container_address;
+	iterator_address.push_back(DataAddressEntry(index));
+
+	DataAddress iterator_index_address = {{"literal"}, {"int"}, {index}};
+
+	model.InsertAlias(row, iterator_name, std::move(iterator_address));
+	model.InsertAlias(row, iterator_index_name, std::move(iterator_index_address));
+}
+
+void DataViewFor::RebindRow(DataModel& model, Element* row, int index)
+{
+	// Data views resolve their addresses during initialization, so they are reconstructed after changing the aliases.
+	// The row element itself is kept, while its contents are instanced again from the prototype.
+	model.OnElementRemove(row);
+	InsertAliases(model, row, index);
+	ElementUtilities::ApplyDataViewsControllers(row);
+
+	while (row->GetNumChildren() > 0)
+		row->RemoveChild(row->GetFirstChild());
+
+	InstanceContents(row);
+}
+
+void DataViewFor::MoveRow(DataModel& model, Element* row, int index, Element* before)
+{
+	// Detaching the row releases its aliases and data views, it is then bound to the new index like a newly inserted row.
+	Element* parent = row->GetParentNode();
+	ElementPtr row_ptr = parent->RemoveChild(row);
+
+	while (row->GetNumChildren() > 0)
+		row->RemoveChild(row->GetFirstChild());
+
+	InsertAliases(model, row, index);
+	parent->InsertBefore(std::move(row_ptr), before);
+
+	InstanceContents(row);
+}
+
+void DataViewFor::RemoveRow(DataModel& model, Element* row)
+{
+	model.EraseAliases(row);
+	row->GetParentNode()->RemoveChild(row).reset();
+}
+
 StringList DataViewFor::GetVariableNameList() const
 {
 	RMLUI_ASSERT(!container_address.empty());
 	return StringList{container_address.front().name};
 }
 
+void DataViewFor::ProcessEvent(Event& event)
+{
+	if (event.GetTargetElement() != scroll_container.get())
+		return;
+
+	// Rows can't be changed while the scroll event may be dispatched during layout, instead update them with the data model.
+	if (Element* element = GetElement())
+	{
+		if (DataModel* model = element->GetDataModel())
+			model->DirtyView(this);
+		if (Context* context = element->GetContext())
+			context->RequestNextUpdate(0);
+	}
+}
+
 void DataViewFor::Release()
 {
 	delete this;
@@ -599,6 +831,28 @@ const String* DataViewFor::RMLContents() const
 	return nullptr;
 }
 
+void DataViewFor::InstanceContents(Element* new_element)
+{
+	if (prototype_state == PrototypeState::Uncompiled)
+	{
+		const String* rml_contents = RMLContents();
+		if (!rml_contents)
+			return;
+		prototype_state = (prototype.Compile(GetElement(), *rml_contents) ? PrototypeState::Compiled : PrototypeState::Unsupported);
+	}
+
+	if (prototype_state == PrototypeState::Compiled)
+	{
+		prototype.Instance(new_element);
+	}
+	else
+	{
+		// Contents with custom node handlers need to go through the XML parser for every row.
+		const String* rml_contents = RMLContents();
+		new_element->SetInnerRML(rml_contents ? *rml_contents : "");
+	}
+}
+
 DataViewAlias::DataViewAlias(Element* element) : DataView(element, 0) {}
 
 StringList DataViewAlias::GetVariableNameList() const
@@ -29,10 +29,12 @@
 #ifndef RMLUI_CORE_DATAVIEWDEFAULT_H
 #define RMLUI_CORE_DATAVIEWDEFAULT_H
 
+#include "../../Include/RmlUi/Core/EventListener.h"
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataView.h"
+#include "ElementPrototype.h"
 
 namespace Rml {
 
@@ -144,15 +146,17 @@ private:
 		size_t index = 0; // Index into 'text'
 		DataExpressionPtr data_expression;
 		String value;
+		bool evaluated = false;
 	};
 
 	String text;
 	Vector<DataEntry> data_entries;
 };
 
-class DataViewFor final : public DataView {
+class DataViewFor final : public DataView, private EventListener {
 public:
 	DataViewFor(Element* element);
+	~DataViewFor();
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
@@ -161,17 +165,44 @@ public:
 	StringList GetVariableNameList() const override;
 
 protected:
+	// Schedules an update of the visible rows when a virtualized list is scrolled.
+	void ProcessEvent(Event& event) override;
+
 	void Release() override;
 
 private:
 	const String* RMLContents() const;
+	void InstanceContents(Element* new_element);
+
+	Element* InsertRow(DataModel& model, int index, Element* before);
+	void InsertAliases(DataModel& model, Element* row, int index);
+	void RebindRow(DataModel& model, Element* row, int index);
+	void MoveRow(DataModel& model, Element* row, int index, Element* before);
+	void RemoveRow(DataModel& model, Element* row);
+
+	bool UpdateVirtual(DataModel& model, int size);
 
 	DataAddress container_address;
 	String iterator_name;
 	String iterator_index_name;
 	ElementAttributes attributes;
 
+	// The contents of each row are parsed once and then instanced from the prototype.
+	enum class PrototypeState { Uncompiled, Compiled, Unsupported };
+	PrototypeState prototype_state = PrototypeState::Uncompiled;
+	ElementPrototype prototype;
+
 	ElementList elements;
+
+	// With the 'virtual' modifier, only the rows visible in the parent scroll container are instanced. The rows are
+	// recycled as the container scrolls, while spacers above and below them stand in for the remaining rows.
+	bool virtualized = false;
+	ObserverPtr<Element> scroll_container;
+	ObserverPtr<Element> spacer_before;
+	ObserverPtr<Element> spacer_after;
+	// Index of the row in the first element.
+	int first_index = 0;
+	float row_height = 0.f;
 };
 
 class DataViewAlias final : public DataView {
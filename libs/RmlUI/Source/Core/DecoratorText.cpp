@@ -76,8 +76,13 @@ void DecoratorText::RenderElement(Element* element, DecoratorDataHandle element_
 
 	const Vector2f translation = element->GetAbsoluteOffset(BoxArea::Border);
 
-	for (size_t i = 0; i < data->textured_geometry.size(); ++i)
-		data->textured_geometry[i].geometry.Render(translation, data->textured_geometry[i].texture);
+	for (const TexturedGeometry& textured_geometry : data->textured_geometry)
+	{
+		if (textured_geometry.shader)
+			textured_geometry.geometry.Render(translation, textured_geometry.texture, *textured_geometry.shader);
+		else
+			textured_geometry.geometry.Render(translation, textured_geometry.texture);
+	}
 }
 
 bool DecoratorText::GenerateGeometry(Element* element, ElementData& element_data) const
@@ -120,6 +125,7 @@ bool DecoratorText::GenerateGeometry(Element* element, ElementData& element_data
 	{
 		textured_geometry[i].geometry = render_manager.MakeGeometry(std::move(mesh_list[i].mesh));
 		textured_geometry[i].texture = mesh_list[i].texture;
+		textured_geometry[i].shader = mesh_list[i].shader;
 	}
 
 	element_data = ElementData{
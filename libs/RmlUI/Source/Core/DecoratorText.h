@@ -52,6 +52,7 @@ private:
 	struct TexturedGeometry {
 		Geometry geometry;
 		Texture texture;
+		const CompiledShader* shader = nullptr;
 	};
 	struct ElementData {
 		BoxArea paint_area;
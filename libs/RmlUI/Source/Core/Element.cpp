@@ -43,6 +43,8 @@
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include "AncestorFilter.h"
+#include "AnimationTimeline.h"
 #include "Clock.h"
 #include "ComputeProperty.h"
 #include "DataModel.h"
@@ -54,12 +56,16 @@
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
+#include "Layout/LayoutCache.h"
 #include "Layout/LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "Pool.h"
 #include "PropertiesIterator.h"
+#include "RenderCommandList.h"
+#include "RenderManagerAccess.h"
 #include "StyleSheetNode.h"
 #include "StyleSheetParser.h"
+#include "StyleSharingCache.h"
 #include "TransformState.h"
 #include "TransformUtilities.h"
 #include "XMLParseTools.h"
@@ -92,10 +98,40 @@ static float GetScrollOffsetDelta(ScrollAlignment alignment, float begin_offset,
 	return 0.f;
 }
 
+// Returns true if the element's own geometry is located entirely outside the active scissor region or viewport.
+static bool IsOutsideRenderRegion(Element* element, const ElementEffects& effects, const RenderManager& render_manager)
+{
+	// For simplicity, we only cull elements that are fully described by a single box. Elements without any area, such
+	// as text, are responsible for their own culling. Transformed elements and filters with ink overflow may draw
+	// elsewhere, so they are always rendered.
+	if (element->GetNumBoxes() != 1 || effects.HasFilters())
+		return false;
+
+	const Vector2f size = element->GetBox().GetSize(BoxArea::Border);
+	if (size.x <= 0.f || size.y <= 0.f)
+		return false;
+
+	const TransformState* transform_state = element->GetTransformState();
+	if (transform_state && transform_state->GetTransform())
+		return false;
+
+	Rectanglef bounds;
+	if (!ElementUtilities::GetBoundingBox(bounds, element, BoxArea::Auto))
+		return false;
+	Math::ExpandToPixelGrid(bounds);
+
+	Rectanglei render_region = render_manager.GetScissorRegion();
+	if (!render_region.Valid())
+		render_region = Rectanglei::FromSize(render_manager.GetViewport());
+
+	return !render_region.Intersects(Rectanglei(bounds));
+}
+
 Element::Element(const String& tag) :
 	local_stacking_context(false), local_stacking_context_forced(false), stacking_context_dirty(false), computed_values_are_default_initialized(true),
 	visible(true), offset_fixed(false), absolute_offset_dirty(true), rounded_main_padding_size_dirty(true), dirty_definition(false),
-	dirty_child_definitions(false), dirty_animation(false), dirty_transition(false), dirty_transform(false), dirty_perspective(false), tag(tag),
+	dirty_child_definitions(false), dirty_animation(false), dirty_transition(false), dirty_transform(false), dirty_perspective(false), update_dirty(true),
+	tag(tag),
 	relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0)
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
@@ -113,6 +149,8 @@ Element::Element(const String& tag) :
 
 	z_index = 0;
 
+	animation_timeline_index = -1;
+
 	meta = ElementMetaPool::element_meta_pool->pool.AllocateAndConstruct(this);
 	data_model = nullptr;
 }
@@ -141,6 +179,11 @@ Element::~Element()
 
 void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 {
+	// Skip the whole subtree when nothing in it has any pending work.
+	if (!update_dirty)
+		return;
+	update_dirty = false;
+
 #ifdef RMLUI_TRACY_PROFILING
 	auto name = GetAddress(false, false);
 	RMLUI_ZoneScoped;
@@ -151,7 +194,6 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 
 	HandleTransitionProperty();
 	HandleAnimationProperty();
-	AdvanceAnimations();
 
 	meta->scroll.Update();
 
@@ -167,14 +209,28 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 
 	meta->effects.InstanceEffects();
 
+	// Add ourself to the ancestor filter while updating our children, so that they can quickly rule out descendant selectors.
+	AncestorFilter* ancestor_filter = (owner_document ? owner_document->ancestor_filter.get() : nullptr);
+	const bool outermost_ancestor = (ancestor_filter && ancestor_filter->IsEmpty());
+	if (outermost_ancestor)
+		ancestor_filter->SetAncestorsOf(this);
+	if (ancestor_filter && ancestor_filter->IsValidFor(this))
+		ancestor_filter->Push(this);
+	else
+		ancestor_filter = nullptr;
+
 	for (size_t i = 0; i < children.size(); i++)
 		children[i]->Update(dp_ratio, vp_dimensions);
 
-	if (!animations.empty() && IsVisible(true))
+	if (ancestor_filter)
 	{
-		if (Context* ctx = GetContext())
-			ctx->RequestNextUpdate(0);
+		ancestor_filter->Pop(this);
+		if (outermost_ancestor)
+			ancestor_filter->Clear();
 	}
+
+	// Animations are advanced by the context's animation timeline, before the element tree is updated.
+	ScheduleAnimations();
 }
 
 void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimensions)
@@ -186,9 +242,11 @@ void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimension
 		const ComputedValues* parent_values = parent ? &parent->GetComputedValues() : nullptr;
 		const ComputedValues* document_values = owner_document ? &owner_document->GetComputedValues() : nullptr;
 
+		StyleSharingCache* sharing_cache = owner_document ? owner_document->style_sharing_cache.get() : nullptr;
+
 		// Compute values and clear dirty properties
 		PropertyIdSet dirty_properties = meta->style.ComputeValues(meta->computed_values, parent_values, document_values,
-			computed_values_are_default_initialized, dp_ratio, vp_dimensions);
+			computed_values_are_default_initialized, dp_ratio, vp_dimensions, sharing_cache);
 
 		computed_values_are_default_initialized = false;
 
@@ -220,16 +278,29 @@ void Element::Render()
 
 	meta->effects.RenderEffects(RenderStage::Enter);
 
-	// Set up the clipping region for this element.
+	// Set up the clipping region for this element, and skip our own geometry if it is clipped away. Our stacking
+	// context is still rendered, since its elements may be located elsewhere.
 	if (ElementUtilities::SetClippingRegion(this))
 	{
-		meta->background_border.Render(this);
-		meta->effects.RenderEffects(RenderStage::Decoration);
+		RenderManager* render_manager = GetRenderManager();
+		RenderStatistics& statistics = RenderManagerAccess::GetStatistics(render_manager);
 
+		if (IsOutsideRenderRegion(this, meta->effects, *render_manager))
+		{
+			statistics.elements_culled += 1;
+		}
+		else
 		{
-			RMLUI_ZoneScopedNC("OnRender", 0x228B22);
+			statistics.elements_drawn += 1;
+
+			RenderCommandList* command_list = RenderManagerAccess::GetCommandList(render_manager);
+			if (command_list)
+				command_list->BeginElement(this);
+
+			RenderSelf();
 
-			OnRender();
+			if (command_list)
+				command_list->EndElement(*render_manager);
 		}
 	}
 
@@ -240,6 +311,18 @@ void Element::Render()
 	meta->effects.RenderEffects(RenderStage::Exit);
 }
 
+void Element::RenderSelf()
+{
+	meta->background_border.Render(this);
+	meta->effects.RenderEffects(RenderStage::Decoration);
+
+	{
+		RMLUI_ZoneScopedNC("OnRender", 0x228B22);
+
+		OnRender();
+	}
+}
+
 ElementPtr Element::Clone() const
 {
 	ElementPtr clone;
@@ -327,11 +410,10 @@ String Element::GetAddress(bool include_pseudo_classes, bool include_parents) co
 
 	if (include_pseudo_classes)
 	{
-		const PseudoClassMap& pseudo_classes = meta->style.GetActivePseudoClasses();
-		for (auto& pseudo_class : pseudo_classes)
+		for (const String& pseudo_class : meta->style.GetActivePseudoClasses())
 		{
 			address += ":";
-			address += pseudo_class.first;
+			address += pseudo_class;
 		}
 	}
 
@@ -462,6 +544,7 @@ void Element::SetBox(const Box& box)
 
 		main_box = box;
 		additional_boxes.clear();
+		DirtyGeometry();
 
 		OnResize();
 		rounded_main_padding_size_dirty = true;
@@ -474,6 +557,7 @@ void Element::SetBox(const Box& box)
 void Element::AddBox(const Box& box, Vector2f offset)
 {
 	additional_boxes.emplace_back(PositionedBox{box, offset});
+	DirtyGeometry();
 	OnResize();
 	meta->background_border.DirtyBackground();
 	meta->background_border.DirtyBorder();
@@ -818,15 +902,7 @@ bool Element::ArePseudoClassesSet(const StringList& pseudo_classes) const
 
 StringList Element::GetActivePseudoClasses() const
 {
-	const PseudoClassMap& pseudo_classes = meta->style.GetActivePseudoClasses();
-	StringList names;
-	names.reserve(pseudo_classes.size());
-	for (auto& pseudo_class : pseudo_classes)
-	{
-		names.push_back(pseudo_class.first);
-	}
-
-	return names;
+	return meta->style.GetActivePseudoClasses();
 }
 
 void Element::OverridePseudoClass(Element* element, const String& pseudo_class, bool activate)
@@ -888,6 +964,19 @@ Context* Element::GetContext() const
 	return nullptr;
 }
 
+void Element::DirtyRender()
+{
+	if (Context* context = GetContext())
+		context->DirtyRenderCommands(this);
+}
+
+void Element::RequestUpdate()
+{
+	// Any ancestor already flagged implies that all of its own ancestors are flagged as well.
+	for (Element* element = this; element && !element->update_dirty; element = element->parent)
+		element->update_dirty = true;
+}
+
 RenderManager* Element::GetRenderManager() const
 {
 	if (Context* context = GetContext())
@@ -1262,6 +1351,13 @@ bool Element::DispatchEvent(EventId id, const Dictionary& parameters)
 		specification.default_action_phase);
 }
 
+bool Element::DispatchEvent(EventId id, const EventParameters& parameters)
+{
+	const EventSpecification& specification = EventSpecificationInterface::Get(id);
+	return EventDispatcher::DispatchEvent(this, specification.id, specification.type, parameters, specification.interruptible, specification.bubbles,
+		specification.default_action_phase);
+}
+
 void Element::ScrollIntoView(const ScrollIntoViewOptions options)
 {
 	const Vector2f size = main_box.GetSize(BoxArea::Border);
@@ -1350,8 +1446,9 @@ Element* Element::AppendChild(ElementPtr child, bool dom_element)
 	// children's. This ensures correct styles being applied in the presence of tree-structural selectors such as ':first-child'.
 	DirtyDefinition(DirtyNodes::Self);
 
+	// Only our contents changed, this allows relayout boundaries to be formatted on their own.
 	if (dom_element)
-		DirtyLayout();
+		LayoutCache::DirtyLayout(this, true);
 
 	return child_ptr;
 }
@@ -1385,7 +1482,7 @@ Element* Element::InsertBefore(ElementPtr child, Element* adjacent_element)
 		if ((int)child_index >= GetNumChildren())
 			num_non_dom_children++;
 		else
-			DirtyLayout();
+			LayoutCache::DirtyLayout(this, true);
 
 		children.insert(children.begin() + child_index, std::move(child));
 		child_ptr->SetParent(this);
@@ -1478,7 +1575,7 @@ ElementPtr Element::RemoveChild(Element* child)
 
 			detached_child->SetParent(nullptr);
 
-			DirtyLayout();
+			LayoutCache::DirtyLayout(this, true);
 			DirtyStackingContext();
 			DirtyDefinition(DirtyNodes::Self);
 
@@ -1696,6 +1793,7 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 		if (attribute == "id")
 		{
 			id = value.Get<String>();
+			meta->style.SetId(id);
 		}
 		else if (attribute == "class")
 		{
@@ -1781,6 +1879,9 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 	// Any change to the attributes may affect which styles apply to the current element, in particular due to attribute selectors, ID selectors, and
 	// class selectors. This can further affect all siblings or descendants due to sibling or descendant combinators.
 	DirtyDefinition(DirtyNodes::SelfAndSiblings);
+
+	// Elements may also render their contents based on their attributes.
+	DirtyRender();
 }
 
 void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
@@ -1793,33 +1894,30 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::Left)      //
 	);
 
-	// See if the document layout needs to be updated.
-	if (!IsLayoutDirty())
-	{
-		// Force a relayout if any of the changed properties require it.
-		const PropertyIdSet changed_properties_forcing_layout =
-			(changed_properties & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
+	// Force a relayout if any of the changed properties require it. Layout changes are tracked per element, so this
+	// applies even if the document layout is already dirty.
+	const PropertyIdSet changed_properties_forcing_layout =
+		(changed_properties & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
 
-		if (!changed_properties_forcing_layout.Empty())
-		{
+	if (!changed_properties_forcing_layout.Empty())
+	{
+		DirtyLayout();
+	}
+	else if (top_right_bottom_left_changed)
+	{
+		// Normally, the position properties only affect the position of the element and not the layout. Thus, these properties are not registered
+		// as affecting layout. However, when absolutely positioned elements with both left & right, or top & bottom are set to definite values,
+		// they affect the size of the element and thereby also the layout. This layout-dirtying condition needs to be registered manually.
+		using namespace Style;
+		const ComputedValues& computed = GetComputedValues();
+		const bool absolutely_positioned = (computed.position() == Position::Absolute || computed.position() == Position::Fixed);
+		const bool sized_width =
+			(computed.width().type == Width::Auto && computed.left().type != Left::Auto && computed.right().type != Right::Auto);
+		const bool sized_height =
+			(computed.height().type == Height::Auto && computed.top().type != Top::Auto && computed.bottom().type != Bottom::Auto);
+
+		if (absolutely_positioned && (sized_width || sized_height))
 			DirtyLayout();
-		}
-		else if (top_right_bottom_left_changed)
-		{
-			// Normally, the position properties only affect the position of the element and not the layout. Thus, these properties are not registered
-			// as affecting layout. However, when absolutely positioned elements with both left & right, or top & bottom are set to definite values,
-			// they affect the size of the element and thereby also the layout. This layout-dirtying condition needs to be registered manually.
-			using namespace Style;
-			const ComputedValues& computed = GetComputedValues();
-			const bool absolutely_positioned = (computed.position() == Position::Absolute || computed.position() == Position::Fixed);
-			const bool sized_width =
-				(computed.width().type == Width::Auto && computed.left().type != Left::Auto && computed.right().type != Right::Auto);
-			const bool sized_height =
-				(computed.height().type == Height::Auto && computed.top().type != Top::Auto && computed.bottom().type != Bottom::Auto);
-
-			if (absolutely_positioned && (sized_width || sized_height))
-				DirtyLayout();
-		}
 	}
 
 	// Update the position.
@@ -1950,7 +2048,27 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	if (changed_properties.Contains(PropertyId::Transition))
 	{
 		dirty_transition = true;
+		RequestUpdate();
 	}
+
+	// Changing only the colors of this element can be handled by rendering it again, while replaying the commands of all other elements. Filters
+	// are compiled again when the opacity changes, however, and the resulting commands may be shared with descendants.
+	static const PropertyIdSet paint_properties = [] {
+		PropertyIdSet set;
+		for (PropertyId id : {PropertyId::Color, PropertyId::BackgroundColor, PropertyId::BorderTopColor, PropertyId::BorderRightColor,
+				 PropertyId::BorderBottomColor, PropertyId::BorderLeftColor, PropertyId::ImageColor, PropertyId::Opacity, PropertyId::Cursor,
+				 PropertyId::Drag, PropertyId::TabIndex, PropertyId::Focus, PropertyId::PointerEvents, PropertyId::NavUp, PropertyId::NavRight,
+				 PropertyId::NavDown, PropertyId::NavLeft, PropertyId::Transition, PropertyId::Animation})
+			set.Insert(id);
+		return set;
+	}();
+
+	const auto& computed = meta->computed_values;
+	const bool has_filters = (computed.has_filter() || computed.has_backdrop_filter() || computed.has_mask_image());
+	if ((changed_properties & paint_properties).Size() == changed_properties.Size() && !has_filters)
+		DirtyRender();
+	else
+		DirtyRenderCommands();
 }
 
 void Element::OnPseudoClassChange(const String& /*pseudo_class*/, bool /*activate*/) {}
@@ -1961,8 +2079,7 @@ void Element::OnChildRemove(Element* /*child*/) {}
 
 void Element::DirtyLayout()
 {
-	if (Element* document = GetOwnerDocument())
-		document->DirtyLayout();
+	LayoutCache::DirtyLayout(this);
 }
 
 bool Element::IsLayoutDirty()
@@ -1996,9 +2113,8 @@ void Element::ProcessDefaultAction(Event& event)
 {
 	if (event == EventId::Mousedown)
 	{
-		const Vector2f mouse_pos(event.GetParameter("mouse_x", 0.f), event.GetParameter("mouse_y", 0.f));
-
-		if (IsPointWithinElement(mouse_pos) && event.GetParameter("button", 0) == 0)
+		// Treat events without a button as the primary button.
+		if (IsPointWithinElement(event.GetMousePosition()) && event.GetMouseButton() <= 0)
 			SetPseudoClass("active", true);
 	}
 
@@ -2147,6 +2263,9 @@ void Element::SetParent(Element* _parent)
 		// We need to update our definition and make sure we inherit the properties of our new parent.
 		DirtyDefinition(DirtyNodes::Self);
 		meta->style.DirtyInheritedProperties();
+
+		// Our update flag may have been set before we were attached, make sure our new ancestors are flagged as well.
+		parent->RequestUpdate();
 	}
 
 	// The transform state may require recalculation.
@@ -2193,6 +2312,7 @@ void Element::DirtyAbsoluteOffsetRecursive()
 	if (!absolute_offset_dirty)
 	{
 		absolute_offset_dirty = true;
+		DirtyGeometry();
 
 		if (transform_state)
 			DirtyTransformState(true, true);
@@ -2202,6 +2322,21 @@ void Element::DirtyAbsoluteOffsetRecursive()
 		children[i]->DirtyAbsoluteOffsetRecursive();
 }
 
+void Element::DirtyGeometry()
+{
+	if (owner_document)
+	{
+		owner_document->geometry_generation += 1;
+		DirtyRenderCommands();
+	}
+}
+
+void Element::DirtyRenderCommands()
+{
+	if (Context* context = GetContext())
+		context->DirtyRenderCommands();
+}
+
 void Element::UpdateOffset()
 {
 	using namespace Style;
@@ -2325,6 +2460,9 @@ void Element::BuildLocalStackingContext()
 {
 	stacking_context_dirty = false;
 
+	if (meta->hit_test_grid)
+		meta->hit_test_grid->DirtyStackingContext();
+
 	Vector<StackingContextChild> stacking_children;
 	AddChildrenToStackingContext(stacking_children);
 	std::stable_sort(stacking_children.begin(), stacking_children.end());
@@ -2452,19 +2590,28 @@ void Element::DirtyStackingContext()
 
 	if (stacking_context_parent)
 		stacking_context_parent->stacking_context_dirty = true;
+
+	DirtyRenderCommands();
 }
 
 void Element::DirtyDefinition(DirtyNodes dirty_nodes)
 {
+	ElementStyle::InvalidateResolvedDefinitions();
+
 	switch (dirty_nodes)
 	{
 	case DirtyNodes::Self: dirty_definition = true; break;
 	case DirtyNodes::SelfAndSiblings:
 		dirty_definition = true;
 		if (parent)
+		{
 			parent->dirty_child_definitions = true;
+			parent->RequestUpdate();
+		}
 		break;
 	}
+
+	RequestUpdate();
 }
 
 void Element::UpdateDefinition()
@@ -2485,7 +2632,11 @@ void Element::UpdateDefinition()
 	{
 		dirty_child_definitions = false;
 		for (const ElementPtr& child : children)
+		{
+			// The children are updated right after us, so there is no need to flag our ancestors.
 			child->dirty_definition = true;
+			child->update_dirty = true;
+		}
 	}
 }
 
@@ -2553,6 +2704,8 @@ ElementAnimationList::iterator Element::StartAnimation(PropertyId property_id, c
 		it = animations.end() - 1;
 	}
 
+	ScheduleAnimations();
+
 	Property value;
 
 	if (start_value)
@@ -2623,6 +2776,7 @@ bool Element::StartTransition(const Transition& transition, const Property& star
 		// Add transition as new animation
 		animations.push_back(ElementAnimation{transition.id, ElementAnimationOrigin::Transition, start_value, *this, start_time, 0.0f, 1, false});
 		it = (animations.end() - 1);
+		ScheduleAnimations();
 	}
 	else
 	{
@@ -2769,7 +2923,7 @@ void Element::AdvanceAnimations()
 		for (auto& animation : animations)
 		{
 			Property property = animation.UpdateAndGetProperty(time, *this);
-			if (property.unit != Unit::UNKNOWN)
+			if (property.unit != Unit::UNKNOWN && !SetAnimatedRenderProperty(animation.GetPropertyId(), property))
 				SetProperty(animation.GetPropertyId(), property);
 		}
 
@@ -2804,6 +2958,72 @@ void Element::AdvanceAnimations()
 	}
 }
 
+void Element::ScheduleAnimations()
+{
+	if (animations.empty() || animation_timeline_index >= 0)
+		return;
+
+	if (Context* context = GetContext())
+		context->animation_timeline->Add(this);
+}
+
+bool Element::SetAnimatedRenderProperty(PropertyId id, const Property& property)
+{
+	if (id != PropertyId::Opacity && id != PropertyId::ImageColor && id != PropertyId::Transform)
+		return false;
+
+	// Our computed values must already be resolved for us to modify them directly.
+	if (computed_values_are_default_initialized)
+		return false;
+
+	// Adding or removing the transform changes the containing block of absolutely positioned descendants, which requires a new layout.
+	if (id == PropertyId::Transform && (property.Get<TransformPtr>() != nullptr) != meta->computed_values.has_local_transform())
+		return false;
+
+	// The property is still stored on the element, so that it is returned by GetProperty() and used whenever our style is resolved again.
+	if (!meta->style.SetPropertyWithoutDirtying(id, property))
+		return false;
+
+	if (id == PropertyId::Opacity)
+	{
+		SetInheritedOpacity(property.Get<float>());
+		return true;
+	}
+
+	if (id == PropertyId::ImageColor)
+		meta->computed_values.image_color(property.Get<Colourb>());
+
+	// The transform is read from the property itself when the transform state is updated during rendering.
+	PropertyIdSet changed_properties;
+	changed_properties.Insert(id);
+	OnPropertyChange(changed_properties);
+
+	return true;
+}
+
+void Element::SetInheritedOpacity(float opacity)
+{
+	if (meta->computed_values.opacity() == opacity)
+		return;
+
+	static const PropertyIdSet opacity_property = [] {
+		PropertyIdSet set;
+		set.Insert(PropertyId::Opacity);
+		return set;
+	}();
+
+	meta->computed_values.opacity(opacity);
+	OnPropertyChange(opacity_property);
+
+	const int num_children = GetNumChildren(true);
+	for (int i = 0; i < num_children; i++)
+	{
+		Element* child = GetChild(i);
+		if (!child->computed_values_are_default_initialized && !child->GetLocalProperty(PropertyId::Opacity))
+			child->SetInheritedOpacity(opacity);
+	}
+}
+
 void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty)
 {
 	dirty_perspective |= perspective_dirty;
@@ -2953,6 +3173,8 @@ void Element::UpdateTransformState()
 	// A change in perspective or transform will require an update to children transforms as well.
 	if (perspective_or_transform_changed)
 	{
+		DirtyGeometry();
+
 		for (size_t i = 0; i < children.size(); i++)
 			children[i]->DirtyTransformState(false, true);
 	}
@@ -2995,6 +3217,10 @@ void Element::DirtyFontFaceRecursive()
 	meta->style.DirtyProperty(PropertyId::FontSize);
 	meta->computed_values.font_face_handle(0);
 
+	// Any shared values may refer to the font face handles being released.
+	if (owner_document == this)
+		owner_document->style_sharing_cache->Clear();
+
 	const int num_children = GetNumChildren(true);
 	for (int i = 0; i < num_children; ++i)
 		GetChild(i)->DirtyFontFaceRecursive();
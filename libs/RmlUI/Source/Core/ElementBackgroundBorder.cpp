@@ -52,13 +52,21 @@ void ElementBackgroundBorder::Render(Element* element)
 
 		GenerateGeometry(element);
 
+		// Regenerate the clip geometry right away, as it may be referenced by the retained render commands of our descendants.
+		if (GetBackground(BackgroundType::ClipBorder))
+			GetClipGeometry(element, BoxArea::Border);
+		if (GetBackground(BackgroundType::ClipPadding))
+			GetClipGeometry(element, BoxArea::Padding);
+		if (GetBackground(BackgroundType::ClipContent))
+			GetClipGeometry(element, BoxArea::Content);
+
 		background_dirty = false;
 		border_dirty = false;
 	}
 
 	Background* shadow = GetBackground(BackgroundType::BoxShadow);
 	if (shadow && shadow->geometry)
-		shadow->geometry.Render(element->GetAbsoluteOffset(BoxArea::Border), shadow->texture);
+		shadow->geometry.Render(element->GetAbsoluteOffset(BoxArea::Border), *shadow->texture);
 	else if (Background* background = GetBackground(BackgroundType::BackgroundBorder))
 	{
 		auto offset = element->GetAbsoluteOffset(BoxArea::Border);
@@ -157,19 +165,14 @@ void ElementBackgroundBorder::GenerateGeometry(Element* element)
 
 	if (has_box_shadow)
 	{
-		Geometry& background_border_geometry = geometry;
-
 		const Property* p_box_shadow = element->GetLocalProperty(PropertyId::BoxShadow);
 		RMLUI_ASSERT(p_box_shadow->value.GetType() == Variant::BOXSHADOWLIST);
 		BoxShadowList shadow_list = p_box_shadow->value.Get<BoxShadowList>();
 
 		// Generate the geometry for the box-shadow texture.
 		Background& shadow_background = GetOrCreateBackground(BackgroundType::BoxShadow);
-		Geometry& shadow_geometry = shadow_background.geometry;
-		CallbackTexture& shadow_texture = shadow_background.texture;
-
-		GeometryBoxShadow::Generate(shadow_geometry, shadow_texture, *render_manager, element, background_border_geometry, std::move(shadow_list),
-			border_radius, computed.opacity());
+		GeometryBoxShadow::Generate(shadow_background.geometry, shadow_background.texture, *render_manager, element, std::move(shadow_list),
+			background_color, border_colors, border_radius, opacity);
 	}
 }
 
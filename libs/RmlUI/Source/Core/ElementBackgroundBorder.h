@@ -50,7 +50,7 @@ private:
 	enum class BackgroundType { BackgroundBorder, BoxShadow, ClipBorder, ClipPadding, ClipContent, Count };
 	struct Background {
 		Geometry geometry;
-		CallbackTexture texture;
+		SharedPtr<CallbackTexture> texture;
 	};
 
 	Background* GetBackground(BackgroundType type);
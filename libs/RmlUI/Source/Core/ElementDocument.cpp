@@ -40,6 +40,8 @@
 #include "Layout/LayoutDetails.h"
 #include "Layout/LayoutEngine.h"
 #include "StreamFile.h"
+#include "AncestorFilter.h"
+#include "StyleSharingCache.h"
 #include "StyleSheetFactory.h"
 #include "Template.h"
 #include "TemplateCache.h"
@@ -179,6 +181,11 @@ ElementDocument::ElementDocument(const String& tag) : Element(tag)
 	layout_dirty = true;
 	position_dirty = false;
 
+	geometry_generation = 0;
+
+	style_sharing_cache = MakeUnique<StyleSharingCache>();
+	ancestor_filter = MakeUnique<AncestorFilter>();
+
 	ForceLocalStackingContext();
 	SetOwnerDocument(this);
 
@@ -581,11 +588,6 @@ void ElementDocument::DirtyPosition()
 	position_dirty = true;
 }
 
-void ElementDocument::DirtyLayout()
-{
-	layout_dirty = true;
-}
-
 bool ElementDocument::IsLayoutDirty()
 {
 	return layout_dirty;
@@ -618,12 +620,12 @@ void ElementDocument::ProcessDefaultAction(Event& event)
 	// Process generic keyboard events for this window in bubble phase
 	if (event == EventId::Keydown)
 	{
-		int key_identifier = event.GetParameter<int>("key_identifier", Input::KI_UNKNOWN);
+		int key_identifier = event.GetKeyIdentifier();
 
 		// Process TAB
 		if (key_identifier == Input::KI_TAB)
 		{
-			if (Element* element = FindNextTabElement(event.GetTargetElement(), !event.GetParameter<bool>("shift_key", false)))
+			if (Element* element = FindNextTabElement(event.GetTargetElement(), !(event.GetKeyModifierState() & Input::KM_SHIFT)))
 			{
 				if (element->Focus(true))
 				{
@@ -53,6 +53,9 @@ public:
 
 	void RenderEffects(RenderStage render_stage);
 
+	// Returns true if the element has any filters, which may draw outside its own bounds.
+	bool HasFilters() const { return !filters.empty(); }
+
 	// Mark effects as dirty and force them to reset themselves.
 	void DirtyEffects();
 	// Mark the element data of effects as dirty.
@@ -39,6 +39,8 @@
 #include "ElementEffects.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
+#include "HitTestGrid.h"
+#include "Layout/LayoutCache.h"
 #include "Pool.h"
 
 namespace Rml {
@@ -53,6 +55,8 @@ struct ElementMeta {
 	ElementEffects effects;
 	ElementScroll scroll;
 	Style::ComputedValues computed_values;
+	LayoutState layout_state;
+	UniquePtr<HitTestGrid> hit_test_grid;
 };
 
 struct ElementMetaPool {
@@ -0,0 +1,154 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementPrototype.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementText.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+
+namespace Rml {
+
+namespace {
+	// Parses like the regular XML parser, while detecting any tags that rely on a custom node handler.
+	class PrototypeParser final : public XMLParser {
+	public:
+		PrototypeParser(Element* root) : XMLParser(root) {}
+
+		bool UsesNodeHandler() const { return uses_node_handler; }
+
+	protected:
+		void HandleElementStart(const String& name, const XMLAttributes& attributes) override
+		{
+			// The outermost tag is the wrapper inserted by Compile().
+			if (depth > 0 && XMLParser::GetNodeHandler(StringUtilities::ToLower(name)))
+				uses_node_handler = true;
+
+			depth += 1;
+			XMLParser::HandleElementStart(name, attributes);
+		}
+
+		void HandleElementEnd(const String& name) override
+		{
+			depth -= 1;
+			XMLParser::HandleElementEnd(name);
+		}
+
+	private:
+		int depth = 0;
+		bool uses_node_handler = false;
+	};
+} // namespace
+
+bool ElementPrototype::Compile(Element* element, const String& rml)
+{
+	RMLUI_ZoneScoped;
+	RMLUI_ASSERT(element);
+
+	nodes.clear();
+
+	// Parse into a detached element, so that no data views or controllers are constructed on the prototype.
+	ElementPtr root = Factory::InstanceElement(nullptr, "*", "#prototype", XMLAttributes());
+	if (!root)
+		return false;
+
+	// Wrap the contents the same way as when instancing text as RML, see Factory::InstanceElementText.
+	Context* context = element->GetContext();
+	const String tag = context ? context->GetDocumentsBaseTag() : "body";
+	const String open_tag = "<" + tag + ">";
+	const String close_tag = "</" + tag + ">";
+
+	StreamMemory stream(open_tag.size() + rml.size() + close_tag.size());
+	stream.Write(open_tag);
+	stream.Write(rml);
+	stream.Write(close_tag);
+	stream.Seek(0, SEEK_SET);
+
+	PrototypeParser parser(root.get());
+	parser.Parse(&stream);
+
+	if (parser.UsesNodeHandler())
+		return false;
+
+	CompileNodes(nodes, root.get());
+	return true;
+}
+
+void ElementPrototype::Instance(Element* parent) const
+{
+	RMLUI_ZoneScoped;
+	InstanceNodes(nodes, parent);
+}
+
+void ElementPrototype::CompileNodes(Vector<Node>& nodes, Element* parent)
+{
+	const int num_children = parent->GetNumChildren();
+	nodes.resize(num_children);
+
+	for (int i = 0; i < num_children; i++)
+	{
+		Element* child = parent->GetChild(i);
+		Node& node = nodes[i];
+
+		node.tag = child->GetTagName();
+		node.attributes = child->GetAttributes();
+		if (ElementText* text_element = rmlui_dynamic_cast<ElementText*>(child))
+			node.text = text_element->GetText();
+
+		CompileNodes(node.children, child);
+	}
+}
+
+void ElementPrototype::InstanceNodes(const Vector<Node>& nodes, Element* parent)
+{
+	for (const Node& node : nodes)
+	{
+		ElementPtr element = Factory::InstanceElement(parent, node.tag, node.tag, node.attributes);
+		if (!element)
+		{
+			Log::Message(Log::LT_ERROR, "Failed to create element for tag %s, instancer returned nullptr.", node.tag.c_str());
+			continue;
+		}
+
+		if (!node.text.empty())
+		{
+			if (ElementText* text_element = rmlui_dynamic_cast<ElementText*>(element.get()))
+				text_element->SetText(node.text);
+		}
+
+		Element* child = parent->AppendChild(std::move(element));
+		InstanceNodes(node.children, child);
+	}
+}
+
+} // namespace Rml
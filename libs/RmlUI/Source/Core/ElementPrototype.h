@@ -26,50 +26,42 @@
  *
  */
 
-#ifndef TEXTURELAYOUTROW_H
-#define TEXTURELAYOUTROW_H
+#ifndef RMLUI_CORE_ELEMENTPROTOTYPE_H
+#define RMLUI_CORE_ELEMENTPROTOTYPE_H
 
-#include "TextureLayoutRectangle.h"
+#include "../../Include/RmlUi/Core/Types.h"
 
 namespace Rml {
 
-class TextureLayout;
+class Element;
 
 /**
-    A texture layout row is a single row of rectangles positioned vertically within a texture.
-
-    @author Peter
+    A fragment of RML parsed once into a tree of tags, attributes and text, which can then be instanced any number of
+    times without running the XML parser again. Used by structural data views to generate their children.
  */
 
-class TextureLayoutRow {
+class ElementPrototype {
 public:
-	TextureLayoutRow();
-	~TextureLayoutRow();
-
-	/// Attempts to position unplaced rectangles from the layout into this row.
-	/// @param[in] layout The layout to position rectangles from.
-	/// @param[in] width The maximum width of this row.
-	/// @param[in] y The y-coordinate of this row.
-	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int width, int y);
-
-	/// Assigns allocated texture data to all rectangles in this row.
-	/// @param[in] texture_data The pointer to the beginning of the texture's data.
-	/// @param[in] stride The stride of the texture's surface, in bytes;
-	void Allocate(byte* texture_data, int stride);
+	/// Parses the RML fragment, using the given element to resolve the context of the parse.
+	/// @return False if the fragment contains tags with a custom node handler, which only the XML parser can reproduce.
+	bool Compile(Element* element, const String& rml);
 
-	/// Returns the height of the row.
-	/// @return The row's height.
-	int GetHeight() const;
-
-	/// Resets the placed status for all of the rectangles within this row.
-	void Unplace();
+	/// Instances the compiled elements as children of the given parent.
+	void Instance(Element* parent) const;
 
 private:
-	using RectangleList = Vector<TextureLayoutRectangle*>;
+	struct Node {
+		String tag;
+		ElementAttributes attributes;
+		// Contents of text elements.
+		String text;
+		Vector<Node> children;
+	};
+
+	static void CompileNodes(Vector<Node>& nodes, Element* parent);
+	static void InstanceNodes(const Vector<Node>& nodes, Element* parent);
 
-	int height;
-	RectangleList rectangles;
+	Vector<Node> nodes;
 };
 
 } // namespace Rml
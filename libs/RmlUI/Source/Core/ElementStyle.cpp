@@ -43,25 +43,56 @@
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include "AncestorFilter.h"
 #include "ComputeProperty.h"
 #include "ElementDefinition.h"
 #include "PropertiesIterator.h"
+#include "StyleSharingCache.h"
+#include "ThreadPool.h"
 #include <algorithm>
 
 namespace Rml {
 
-inline PseudoClassState operator|(PseudoClassState lhs, PseudoClassState rhs)
+// Below this number of elements, resolving definitions on the worker threads is not worth the synchronization.
+static constexpr int parallel_definitions_threshold = 256;
+static constexpr int parallel_definitions_chunk_size = 32;
+
+// Incremented whenever an element definition is dirtied, which invalidates all definitions resolved ahead of the update.
+static uint64_t resolved_definitions_generation = 1;
+
+bool PseudoClassSet::Insert(PseudoClassId id)
 {
-	return PseudoClassState(int(lhs) | int(rhs));
+	const size_t index = size_t(id);
+	uint64_t* target = &word;
+	if (index >= WordBits)
+	{
+		const size_t overflow_index = index / WordBits - 1;
+		if (overflow_index >= overflow_words.size())
+			overflow_words.resize(overflow_index + 1, 0);
+		target = &overflow_words[overflow_index];
+	}
+
+	const uint64_t bit = uint64_t(1) << (index % WordBits);
+	const bool inserted = !(*target & bit);
+	*target |= bit;
+	return inserted;
 }
-inline PseudoClassState operator&(PseudoClassState lhs, PseudoClassState rhs)
+
+bool PseudoClassSet::Erase(PseudoClassId id)
 {
-	return PseudoClassState(int(lhs) & int(rhs));
+	if (!Contains(id))
+		return false;
+
+	const size_t index = size_t(id);
+	uint64_t& target = (index < WordBits ? word : overflow_words[index / WordBits - 1]);
+	target &= ~(uint64_t(1) << (index % WordBits));
+	return true;
 }
 
 ElementStyle::ElementStyle(Element* _element)
 {
 	element = _element;
+	tag_atom = AtomTable::GetOrInsert(element->GetTagName());
 }
 
 const Property* ElementStyle::GetLocalProperty(PropertyId id, const PropertyDictionary& inline_properties, const ElementDefinition* definition)
@@ -173,10 +204,18 @@ void ElementStyle::UpdateDefinition()
 
 	SharedPtr<const ElementDefinition> new_definition;
 
-	if (const StyleSheet* style_sheet = element->GetStyleSheet())
+	if (resolved_definition_generation == resolved_definitions_generation)
 	{
-		new_definition = style_sheet->GetElementDefinition(element);
+		new_definition = std::move(resolved_definition);
 	}
+	else if (const StyleSheet* style_sheet = element->GetStyleSheet())
+	{
+		const ElementDocument* document = element->GetOwnerDocument();
+		new_definition = style_sheet->GetElementDefinition(element, document ? document->ancestor_filter.get() : nullptr);
+	}
+
+	resolved_definition.reset();
+	resolved_definition_generation = 0;
 
 	// Switch the property definitions if the definition has changed.
 	if (new_definition != definition)
@@ -212,78 +251,138 @@ void ElementStyle::UpdateDefinition()
 	}
 }
 
-bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, bool override_class)
+void ElementStyle::ResolveDefinitions(Element* root, ThreadPool& thread_pool)
 {
-	bool changed = false;
+	RMLUI_ZoneScoped;
 
-	if (activate)
-	{
-		PseudoClassState& state = pseudo_classes[pseudo_class];
-		changed = (state == PseudoClassState::Clear);
-		state = (state | (override_class ? PseudoClassState::Override : PseudoClassState::Set));
-	}
-	else
-	{
-		auto it = pseudo_classes.find(pseudo_class);
-		if (it != pseudo_classes.end())
+	Vector<PendingDefinition> pending;
+	GatherPendingDefinitions(root, false, pending);
+
+	// Leave small updates to the element update itself.
+	if ((int)pending.size() < parallel_definitions_threshold)
+		return;
+
+	thread_pool.ParallelFor((int)pending.size(), parallel_definitions_chunk_size, [&pending](int begin, int end) {
+		// The pending elements are listed in tree order, thus the ancestor filter can mostly be updated incrementally.
+		static thread_local AncestorFilter ancestor_filter;
+		ancestor_filter.Clear();
+
+		for (int i = begin; i < end; i++)
 		{
-			PseudoClassState& state = it->second;
-			state = (state & (override_class ? PseudoClassState::Set : PseudoClassState::Override));
-			if (state == PseudoClassState::Clear)
+			PendingDefinition& entry = pending[i];
+			if (entry.style_sheet)
 			{
-				pseudo_classes.erase(it);
-				changed = true;
+				ancestor_filter.SetAncestorsOf(entry.element);
+				entry.definition = entry.style_sheet->GetElementDefinition(entry.element, &ancestor_filter);
 			}
 		}
+	});
+
+	for (PendingDefinition& entry : pending)
+	{
+		ElementStyle& style = *entry.element->GetStyle();
+		style.resolved_definition = std::move(entry.definition);
+		style.resolved_definition_generation = resolved_definitions_generation;
 	}
+}
+
+void ElementStyle::InvalidateResolvedDefinitions()
+{
+	resolved_definitions_generation += 1;
+}
+
+void ElementStyle::GatherPendingDefinitions(Element* element, bool parent_dirties_children, Vector<PendingDefinition>& pending)
+{
+	// Mirrors how Element::Update() skips clean subtrees and how Element::UpdateDefinition() propagates the dirty flags down the tree.
+	if (!element->update_dirty && !parent_dirties_children)
+		return;
+
+	const bool dirty_definition = (element->dirty_definition || parent_dirties_children);
+	if (dirty_definition)
+		pending.push_back(PendingDefinition{element, element->GetStyleSheet(), nullptr});
+
+	const bool dirty_child_definitions = (dirty_definition || element->dirty_child_definitions);
+	for (const ElementPtr& child : element->children)
+		GatherPendingDefinitions(child.get(), dirty_child_definitions, pending);
+}
+
+bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, bool override_class)
+{
+	const PseudoClassId id = (activate ? AtomTable::GetOrInsertPseudoClass(pseudo_class) : AtomTable::GetPseudoClass(pseudo_class));
+	if (id == PseudoClassId::Invalid)
+		return false;
+
+	const bool was_set = IsPseudoClassSet(id);
+
+	PseudoClassSet& target = (override_class ? override_pseudo_classes : pseudo_classes);
+	if (activate)
+		target.Insert(id);
+	else
+		target.Erase(id);
 
-	return changed;
+	return was_set != IsPseudoClassSet(id);
 }
 
 bool ElementStyle::IsPseudoClassSet(const String& pseudo_class) const
 {
-	return (pseudo_classes.count(pseudo_class) == 1);
+	const PseudoClassId id = AtomTable::GetPseudoClass(pseudo_class);
+	return id != PseudoClassId::Invalid && IsPseudoClassSet(id);
+}
+
+bool ElementStyle::IsPseudoClassSet(PseudoClassId pseudo_class) const
+{
+	return pseudo_classes.Contains(pseudo_class) || override_pseudo_classes.Contains(pseudo_class);
 }
 
-const PseudoClassMap& ElementStyle::GetActivePseudoClasses() const
+StringList ElementStyle::GetActivePseudoClasses() const
 {
-	return pseudo_classes;
+	StringList names;
+	ForEachPseudoClass([&names](PseudoClassId id) { names.push_back(AtomTable::GetPseudoClassName(id)); });
+	return names;
 }
 
 bool ElementStyle::SetClass(const String& class_name, bool activate)
 {
-	const auto class_location = std::find(classes.begin(), classes.end(), class_name);
+	const Atom atom = (activate ? AtomTable::GetOrInsert(class_name) : AtomTable::Get(class_name));
+	if (atom == Atom::Invalid)
+		return false;
+
+	const auto atom_location = std::lower_bound(class_atoms.begin(), class_atoms.end(), atom);
+	const bool is_set = (atom_location != class_atoms.end() && *atom_location == atom);
+
+	if (activate == is_set)
+		return false;
 
-	bool changed = false;
 	if (activate)
 	{
-		if (class_location == classes.end())
-		{
-			classes.push_back(class_name);
-			changed = true;
-		}
+		classes.push_back(class_name);
+		class_atoms.insert(atom_location, atom);
 	}
 	else
 	{
-		if (class_location != classes.end())
-		{
-			classes.erase(class_location);
-			changed = true;
-		}
+		classes.erase(std::find(classes.begin(), classes.end(), class_name));
+		class_atoms.erase(atom_location);
 	}
 
-	return changed;
+	return true;
 }
 
 bool ElementStyle::IsClassSet(const String& class_name) const
 {
-	return std::find(classes.begin(), classes.end(), class_name) != classes.end();
+	const Atom atom = AtomTable::Get(class_name);
+	return atom != Atom::Invalid && std::binary_search(class_atoms.begin(), class_atoms.end(), atom);
 }
 
 void ElementStyle::SetClassNames(const String& class_names)
 {
 	classes.clear();
 	StringUtilities::ExpandString(classes, class_names, ' ');
+
+	class_atoms.clear();
+	class_atoms.reserve(classes.size());
+	for (const String& name : classes)
+		class_atoms.push_back(AtomTable::GetOrInsert(name));
+	std::sort(class_atoms.begin(), class_atoms.end());
 }
 
 String ElementStyle::GetClassNames() const
@@ -301,12 +400,37 @@ String ElementStyle::GetClassNames() const
 	return class_names;
 }
 
-const StringList& ElementStyle::GetClassNameList() const
+const AtomList& ElementStyle::GetClassAtoms() const
+{
+	return class_atoms;
+}
+
+void ElementStyle::SetId(const String& id)
+{
+	id_atom = AtomTable::GetOrInsert(id);
+}
+
+Atom ElementStyle::GetIdAtom() const
+{
+	return id_atom;
+}
+
+Atom ElementStyle::GetTagAtom() const
 {
-	return classes;
+	return tag_atom;
 }
 
 bool ElementStyle::SetProperty(PropertyId id, const Property& property)
+{
+	if (!SetPropertyWithoutDirtying(id, property))
+		return false;
+
+	DirtyProperty(id);
+
+	return true;
+}
+
+bool ElementStyle::SetPropertyWithoutDirtying(PropertyId id, const Property& property)
 {
 	Property new_property = property;
 
@@ -315,7 +439,6 @@ bool ElementStyle::SetProperty(PropertyId id, const Property& property)
 		return false;
 
 	inline_properties.SetProperty(id, new_property);
-	DirtyProperty(id);
 
 	return true;
 }
@@ -441,6 +564,7 @@ float ElementStyle::ResolveRelativeLength(NumericValue value, RelativeTarget rel
 void ElementStyle::DirtyInheritedProperties()
 {
 	dirty_properties |= StyleSheetSpecification::GetRegisteredInheritedProperties();
+	element->RequestUpdate();
 }
 
 void ElementStyle::DirtyPropertiesWithUnits(Units units)
@@ -499,21 +623,40 @@ PropertiesIterator ElementStyle::Iterate() const
 void ElementStyle::DirtyProperty(PropertyId id)
 {
 	dirty_properties.Insert(id);
+	element->RequestUpdate();
 }
 
 void ElementStyle::DirtyProperties(const PropertyIdSet& properties)
 {
 	dirty_properties |= properties;
+	element->RequestUpdate();
 }
 
 PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values,
-	const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio, Vector2f vp_dimensions)
+	const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio, Vector2f vp_dimensions,
+	StyleSharingCache* sharing_cache)
 {
 	if (dirty_properties.Empty())
 		return PropertyIdSet();
 
 	RMLUI_ZoneScopedC(0xFF7F50);
 
+	// Without any inline properties, our values are fully determined by our definition and the values we inherit. Then
+	// we can share the values of any other element computed from the same inputs.
+	StyleSharingCache::Key sharing_key;
+	const bool share_values = (sharing_cache && parent_values && inline_properties.GetProperties().empty());
+	if (share_values)
+	{
+		const float document_font_size = (document_values ? document_values->font_size() : DefaultComputedValues().font_size());
+		sharing_key = StyleSharingCache::Key{definition, parent_values->GetSharedValues(), document_font_size, dp_ratio, vp_dimensions};
+
+		if (Style::SharedValuesPtr shared_values = sharing_cache->Find(sharing_key))
+		{
+			ShareComputedValues(values, std::move(shared_values));
+			return TakeDirtyProperties();
+		}
+	}
+
 	// Generally, this is how it works:
 	//   1. Assign default values (clears any removed properties)
 	//   2. Inherit inheritable values from parent
@@ -915,15 +1058,50 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 			GetFontEngineInterface()->GetFontFaceHandle(values.font_family(), values.font_style(), values.font_weight(), (int)values.font_size()));
 	}
 
-	// Next, pass inheritable dirty properties onto our children
+	// Values without a font face may resolve differently once the font is loaded, so don't let others reuse them.
+	if (share_values && values.font_face_handle() != 0)
+		sharing_cache->Insert(std::move(sharing_key), values.GetSharedValues());
+
+	return TakeDirtyProperties();
+}
+
+void ElementStyle::ShareComputedValues(Style::ComputedValues& values, Style::SharedValuesPtr shared_values)
+{
+	const float font_size_before = values.font_size();
+	const Style::LineHeight line_height_before = values.line_height();
+
+	values.SetSharedValues(std::move(shared_values));
+
+	// Report the same dependent properties as dirty as if we computed the values ourselves.
+	if (dirty_properties.Contains(PropertyId::FontSize) && font_size_before != values.font_size())
+	{
+		dirty_properties.Insert(PropertyId::LineHeight);
+		for (auto it = Iterate(); !it.AtEnd(); ++it)
+		{
+			auto name_property_pair = *it;
+			if (name_property_pair.second.unit == Unit::EM)
+				dirty_properties.Insert(name_property_pair.first);
+		}
+	}
+
+	if (dirty_properties.Contains(PropertyId::LineHeight) &&
+		(line_height_before.value != values.line_height().value || line_height_before.inherit_value != values.line_height().inherit_value))
+		dirty_properties.Insert(PropertyId::VerticalAlign);
+}
+
+PropertyIdSet ElementStyle::TakeDirtyProperties()
+{
+	// Pass inheritable dirty properties onto our children
 	PropertyIdSet dirty_inherited_properties = (dirty_properties & StyleSheetSpecification::GetRegisteredInheritedProperties());
 
 	if (!dirty_inherited_properties.Empty())
 	{
 		for (int i = 0; i < element->GetNumChildren(true); i++)
 		{
+			// Our children are updated after us, so only their own update flag needs to be set.
 			auto child = element->GetChild(i);
 			child->GetStyle()->dirty_properties |= dirty_inherited_properties;
+			child->update_dirty = true;
 		}
 	}
 
@@ -30,18 +30,57 @@
 #define RMLUI_CORE_ELEMENTSTYLE_H
 
 #include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "Atom.h"
 
 namespace Rml {
 
 class ElementDefinition;
 class PropertiesIterator;
+class StyleSheet;
+class StyleSharingCache;
+class ThreadPool;
 enum class RelativeTarget;
 
-enum class PseudoClassState : uint8_t { Clear = 0, Set = 1, Override = 2 };
-using PseudoClassMap = SmallUnorderedMap<String, PseudoClassState>;
+/**
+    A set of pseudo classes, stored as a bitset indexed by pseudo class id.
+ */
+class PseudoClassSet {
+public:
+	bool Contains(PseudoClassId id) const
+	{
+		const size_t index = size_t(id);
+		if (index < WordBits)
+			return (word >> index) & 1;
+		const size_t overflow_index = index / WordBits - 1;
+		return overflow_index < overflow_words.size() && ((overflow_words[overflow_index] >> (index % WordBits)) & 1);
+	}
+
+	/// Adds the pseudo class to the set, returns true if it was not already contained.
+	bool Insert(PseudoClassId id);
+	/// Removes the pseudo class from the set, returns true if it was contained.
+	bool Erase(PseudoClassId id);
+
+	/// Returns the number of pseudo class ids covered by the currently allocated bits.
+	size_t GetCapacity() const { return WordBits * (1 + overflow_words.size()); }
+	/// Returns the bits of the given word, where each word covers the next 64 pseudo class ids.
+	uint64_t GetWord(size_t word_index) const
+	{
+		if (word_index == 0)
+			return word;
+		return word_index - 1 < overflow_words.size() ? overflow_words[word_index - 1] : 0;
+	}
+
+	static constexpr size_t WordBits = 64;
+
+private:
+	// The first word is stored inline. Only applications with a very large number of distinct pseudo classes need the overflow words.
+	uint64_t word = 0;
+	Vector<uint64_t> overflow_words;
+};
 
 /**
     Manages an element's style and property information.
@@ -57,6 +96,12 @@ public:
 	/// Update this definition if required
 	void UpdateDefinition();
 
+	/// Looks up the definitions of all elements below the root that will update their definition during the next element update, splitting the
+	/// selector matching between the threads of the pool. The results are used by UpdateDefinition() unless any definition is dirtied before then.
+	static void ResolveDefinitions(Element* root, ThreadPool& thread_pool);
+	/// Discards all definitions resolved ahead of the element update, called whenever an element definition is dirtied.
+	static void InvalidateResolvedDefinitions();
+
 	/// Sets or removes a pseudo-class on the element.
 	/// @param[in] pseudo_class The pseudo class to activate or deactivate.
 	/// @param[in] activate True if the pseudo class is to be activated, false to be deactivated.
@@ -68,8 +113,25 @@ public:
 	/// @param[in] pseudo_class The name of the pseudo-class to check for.
 	/// @return True if the pseudo-class is set on the element, false if not.
 	bool IsPseudoClassSet(const String& pseudo_class) const;
+	/// Checks if a specific pseudo-class has been set on the element, either normally or through an override.
+	bool IsPseudoClassSet(PseudoClassId pseudo_class) const;
 	/// Gets a list of the current active pseudo classes
-	const PseudoClassMap& GetActivePseudoClasses() const;
+	StringList GetActivePseudoClasses() const;
+	/// Calls the given function with the id of each active pseudo class.
+	template <typename Func>
+	void ForEachPseudoClass(Func&& func) const
+	{
+		const size_t num_words = Math::Max(pseudo_classes.GetCapacity(), override_pseudo_classes.GetCapacity()) / PseudoClassSet::WordBits;
+		for (size_t word_index = 0; word_index < num_words; word_index++)
+		{
+			uint64_t bits = (pseudo_classes.GetWord(word_index) | override_pseudo_classes.GetWord(word_index));
+			for (size_t i = word_index * PseudoClassSet::WordBits; bits != 0; i++, bits >>= 1)
+			{
+				if (bits & 1)
+					func(PseudoClassId(i));
+			}
+		}
+	}
 
 	/// Sets or removes a class on the element.
 	/// @param[in] class_name The name of the class to add or remove from the class list.
@@ -86,13 +148,22 @@ public:
 	/// Return the active class list.
 	/// @return A string containing all the classes on the element, separated by spaces.
 	String GetClassNames() const;
-	/// Return the active class list.
-	const StringList& GetClassNameList() const;
+	/// Returns the atoms of the active classes, sorted by their value.
+	const AtomList& GetClassAtoms() const;
+
+	/// Sets the id of the element, as used for selector matching.
+	void SetId(const String& id);
+	/// Returns the atom of the element's id.
+	Atom GetIdAtom() const;
+	/// Returns the atom of the element's tag name.
+	Atom GetTagAtom() const;
 
 	/// Sets a local property override on the element to a pre-parsed value.
 	/// @param[in] id The ID  of the new property.
 	/// @param[in] property The parsed property to set.
 	bool SetProperty(PropertyId id, const Property& property);
+	/// Sets a local property override without dirtying the property, for values the caller has already applied to the computed values.
+	bool SetPropertyWithoutDirtying(PropertyId id, const Property& property);
 	/// Removes a local property override on the element; its value will revert to that defined in
 	/// the style sheet.
 	/// @param[in] id The ID of the local property definition to remove.
@@ -136,8 +207,10 @@ public:
 
 	/// Turns the local and inherited properties into computed values for this element. These values can in turn be used during the layout procedure.
 	/// Must be called in correct order, always parent before its children.
+	/// @param[in] sharing_cache If set, the values may be shared with other elements styled by identical inputs.
 	PropertyIdSet ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values,
-		const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio, Vector2f vp_dimensions);
+		const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio, Vector2f vp_dimensions,
+		StyleSharingCache* sharing_cache = nullptr);
 
 	/// Returns an iterator for iterating the local properties of this element.
 	/// Note: Modifying the element's style invalidates its iterator.
@@ -147,24 +220,46 @@ private:
 	// Sets a list of properties as dirty.
 	void DirtyProperties(const PropertyIdSet& properties);
 
+	// Refers to values computed for another element from identical inputs, instead of computing our own.
+	void ShareComputedValues(Style::ComputedValues& values, Style::SharedValuesPtr shared_values);
+	// Passes inherited dirty properties on to our children, then returns and clears the dirty properties.
+	PropertyIdSet TakeDirtyProperties();
+
 	static const Property* GetLocalProperty(PropertyId id, const PropertyDictionary& inline_properties, const ElementDefinition* definition);
 	static const Property* GetProperty(PropertyId id, const Element* element, const PropertyDictionary& inline_properties,
 		const ElementDefinition* definition);
 	static void TransitionPropertyChanges(Element* element, PropertyIdSet& properties, const PropertyDictionary& inline_properties,
 		const ElementDefinition* old_definition, const ElementDefinition* new_definition);
 
+	struct PendingDefinition {
+		Element* element;
+		const StyleSheet* style_sheet;
+		SharedPtr<const ElementDefinition> definition;
+	};
+	static void GatherPendingDefinitions(Element* element, bool parent_dirties_children, Vector<PendingDefinition>& pending);
+
 	// Element these properties belong to
 	Element* element;
 
+	// The atoms of the element's tag name and id.
+	Atom tag_atom = Atom::Invalid;
+	Atom id_atom = Atom::Invalid;
+
 	// The list of classes applicable to this object.
 	StringList classes;
-	// This element's current pseudo-classes.
-	PseudoClassMap pseudo_classes;
+	// The atoms of the same classes, kept sorted so that selectors can test them as a subset with integer compares.
+	AtomList class_atoms;
+	// This element's current pseudo-classes, set the normal way and through overrides, respectively.
+	PseudoClassSet pseudo_classes;
+	PseudoClassSet override_pseudo_classes;
 
 	// Any properties that have been overridden in this element.
 	PropertyDictionary inline_properties;
 	// The definition of this element, provides applicable properties from the stylesheet.
 	SharedPtr<const ElementDefinition> definition;
+	// The definition resolved ahead of the element update, valid while the generation matches the current one.
+	SharedPtr<const ElementDefinition> resolved_definition;
+	uint64_t resolved_definition_generation = 0;
 
 	PropertyIdSet dirty_properties;
 };
@@ -173,7 +173,12 @@ void ElementText::OnRender()
 	if (render)
 	{
 		for (size_t i = 0; i < geometry.size(); ++i)
-			geometry[i].geometry.Render(translation, geometry[i].texture);
+		{
+			if (geometry[i].shader)
+				geometry[i].geometry.Render(translation, geometry[i].texture, *geometry[i].shader);
+			else
+				geometry[i].geometry.Render(translation, geometry[i].texture);
+		}
 	}
 
 	if (decoration)
@@ -223,6 +228,7 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 	// endline is found (and we're processing them), then the line is ended. kthxbai!
 	const char* token_begin = text.c_str() + line_begin;
 	const char* string_end = text.c_str() + text.size();
+	Vector<int> prefix_widths;
 	while (token_begin != string_end)
 	{
 		String token;
@@ -249,36 +255,58 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 				{
 					// Try to break up the word
 					max_token_width = int(maximum_line_width - line_width);
-					const int token_max_size = int(next_token_begin - token_begin);
-					const char* partial_string_end = token_begin + token_max_size;
+					const char* token_end = next_token_begin;
 
-					// @performance: Can be made much faster. Use string width heuristics and logarithmic search.
-					while (true)
-					{
-						partial_string_end = StringUtilities::SeekBackwardUTF8(partial_string_end - 1, token_begin);
-
-						bool force_loop_break_at_end = false;
-						if (partial_string_end == token_begin)
-						{
-							// Not even the first character of the token fits. Let it overflow onto the next line if we can.
-							if (allow_empty || !line.empty())
-								return false;
-
-							// Continue by forcing the first character to be consumed, even though it will overflow.
-							partial_string_end = StringUtilities::SeekForwardUTF8(token_begin + 1, token_begin + token_max_size);
-							force_loop_break_at_end = true;
-						}
+					// Measure all prefixes of the full token at once. Partial tokens are normally prefixes of the full token
+					// and can look up their width here, otherwise they are measured separately.
+					String full_token;
+					full_token.swap(token);
+					font_engine_interface->GetStringPrefixWidths(font_face_handle, full_token, text_shaping_context, previous_codepoint,
+						prefix_widths);
 
+					auto build_partial_token = [&](const char* partial_string_end) {
 						token.clear();
 						next_token_begin = token_begin;
 						BuildToken(token, next_token_begin, partial_string_end, line.empty() && trim_whitespace_prefix, collapse_white_space,
 							break_at_endline, text_transform_property, decode_escape_characters);
-						token_width = font_engine_interface->GetStringWidth(font_face_handle, token, text_shaping_context, previous_codepoint);
 
-						if (force_loop_break_at_end || token_width <= max_token_width)
-							break;
+						if (token.size() <= full_token.size() && full_token.compare(0, token.size(), token) == 0)
+							token_width = prefix_widths[StringUtilities::LengthUTF8(token)];
+						else
+							token_width = font_engine_interface->GetStringWidth(font_face_handle, token, text_shaping_context, previous_codepoint);
+					};
+
+					// Binary search for the longest partial token that fits, assuming widths grow with the number of characters.
+					const char* first_end = StringUtilities::SeekForwardUTF8(token_begin + 1, token_end);
+					const char* low = first_end;
+					const char* high = StringUtilities::SeekBackwardUTF8(token_end - 1, token_begin);
+					const char* partial_string_end = nullptr;
+					while (low <= high)
+					{
+						const char* middle = StringUtilities::SeekBackwardUTF8(low + (high - low) / 2, low);
+						build_partial_token(middle);
+						if (token_width <= max_token_width)
+						{
+							partial_string_end = middle;
+							low = StringUtilities::SeekForwardUTF8(middle + 1, token_end);
+						}
+						else
+						{
+							high = StringUtilities::SeekBackwardUTF8(middle - 1, token_begin);
+						}
+					}
+
+					if (!partial_string_end)
+					{
+						// Not even the first character of the token fits. Let it overflow onto the next line if we can.
+						if (allow_empty || !line.empty())
+							return false;
+
+						// Continue by forcing the first character to be consumed, even though it will overflow.
+						partial_string_end = first_end;
 					}
 
+					build_partial_token(partial_string_end);
 					break_line = true;
 				}
 				else if (allow_empty || !line.empty())
@@ -472,6 +500,7 @@ void ElementText::GenerateGeometry(RenderManager& render_manager, const FontFace
 			geometry[i].geometry = render_manager.MakeGeometry(std::move(mesh_list[i].mesh));
 
 		geometry[i].texture = mesh_list[i].texture;
+		geometry[i].shader = mesh_list[i].shader;
 	}
 
 	generated_decoration = Style::TextDecoration::None;
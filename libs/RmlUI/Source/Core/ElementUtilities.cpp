@@ -142,6 +142,21 @@ int ElementUtilities::GetStringWidth(Element* element, StringView string, Charac
 	return GetFontEngineInterface()->GetStringWidth(font_face_handle, string, text_shaping_context, prior_character);
 }
 
+void ElementUtilities::GetStringPrefixWidths(Element* element, StringView string, Vector<int>& prefix_widths, Character prior_character)
+{
+	const auto& computed = element->GetComputedValues();
+	const TextShapingContext text_shaping_context{computed.language(), computed.direction(), computed.letter_spacing()};
+
+	FontFaceHandle font_face_handle = element->GetFontFaceHandle();
+	if (font_face_handle == 0)
+	{
+		prefix_widths.assign(StringUtilities::LengthUTF8(string) + 1, 0);
+		return;
+	}
+
+	GetFontEngineInterface()->GetStringPrefixWidths(font_face_handle, string, text_shaping_context, prior_character, prefix_widths);
+}
+
 bool ElementUtilities::GetClippingRegion(Element* element, Rectanglei& out_clip_region, ClipMaskGeometryList* out_clip_mask_list,
 	bool force_clip_self)
 {
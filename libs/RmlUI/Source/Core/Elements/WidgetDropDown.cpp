@@ -309,6 +309,7 @@ void WidgetDropDown::OnValueChange(const String& value)
 
 	value_rml_dirty = true;
 	value_changed_since_last_box_format = true;
+	parent_element->RequestUpdate();
 }
 
 void WidgetDropDown::SetSelection(Element* select_option, bool force)
@@ -344,6 +345,7 @@ void WidgetDropDown::SetSelection(Element* select_option, bool force)
 	}
 
 	value_rml_dirty = true;
+	parent_element->RequestUpdate();
 }
 
 void WidgetDropDown::SeekSelection(bool seek_forward)
@@ -462,6 +464,7 @@ void WidgetDropDown::OnChildAdd(Element* element)
 
 	selection_dirty = true;
 	box_layout_dirty = true;
+	parent_element->RequestUpdate();
 }
 
 void WidgetDropDown::OnChildRemove(Element* element)
@@ -476,6 +479,7 @@ void WidgetDropDown::OnChildRemove(Element* element)
 
 	selection_dirty = true;
 	box_layout_dirty = true;
+	parent_element->RequestUpdate();
 }
 
 void WidgetDropDown::AttachScrollEvent()
@@ -562,7 +566,7 @@ void WidgetDropDown::ProcessEvent(Event& event)
 	break;
 	case EventId::Keydown:
 	{
-		Input::KeyIdentifier key_identifier = (Input::KeyIdentifier)event.GetParameter<int>("key_identifier", 0);
+		Input::KeyIdentifier key_identifier = event.GetKeyIdentifier();
 
 		auto HasVerticalNavigation = [this](PropertyId id) {
 			if (const Property* p = parent_element->GetProperty(id))
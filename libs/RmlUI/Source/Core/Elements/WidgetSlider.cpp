@@ -151,6 +151,7 @@ void WidgetSlider::Update()
 				SetBarPosition(i == 0 ? OnLineDecrement() : OnLineIncrement());
 			}
 
+			parent->RequestUpdate();
 			if (Context* ctx = parent->GetContext())
 				ctx->RequestNextUpdate(arrow_timers[i]);
 		}
@@ -397,7 +398,7 @@ void WidgetSlider::ProcessEvent(Event& event)
 	case EventId::Mousedown:
 	{
 		// Only respond to primary mouse button.
-		if (event.GetParameter("button", -1) != 0)
+		if (event.GetMouseButton() != 0)
 			break;
 
 		if (event.GetTargetElement() == track || event.GetTargetElement() == progress)
@@ -406,12 +407,12 @@ void WidgetSlider::ProcessEvent(Event& event)
 
 			if (orientation == HORIZONTAL)
 			{
-				mouse_position = event.GetParameter<float>("mouse_x", 0);
+				mouse_position = event.GetMousePosition().x;
 				bar_halfsize = 0.5f * bar->GetBox().GetSize(BoxArea::Border).x;
 			}
 			else
 			{
-				mouse_position = event.GetParameter<float>("mouse_y", 0);
+				mouse_position = event.GetMousePosition().y;
 				bar_halfsize = 0.5f * bar->GetBox().GetSize(BoxArea::Border).y;
 			}
 
@@ -422,12 +423,14 @@ void WidgetSlider::ProcessEvent(Event& event)
 		{
 			arrow_timers[0] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			parent->RequestUpdate();
 			SetBarPosition(OnLineDecrement());
 		}
 		else if (event.GetTargetElement() == arrows[1])
 		{
 			arrow_timers[1] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			parent->RequestUpdate();
 			SetBarPosition(OnLineIncrement());
 		}
 	}
@@ -450,9 +453,9 @@ void WidgetSlider::ProcessEvent(Event& event)
 			bar->SetPseudoClass("active", true);
 
 			if (orientation == HORIZONTAL)
-				bar_drag_anchor = event.GetParameter<float>("mouse_x", 0) - bar->GetAbsoluteOffset().x;
+				bar_drag_anchor = event.GetMousePosition().x - bar->GetAbsoluteOffset().x;
 			else
-				bar_drag_anchor = event.GetParameter<float>("mouse_y", 0) - bar->GetAbsoluteOffset().y;
+				bar_drag_anchor = event.GetMousePosition().y - bar->GetAbsoluteOffset().y;
 		}
 	}
 	break;
@@ -460,7 +463,8 @@ void WidgetSlider::ProcessEvent(Event& event)
 	{
 		if (event.GetTargetElement() == bar || event.GetTargetElement() == track || event.GetTargetElement() == progress)
 		{
-			float new_bar_offset = event.GetParameter<float>((orientation == HORIZONTAL ? "mouse_x" : "mouse_y"), 0) - bar_drag_anchor;
+			const Vector2f mouse_position = event.GetMousePosition();
+			float new_bar_offset = (orientation == HORIZONTAL ? mouse_position.x : mouse_position.y) - bar_drag_anchor;
 			float new_bar_position = AbsolutePositionToBarPosition(new_bar_offset);
 
 			SetBarPosition(OnBarChange(new_bar_position));
@@ -478,7 +482,7 @@ void WidgetSlider::ProcessEvent(Event& event)
 
 	case EventId::Keydown:
 	{
-		const Input::KeyIdentifier key_identifier = (Input::KeyIdentifier)event.GetParameter<int>("key_identifier", 0);
+		const Input::KeyIdentifier key_identifier = event.GetKeyIdentifier();
 
 		const bool increment =
 			(key_identifier == Input::KI_RIGHT && orientation == HORIZONTAL) || (key_identifier == Input::KI_DOWN && orientation == VERTICAL);
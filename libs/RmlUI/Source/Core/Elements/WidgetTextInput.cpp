@@ -452,8 +452,10 @@ void WidgetTextInput::OnUpdate()
 		{
 			cursor_timer += CURSOR_BLINK_TIME;
 			cursor_visible = !cursor_visible;
+			parent->DirtyRender();
 		}
 
+		parent->RequestUpdate();
 		if (parent->IsVisible(true))
 		{
 			if (Context* ctx = parent->GetContext())
@@ -531,11 +533,12 @@ void WidgetTextInput::ProcessEvent(Event& event)
 	{
 	case EventId::Keydown:
 	{
-		Input::KeyIdentifier key_identifier = (Input::KeyIdentifier)event.GetParameter<int>("key_identifier", 0);
-		bool numlock = event.GetParameter<int>("num_lock_key", 0) > 0;
-		bool shift = event.GetParameter<int>("shift_key", 0) > 0;
-		bool ctrl = event.GetParameter<int>("ctrl_key", 0) > 0;
-		bool alt = event.GetParameter<int>("alt_key", 0) > 0;
+		Input::KeyIdentifier key_identifier = event.GetKeyIdentifier();
+		const int key_modifier_state = event.GetKeyModifierState();
+		bool numlock = (key_modifier_state & Input::KM_NUMLOCK) != 0;
+		bool shift = (key_modifier_state & Input::KM_SHIFT) != 0;
+		bool ctrl = (key_modifier_state & Input::KM_CTRL) != 0;
+		bool alt = (key_modifier_state & Input::KM_ALT) != 0;
 		bool selection_changed = false;
 		bool out_of_bounds = false;
 
@@ -646,7 +649,7 @@ void WidgetTextInput::ProcessEvent(Event& event)
 	case EventId::Textinput:
 	{
 		// Only process the text if no modifier keys are pressed.
-		if (event.GetParameter<int>("ctrl_key", 0) == 0 && event.GetParameter<int>("alt_key", 0) == 0 && event.GetParameter<int>("meta_key", 0) == 0)
+		if ((event.GetKeyModifierState() & (Input::KM_CTRL | Input::KM_ALT | Input::KM_META)) == 0)
 		{
 			String text = event.GetParameter("text", String{});
 			AddCharacters(text);
@@ -700,7 +703,7 @@ void WidgetTextInput::ProcessEvent(Event& event)
 	{
 		if (event.GetTargetElement() == parent)
 		{
-			Vector2f mouse_position = Vector2f(event.GetParameter<float>("mouse_x", 0), event.GetParameter<float>("mouse_y", 0));
+			Vector2f mouse_position = event.GetMousePosition();
 			mouse_position -= text_element->GetAbsoluteOffset();
 
 			const int cursor_line_index = CalculateLineIndex(mouse_position.y);
@@ -711,7 +714,7 @@ void WidgetTextInput::ProcessEvent(Event& event)
 			MoveCursorToCharacterBoundaries(false);
 			UpdateCursorPosition(true);
 
-			if (UpdateSelection(event == EventId::Drag || event.GetParameter<int>("shift_key", 0) > 0))
+			if (UpdateSelection(event == EventId::Drag || (event.GetKeyModifierState() & Input::KM_SHIFT) != 0))
 				FormatText();
 
 			const bool move_to_cursor = (event == EventId::Drag);
@@ -1111,12 +1114,17 @@ int WidgetTextInput::CalculateCharacterIndex(int line_index, float position)
 
 	position -= GetAlignmentSpecificTextOffset(line);
 
+	Vector<int> prefix_widths;
+	ElementUtilities::GetStringPrefixWidths(text_element, StringView(p_begin, p_end), prefix_widths);
+
+	int character_index = 0;
 	for (auto it = StringIteratorU8(p_begin, p_begin, p_end); it;)
 	{
 		++it;
+		++character_index;
 		const int offset = (int)it.offset();
 
-		const float line_width = (float)ElementUtilities::GetStringWidth(text_element, StringView(p_begin, p_begin + offset));
+		const float line_width = (float)prefix_widths[character_index];
 		if (line_width > position)
 		{
 			if (position - prev_line_width < line_width - position)
@@ -1139,11 +1147,14 @@ int WidgetTextInput::CalculateCharacterIndex(int line_index, float position)
 
 void WidgetTextInput::ShowCursor(bool show, bool move_to_cursor)
 {
+	parent->DirtyRender();
+
 	if (show)
 	{
 		cursor_visible = true;
 		cursor_timer = CURSOR_BLINK_TIME;
 		last_update_time = GetSystemInterface()->GetElapsedTime();
+		parent->RequestUpdate();
 
 		// Shift the cursor into view.
 		if (move_to_cursor)
@@ -1447,8 +1458,20 @@ void WidgetTextInput::UpdateCursorPosition(bool update_ideal_cursor_position)
 	GetRelativeCursorIndices(cursor_line_index, cursor_character_index);
 
 	const auto& line = lines[cursor_line_index];
-	const int string_width_pre_cursor =
-		ElementUtilities::GetStringWidth(text_element, StringView(GetValue(), line.value_offset, cursor_character_index));
+	int string_width_pre_cursor = 0;
+	if (cursor_character_index <= line.editable_length)
+	{
+		// Measuring the whole line lets the font engine reuse its cached widths as the cursor moves along the line.
+		const StringView editable_line(GetValue(), line.value_offset, line.editable_length);
+		Vector<int> prefix_widths;
+		ElementUtilities::GetStringPrefixWidths(text_element, editable_line, prefix_widths);
+		const int character_offset = StringUtilities::ConvertByteOffsetToCharacterOffset(editable_line, cursor_character_index);
+		string_width_pre_cursor = prefix_widths[character_offset];
+	}
+	else
+	{
+		string_width_pre_cursor = ElementUtilities::GetStringWidth(text_element, StringView(GetValue(), line.value_offset, cursor_character_index));
+	}
 	const float alignment_offset = GetAlignmentSpecificTextOffset(line);
 
 	cursor_position = {
@@ -1462,6 +1485,8 @@ void WidgetTextInput::UpdateCursorPosition(bool update_ideal_cursor_position)
 
 	if (update_ideal_cursor_position)
 		ideal_cursor_position = cursor_position.x;
+
+	parent->DirtyRender();
 }
 
 bool WidgetTextInput::UpdateSelection(bool selecting)
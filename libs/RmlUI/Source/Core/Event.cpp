@@ -32,6 +32,35 @@
 
 namespace Rml {
 
+static const String key_modifier_names[] = {"ctrl_key", "shift_key", "alt_key", "meta_key", "caps_lock_key", "num_lock_key", "scroll_lock_key"};
+
+void EventParameters::ToDictionary(Dictionary& dictionary) const
+{
+	if (flags & Mouse)
+	{
+		dictionary["mouse_x"] = mouse_position.x;
+		dictionary["mouse_y"] = mouse_position.y;
+	}
+	if (flags & Button)
+		dictionary["button"] = button;
+	if (flags & Key)
+		dictionary["key_identifier"] = (int)key_identifier;
+	if (flags & KeyModifiers)
+	{
+		for (int i = 0; i < 7; i++)
+			dictionary[key_modifier_names[i]] = (int)((key_modifier_state & (1 << i)) > 0);
+	}
+	if (flags & Drag)
+		dictionary["drag_element"] = (void*)drag_element;
+	if (flags & Wheel)
+	{
+		dictionary["wheel_delta_x"] = wheel_delta.x;
+		dictionary["wheel_delta_y"] = wheel_delta.y;
+	}
+	if (flags & Autoscroll)
+		dictionary["autoscroll"] = true;
+}
+
 Event::Event() {}
 
 Event::Event(Element* _target_element, EventId id, const String& type, const Dictionary& _parameters, bool interruptible) :
@@ -44,6 +73,18 @@ Event::Event(Element* _target_element, EventId id, const String& type, const Dic
 		has_mouse_position = true;
 		mouse_x->GetInto(mouse_screen_position.x);
 		mouse_y->GetInto(mouse_screen_position.y);
+		mouse_position = mouse_screen_position;
+	}
+}
+
+Event::Event(Element* _target_element, EventId id, const String& type, const EventParameters& _parameters, bool interruptible) :
+	target_element(_target_element), type(type), id(id), interruptible(interruptible), has_typed_parameters(true), typed_parameters(_parameters)
+{
+	if (typed_parameters.flags & EventParameters::Mouse)
+	{
+		has_mouse_position = true;
+		mouse_screen_position = Vector2f(typed_parameters.mouse_position);
+		mouse_position = mouse_screen_position;
 	}
 }
 
@@ -127,6 +168,16 @@ void Event::StopImmediatePropagation()
 
 const Dictionary& Event::GetParameters() const
 {
+	if (has_typed_parameters && !typed_parameters_generated)
+	{
+		typed_parameters_generated = true;
+		typed_parameters.ToDictionary(parameters);
+		if (mouse_position_projected)
+		{
+			parameters["mouse_x"] = mouse_position.x;
+			parameters["mouse_y"] = mouse_position.y;
+		}
+	}
 	return parameters;
 }
 
@@ -135,6 +186,39 @@ Vector2f Event::GetUnprojectedMouseScreenPos() const
 	return mouse_screen_position;
 }
 
+Vector2f Event::GetMousePosition() const
+{
+	return mouse_position;
+}
+
+int Event::GetMouseButton() const
+{
+	if (has_typed_parameters)
+		return (typed_parameters.flags & EventParameters::Button) ? typed_parameters.button : -1;
+	return Get(parameters, "button", -1);
+}
+
+Input::KeyIdentifier Event::GetKeyIdentifier() const
+{
+	if (has_typed_parameters)
+		return (typed_parameters.flags & EventParameters::Key) ? typed_parameters.key_identifier : Input::KI_UNKNOWN;
+	return (Input::KeyIdentifier)Get(parameters, "key_identifier", (int)Input::KI_UNKNOWN);
+}
+
+int Event::GetKeyModifierState() const
+{
+	if (has_typed_parameters)
+		return (typed_parameters.flags & EventParameters::KeyModifiers) ? typed_parameters.key_modifier_state : 0;
+
+	int key_modifier_state = 0;
+	for (int i = 0; i < 7; i++)
+	{
+		if (Get(parameters, key_modifier_names[i], 0) > 0)
+			key_modifier_state |= (1 << i);
+	}
+	return key_modifier_state;
+}
+
 void Event::Release()
 {
 	if (instancer)
@@ -152,34 +236,34 @@ void Event::ProjectMouse(Element* element)
 {
 	if (!element)
 	{
-		parameters["mouse_x"] = mouse_screen_position.x;
-		parameters["mouse_y"] = mouse_screen_position.y;
+		SetMousePosition(mouse_screen_position);
 		return;
 	}
 
 	// Only need to project mouse position if element has a transform state
 	if (element->GetTransformState())
 	{
-		// Project mouse from parent (previous 'mouse_x/y' property) to child (element)
-		Variant* mouse_x = GetIf(parameters, "mouse_x");
-		Variant* mouse_y = GetIf(parameters, "mouse_y");
-		if (!mouse_x || !mouse_y)
-		{
-			RMLUI_ERROR;
-			return;
-		}
-
 		Vector2f projected_position = mouse_screen_position;
 
 		// Not sure how best to handle the case where the projection fails.
 		if (element->Project(projected_position))
-		{
-			*mouse_x = projected_position.x;
-			*mouse_y = projected_position.y;
-		}
+			SetMousePosition(projected_position);
 		else
 			StopPropagation();
 	}
 }
 
+void Event::SetMousePosition(Vector2f position)
+{
+	mouse_position = position;
+	mouse_position_projected = true;
+
+	// Typed parameters are written to the dictionary once it is generated.
+	if (has_typed_parameters && !typed_parameters_generated)
+		return;
+
+	parameters["mouse_x"] = position.x;
+	parameters["mouse_y"] = position.y;
+}
+
 } // namespace Rml
@@ -27,6 +27,7 @@
  */
 
 #include "EventDispatcher.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/EventListener.h"
@@ -100,40 +101,59 @@ void EventDispatcher::DetachAllEvents()
 		element->GetChild(i)->GetEventDispatcher()->DetachAllEvents();
 }
 
-/*
-    CollectedListener
-
-    When dispatching an event we collect all possible event listeners to execute.
-    They are stored in observer pointers, so that we can safely check if they have been destroyed since the previous listener execution.
-*/
-struct CollectedListener {
-	CollectedListener(Element* _element, EventListener* _listener, int dom_distance_from_target, bool in_capture_phase) :
-		element(_element->GetObserverPtr()), listener(_listener->GetObserverPtr())
+CollectedListener::CollectedListener(Element* _element, EventListener* _listener, int dom_distance_from_target, bool in_capture_phase) :
+	element(_element->GetObserverPtr()), listener(_listener->GetObserverPtr())
+{
+	sort = dom_distance_from_target * (in_capture_phase ? -1 : 1);
+}
+
+UniquePtr<EventDispatchBuffers> EventDispatcher::AcquireBuffers(Context* context)
+{
+	if (context && !context->event_dispatch_buffers.empty())
 	{
-		sort = dom_distance_from_target * (in_capture_phase ? -1 : 1);
+		UniquePtr<EventDispatchBuffers> buffers = std::move(context->event_dispatch_buffers.back());
+		context->event_dispatch_buffers.pop_back();
+		return buffers;
 	}
+	return MakeUnique<EventDispatchBuffers>();
+}
 
-	// The sort value is determined by the distance of the element to the target element in the DOM.
-	// Capture phase is given negative values.
-	int sort = 0;
+void EventDispatcher::ReleaseBuffers(UniquePtr<EventDispatchBuffers> buffers, const ObserverPtr<Element>& target_element)
+{
+	buffers->listeners.clear();
+	buffers->default_action_elements.clear();
 
-	ObserverPtr<Element> element;
-	ObserverPtr<EventListener> listener;
+	if (Element* element = target_element.get())
+	{
+		if (Context* context = element->GetContext())
+			context->event_dispatch_buffers.push_back(std::move(buffers));
+	}
+}
 
-	// Default actions are returned by EventPhase::None.
-	EventPhase GetPhase() const { return sort < 0 ? EventPhase::Capture : (sort == 0 ? EventPhase::Target : EventPhase::Bubble); }
+bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, const String& type, const Dictionary& parameters,
+	const bool interruptible, const bool bubbles, const DefaultActionPhase default_action_phase)
+{
+	return DispatchEventImpl(target_element, id, type, parameters, interruptible, bubbles, default_action_phase);
+}
 
-	bool operator<(const CollectedListener& other) const { return sort < other.sort; }
-};
+bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, const String& type, const EventParameters& parameters,
+	const bool interruptible, const bool bubbles, const DefaultActionPhase default_action_phase)
+{
+	return DispatchEventImpl(target_element, id, type, parameters, interruptible, bubbles, default_action_phase);
+}
 
-bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, const String& type, const Dictionary& parameters,
+template <typename Parameters>
+bool EventDispatcher::DispatchEventImpl(Element* target_element, const EventId id, const String& type, const Parameters& parameters,
 	const bool interruptible, const bool bubbles, const DefaultActionPhase default_action_phase)
 {
 	RMLUI_ASSERTMSG(!((int)default_action_phase & (int)EventPhase::Capture),
 		"We assume here that the default action phases cannot include capture phase.");
 
-	Vector<CollectedListener> listeners;
-	Vector<ObserverPtr<Element>> default_action_elements;
+	const ObserverPtr<Element> target_element_observer = target_element->GetObserverPtr();
+	UniquePtr<EventDispatchBuffers> buffers = AcquireBuffers(target_element->GetContext());
+
+	Vector<CollectedListener>& listeners = buffers->listeners;
+	Vector<ObserverPtr<Element>>& default_action_elements = buffers->default_action_elements;
 
 	const EventPhase phases_to_execute = EventPhase((int)EventPhase::Capture | (int)EventPhase::Target | (bubbles ? (int)EventPhase::Bubble : 0));
 
@@ -160,15 +180,23 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 	}
 
 	if (listeners.empty() && default_action_elements.empty())
+	{
+		ReleaseBuffers(std::move(buffers), target_element_observer);
 		return true;
+	}
 
-	// Use stable_sort so that the order of the listeners in a given element is maintained.
-	std::stable_sort(listeners.begin(), listeners.end());
+	// Use a stable sort so that the order of the listeners in a given element is maintained. The listeners are mostly sorted
+	// already, so use insertion sort which also avoids the temporary allocation made by std::stable_sort.
+	for (auto it = listeners.begin(); it != listeners.end(); ++it)
+		std::rotate(std::upper_bound(listeners.begin(), it, *it), it, it + 1);
 
 	// Instance event
 	EventPtr event = Factory::InstanceEvent(target_element, id, type, parameters, interruptible);
 	if (!event)
+	{
+		ReleaseBuffers(std::move(buffers), target_element_observer);
 		return false;
+	}
 
 	auto previous_sort_value = std::numeric_limits<int>::max();
 
@@ -214,6 +242,8 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 
 	bool propagating = event->IsPropagating();
 
+	ReleaseBuffers(std::move(buffers), target_element_observer);
+
 	return propagating;
 }
 
@@ -30,13 +30,14 @@
 #define RMLUI_CORE_EVENTDISPATCHER_H
 
 #include "../../Include/RmlUi/Core/Event.h"
+#include "../../Include/RmlUi/Core/ObserverPtr.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
 namespace Rml {
 
+class Context;
 class Element;
 class EventListener;
-struct CollectedListener;
 
 struct EventListenerEntry {
 	EventListenerEntry(const EventId id, EventListener* listener, const bool in_capture_phase) :
@@ -48,6 +49,37 @@ struct EventListenerEntry {
 	EventListener* listener;
 };
 
+/**
+    CollectedListener
+
+    When dispatching an event we collect all possible event listeners to execute.
+    They are stored in observer pointers, so that we can safely check if they have been destroyed since the previous listener execution.
+*/
+struct CollectedListener {
+	CollectedListener(Element* element, EventListener* listener, int dom_distance_from_target, bool in_capture_phase);
+
+	// The sort value is determined by the distance of the element to the target element in the DOM.
+	// Capture phase is given negative values.
+	int sort = 0;
+
+	ObserverPtr<Element> element;
+	ObserverPtr<EventListener> listener;
+
+	// Default actions are returned by EventPhase::None.
+	EventPhase GetPhase() const { return sort < 0 ? EventPhase::Capture : (sort == 0 ? EventPhase::Target : EventPhase::Bubble); }
+
+	bool operator<(const CollectedListener& other) const { return sort < other.sort; }
+};
+
+/**
+    Buffers used while dispatching an event. They are held by the context between dispatches so that their memory can be
+    reused, each nested dispatch takes its own set of buffers.
+*/
+struct EventDispatchBuffers {
+	Vector<CollectedListener> listeners;
+	Vector<ObserverPtr<Element>> default_action_elements;
+};
+
 /**
     The Event Dispatcher manages a list of event listeners and triggers the events via EventHandlers
     whenever requested.
@@ -90,6 +122,9 @@ public:
 	/// @return True if the event was not consumed (ie, was prevented from propagating by an element), false if it was.
 	static bool DispatchEvent(Element* target_element, EventId id, const String& type, const Dictionary& parameters, bool interruptible, bool bubbles,
 		DefaultActionPhase default_action_phase);
+	/// Dispatches the specified event with typed parameters.
+	static bool DispatchEvent(Element* target_element, EventId id, const String& type, const EventParameters& parameters, bool interruptible,
+		bool bubbles, DefaultActionPhase default_action_phase);
 
 	/// Returns event types with number of listeners for debugging.
 	/// @return Summary of attached listeners.
@@ -105,6 +140,16 @@ private:
 
 	// Collect all the listeners from this dispatcher that are allowed to execute given the input arguments.
 	void CollectListeners(int dom_distance_from_target, EventId event_id, EventPhase phases_to_execute, Vector<CollectedListener>& collect_listeners);
+
+	// Takes a set of buffers from the given context, or creates new ones if none are available.
+	static UniquePtr<EventDispatchBuffers> AcquireBuffers(Context* context);
+	// Returns the buffers to the context of the target element for reuse. The context is looked up again since the target
+	// element may have been moved or destroyed during dispatch.
+	static void ReleaseBuffers(UniquePtr<EventDispatchBuffers> buffers, const ObserverPtr<Element>& target_element);
+
+	template <typename Parameters>
+	static bool DispatchEventImpl(Element* target_element, EventId id, const String& type, const Parameters& parameters, bool interruptible,
+		bool bubbles, DefaultActionPhase default_action_phase);
 };
 
 } // namespace Rml
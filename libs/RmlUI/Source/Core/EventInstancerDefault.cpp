@@ -31,18 +31,23 @@
 
 namespace Rml {
 
-EventInstancerDefault::EventInstancerDefault() {}
+EventInstancerDefault::EventInstancerDefault() : event_pool(16, true) {}
 
 EventInstancerDefault::~EventInstancerDefault() {}
 
 EventPtr EventInstancerDefault::InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible)
 {
-	return EventPtr(new Event(target, id, type, parameters, interruptible));
+	return EventPtr(event_pool.AllocateAndConstruct(target, id, type, parameters, interruptible));
+}
+
+EventPtr EventInstancerDefault::InstanceEvent(Element* target, EventId id, const String& type, const EventParameters& parameters, bool interruptible)
+{
+	return EventPtr(event_pool.AllocateAndConstruct(target, id, type, parameters, interruptible));
 }
 
 void EventInstancerDefault::ReleaseEvent(Event* event)
 {
-	delete event;
+	event_pool.DestroyAndDeallocate(event);
 }
 
 void EventInstancerDefault::Release()
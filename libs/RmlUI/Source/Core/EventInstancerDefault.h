@@ -29,13 +29,16 @@
 #ifndef RMLUI_CORE_EVENTINSTANCERDEFAULT_H
 #define RMLUI_CORE_EVENTINSTANCERDEFAULT_H
 
+#include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/EventInstancer.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "Pool.h"
 
 namespace Rml {
 
 /**
-    Default instancer for instancing events.
+    Default instancer for instancing events. Events are allocated from a pool, so that dispatching them does not require
+    any heap allocations once the pool has grown to fit the deepest nesting of events.
 
     @author Lloyd Weehuizen
  */
@@ -52,6 +55,8 @@ public:
 	/// @param[in] parameters Additional parameters for this event.
 	/// @param[in] interruptible If the event propagation can be stopped.
 	EventPtr InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible) override;
+	/// Instance an event object from typed parameters.
+	EventPtr InstanceEvent(Element* target, EventId id, const String& type, const EventParameters& parameters, bool interruptible);
 
 	/// Releases an event instanced by this instancer.
 	/// @param[in] event The event to release.
@@ -59,6 +64,9 @@ public:
 
 	/// Releases this event instancer.
 	void Release() override;
+
+private:
+	Pool<Event> event_pool;
 };
 
 } // namespace Rml
@@ -275,6 +275,9 @@ void Factory::Initialise()
 	RegisterDataViewInstancer(&default_instancers.structural_data_view_for, "for",     true );
 	// clang-format on
 
+	// Virtualized lists are declared with the 'for' view and the 'virtual' modifier, they need their contents as raw RML too.
+	factory_data->structural_data_view_attribute_names.emplace("data-for-virtual");
+
 	// Data binding controllers
 	RegisterDataControllerInstancer(&default_instancers.data_controller_value, "checked");
 	RegisterDataControllerInstancer(&default_instancers.data_controller_event, "event");
@@ -568,6 +571,26 @@ EventPtr Factory::InstanceEvent(Element* target, EventId id, const String& type,
 	return event;
 }
 
+EventPtr Factory::InstanceEvent(Element* target, EventId id, const String& type, const EventParameters& parameters, bool interruptible)
+{
+	EventPtr event;
+	if (event_instancer == factory_data->default_instancers.event_default.get())
+	{
+		event = static_cast<EventInstancerDefault*>(event_instancer)->InstanceEvent(target, id, type, parameters, interruptible);
+	}
+	else
+	{
+		// Custom instancers only know about dictionaries, generate it here.
+		Dictionary dictionary;
+		parameters.ToDictionary(dictionary);
+		event = event_instancer->InstanceEvent(target, id, type, dictionary, interruptible);
+	}
+
+	if (event)
+		event->instancer = event_instancer;
+	return event;
+}
+
 void Factory::RegisterEventListenerInstancer(EventListenerInstancer* instancer)
 {
 	event_listener_instancer = instancer;
@@ -114,6 +114,13 @@ void FontEffectBlur::GenerateGlyphTexture(byte* destination_data, const Vector2i
 	FillColorValuesFromAlpha(destination_data, destination_dimensions, destination_stride);
 }
 
+bool FontEffectBlur::GetDistanceFieldParameters(DistanceFieldParameters& parameters) const
+{
+	// Approximate the Gaussian blur by a gradient spanning about the same width.
+	parameters.softness = 2.f * float(width);
+	return true;
+}
+
 FontEffectBlurInstancer::FontEffectBlurInstancer() : id_width(PropertyId::Invalid), id_color(PropertyId::Invalid)
 {
 	id_width = RegisterProperty("width", "1px", true).AddParser("length").GetId();
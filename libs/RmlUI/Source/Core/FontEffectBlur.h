@@ -52,6 +52,8 @@ public:
 
 	void GenerateGlyphTexture(byte* destination_data, Vector2i destination_dimensions, int destination_stride, const FontGlyph& glyph) const override;
 
+	bool GetDistanceFieldParameters(DistanceFieldParameters& parameters) const override;
+
 private:
 	int width;
 	ConvolutionFilter filter_x, filter_y;
@@ -144,6 +144,15 @@ void FontEffectGlow::GenerateGlyphTexture(byte* destination_data, const Vector2i
 	FillColorValuesFromAlpha(destination_data, destination_dimensions, destination_stride);
 }
 
+bool FontEffectGlow::GetDistanceFieldParameters(DistanceFieldParameters& parameters) const
+{
+	// Approximate the Gaussian blur by a gradient spanning about the same width.
+	parameters.dilation = float(width_outline);
+	parameters.softness = 2.f * float(width_blur);
+	parameters.offset = Vector2f(offset);
+	return true;
+}
+
 FontEffectGlowInstancer::FontEffectGlowInstancer() :
 	id_width_outline(PropertyId::Invalid), id_width_blur(PropertyId::Invalid), id_color(PropertyId::Invalid)
 {
@@ -97,6 +97,12 @@ void FontEffectOutline::GenerateGlyphTexture(byte* destination_data, const Vecto
 	FillColorValuesFromAlpha(destination_data, destination_dimensions, destination_stride);
 }
 
+bool FontEffectOutline::GetDistanceFieldParameters(DistanceFieldParameters& parameters) const
+{
+	parameters.dilation = float(width);
+	return true;
+}
+
 FontEffectOutlineInstancer::FontEffectOutlineInstancer() : id_width(PropertyId::Invalid), id_color(PropertyId::Invalid)
 {
 	id_width = RegisterProperty("width", "1px", true).AddParser("length").GetId();
@@ -58,6 +58,12 @@ bool FontEffectShadow::GetGlyphMetrics(Vector2i& origin, Vector2i& /*dimensions*
 	return true;
 }
 
+bool FontEffectShadow::GetDistanceFieldParameters(DistanceFieldParameters& parameters) const
+{
+	parameters.offset = Vector2f(offset);
+	return true;
+}
+
 FontEffectShadowInstancer::FontEffectShadowInstancer() :
 	id_offset_x(PropertyId::Invalid), id_offset_y(PropertyId::Invalid), id_color(PropertyId::Invalid)
 {
@@ -79,6 +79,13 @@ int FontEngineInterfaceDefault::GetStringWidth(FontFaceHandle handle, StringView
 	return handle_default->GetStringWidth(string, text_shaping_context.letter_spacing, prior_character);
 }
 
+void FontEngineInterfaceDefault::GetStringPrefixWidths(FontFaceHandle handle, StringView string, const TextShapingContext& text_shaping_context,
+	Character prior_character, Vector<int>& prefix_widths)
+{
+	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
+	handle_default->GetStringPrefixWidths(string, text_shaping_context.letter_spacing, prior_character, prefix_widths);
+}
+
 int FontEngineInterfaceDefault::GenerateString(RenderManager& render_manager, FontFaceHandle handle, FontEffectsHandle font_effects_handle,
 	StringView string, Vector2f position, ColourbPremultiplied colour, float opacity, const TextShapingContext& text_shaping_context,
 	TexturedMeshList& mesh_list)
@@ -61,6 +61,10 @@ public:
 	/// Returns the width a string will take up if rendered with this handle.
 	int GetStringWidth(FontFaceHandle handle, StringView string, const TextShapingContext& text_shaping_context, Character prior_character) override;
 
+	/// Returns the width of every leading part of a string.
+	void GetStringPrefixWidths(FontFaceHandle handle, StringView string, const TextShapingContext& text_shaping_context, Character prior_character,
+		Vector<int>& prefix_widths) override;
+
 	/// Generates the geometry required to render a single line of text.
 	int GenerateString(RenderManager& render_manager, FontFaceHandle face_handle, FontEffectsHandle effects_handle, StringView string,
 		Vector2f position, ColourbPremultiplied colour, float opacity, const TextShapingContext& text_shaping_context,
@@ -29,10 +29,14 @@
 #include "FontFace.h"
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "FontFaceHandleDefault.h"
+#include "FontProvider.h"
 #include "FreeTypeInterface.h"
 
 namespace Rml {
 
+// Distance fields are rendered at this size, and scaled to the size of each handle.
+static constexpr int DistanceFieldReferenceSize = 48;
+
 FontFace::FontFace(FontFaceHandleFreetype _face, Style::FontStyle _style, Style::FontWeight _weight)
 {
 	style = _style;
@@ -71,7 +75,19 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 
 	// Construct and initialise the new handle.
 	auto handle = MakeUnique<FontFaceHandleDefault>();
-	if (!handle->Initialize(face, size, load_default_glyphs))
+
+	bool initialized = false;
+	if (FontProvider::IsDistanceFieldGlyphsEnabled() && FreeType::SupportsDistanceField(face))
+	{
+		if (FontFaceHandleDefault* distance_field_source = GetDistanceFieldHandle(load_default_glyphs))
+			initialized = handle->Initialize(face, size, load_default_glyphs, GlyphRendering::MetricsOnly, distance_field_source);
+	}
+	else
+	{
+		initialized = handle->Initialize(face, size, load_default_glyphs);
+	}
+
+	if (!initialized)
 	{
 		handles[size] = nullptr;
 		return nullptr;
@@ -88,6 +104,21 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 void FontFace::ReleaseFontResources()
 {
 	HandleMap().swap(handles);
+	distance_field_handle.reset();
+}
+
+FontFaceHandleDefault* FontFace::GetDistanceFieldHandle(bool load_default_glyphs)
+{
+	if (!distance_field_handle)
+	{
+		auto handle = MakeUnique<FontFaceHandleDefault>();
+		if (!handle->Initialize(face, DistanceFieldReferenceSize, load_default_glyphs, GlyphRendering::DistanceField))
+			return nullptr;
+
+		distance_field_handle = std::move(handle);
+	}
+
+	return distance_field_handle.get();
 }
 
 } // namespace Rml
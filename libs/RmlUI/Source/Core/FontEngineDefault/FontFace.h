@@ -58,6 +58,9 @@ public:
 	void ReleaseFontResources();
 
 private:
+	// Returns the handle rendering the distance fields shared by all our sized handles, generating it if necessary.
+	FontFaceHandleDefault* GetDistanceFieldHandle(bool load_default_glyphs);
+
 	Style::FontStyle style;
 	Style::FontWeight weight;
 
@@ -65,6 +68,8 @@ private:
 	using HandleMap = UnorderedMap<int, UniquePtr<FontFaceHandleDefault>>;
 	HandleMap handles;
 
+	UniquePtr<FontFaceHandleDefault> distance_field_handle;
+
 	FontFaceHandleFreetype face;
 };
 
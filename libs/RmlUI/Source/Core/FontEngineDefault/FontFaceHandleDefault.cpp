@@ -27,9 +27,12 @@
  */
 
 #include "FontFaceHandleDefault.h"
+#include "../../../Include/RmlUi/Core/Log.h"
 #include "../../../Include/RmlUi/Core/Profiling.h"
+#include "../../../Include/RmlUi/Core/RenderManager.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
-#include "../TextureLayout.h"
+#include "../../../Include/RmlUi/Core/Utilities.h"
+#include "../../../Include/RmlUi/Core/Variant.h"
 #include "FontFaceLayer.h"
 #include "FontProvider.h"
 #include "FreeTypeInterface.h"
@@ -41,6 +44,19 @@ namespace Rml {
 static constexpr char32_t KerningCache_AsciiSubsetBegin = 32;
 static constexpr char32_t KerningCache_AsciiSubsetLast = 126;
 
+// Measured runs are cached up to this many per handle. Longer strings are measured directly without being cached.
+static constexpr size_t RunCache_MaxSize = 512;
+static constexpr size_t RunCache_MaxStringLength = 256;
+
+static size_t HashString(StringView string)
+{
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ull;
+	for (const char* p = string.begin(); p != string.end(); ++p)
+		hash = (hash ^ uint64_t(static_cast<unsigned char>(*p))) * 1099511628211ull;
+	return size_t(hash);
+}
+
 FontFaceHandleDefault::FontFaceHandleDefault()
 {
 	base_layer = nullptr;
@@ -54,13 +70,18 @@ FontFaceHandleDefault::~FontFaceHandleDefault()
 	layers.clear();
 }
 
-bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs)
+bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs, GlyphRendering _rendering,
+	FontFaceHandleDefault* _distance_field_source)
 {
 	ft_face = face;
+	rendering = _rendering;
+	distance_field_source = _distance_field_source;
 
 	RMLUI_ASSERTMSG(layer_configurations.empty(), "Initialize must only be called once.");
+	RMLUI_ASSERTMSG((rendering == GlyphRendering::MetricsOnly) == (distance_field_source != nullptr),
+		"Handles only rendering glyph metrics must render from a distance field source.");
 
-	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, load_default_glyphs))
+	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, load_default_glyphs, rendering))
 		return false;
 
 	has_kerning = FreeType::HasKerning(ft_face);
@@ -87,6 +108,18 @@ int FontFaceHandleDefault::GetStringWidth(StringView string, float letter_spacin
 {
 	RMLUI_ZoneScoped;
 
+	if (string.size() <= RunCache_MaxStringLength)
+	{
+		const TextRun& run = GetOrCreateRun(string, letter_spacing);
+		int width = run.prefix_widths.back();
+		if (run.first_glyph_index >= 0)
+		{
+			bool has_set_size = false;
+			width += GetKerning(prior_character, run.first_glyph_character, has_set_size);
+		}
+		return Math::Max(width, 0);
+	}
+
 	bool has_set_size = false;
 	int width = 0;
 	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
@@ -110,6 +143,101 @@ int FontFaceHandleDefault::GetStringWidth(StringView string, float letter_spacin
 	return Math::Max(width, 0);
 }
 
+void FontFaceHandleDefault::GetStringPrefixWidths(StringView string, float letter_spacing, Character prior_character, Vector<int>& prefix_widths)
+{
+	RMLUI_ZoneScoped;
+
+	TextRun uncached_run;
+	const TextRun* run = &uncached_run;
+	if (string.size() <= RunCache_MaxStringLength)
+		run = &GetOrCreateRun(string, letter_spacing);
+	else
+		MeasureRun(string, letter_spacing, uncached_run);
+
+	int kerning = 0;
+	if (run->first_glyph_index >= 0)
+	{
+		bool has_set_size = false;
+		kerning = GetKerning(prior_character, run->first_glyph_character, has_set_size);
+	}
+
+	const int num_prefixes = (int)run->prefix_widths.size();
+	prefix_widths.resize(num_prefixes);
+	for (int i = 0; i < num_prefixes; i++)
+		prefix_widths[i] = Math::Max(run->prefix_widths[i] + (run->first_glyph_index >= 0 && i > run->first_glyph_index ? kerning : 0), 0);
+}
+
+void FontFaceHandleDefault::MeasureRun(StringView string, float letter_spacing, TextRun& run)
+{
+	run.letter_spacing = letter_spacing;
+	run.first_glyph_index = -1;
+	run.first_glyph_character = Character::Null;
+	run.prefix_widths.clear();
+	run.prefix_widths.push_back(0);
+
+	bool has_set_size = false;
+	int width = 0;
+	int index = 0;
+	Character prior_character = Character::Null;
+	for (auto it_string = StringIteratorU8(string); it_string; ++it_string, ++index)
+	{
+		Character character = *it_string;
+
+		if (const FontGlyph* glyph = GetOrAppendGlyph(character))
+		{
+			if (run.first_glyph_index < 0)
+			{
+				run.first_glyph_index = index;
+				run.first_glyph_character = character;
+			}
+
+			width += GetKerning(prior_character, character, has_set_size);
+			width += glyph->advance;
+			width += (int)letter_spacing;
+
+			prior_character = character;
+		}
+
+		run.prefix_widths.push_back(width);
+	}
+}
+
+const FontFaceHandleDefault::TextRun& FontFaceHandleDefault::GetOrCreateRun(StringView string, float letter_spacing)
+{
+	run_cache_clock += 1;
+
+	size_t key = HashString(string);
+	Utilities::HashCombine(key, letter_spacing);
+
+	auto it = run_cache.find(key);
+	if (it != run_cache.end() && it->second.letter_spacing == letter_spacing && StringView(it->second.string) == string)
+	{
+		it->second.last_used = run_cache_clock;
+		return it->second;
+	}
+
+	if (it == run_cache.end() && run_cache.size() >= RunCache_MaxSize)
+	{
+		// Discard all runs that have not been used during the latest lookups, this leaves at most half of the cache.
+		const uint64_t cutoff = run_cache_clock - RunCache_MaxSize / 2;
+		for (auto it_evict = run_cache.begin(); it_evict != run_cache.end();)
+		{
+			if (it_evict->second.last_used < cutoff)
+				it_evict = run_cache.erase(it_evict);
+			else
+				++it_evict;
+		}
+	}
+
+	// Either a new entry, or replace the colliding one.
+	TextRun& run = run_cache[key];
+	run.string.assign(string.begin(), string.end());
+	run.last_used = run_cache_clock;
+	MeasureRun(string, letter_spacing, run);
+
+	return run;
+}
+
 int FontFaceHandleDefault::GenerateLayerConfiguration(const FontEffectList& font_effects)
 {
 	if (font_effects.empty())
@@ -173,26 +301,6 @@ int FontFaceHandleDefault::GenerateLayerConfiguration(const FontEffectList& font
 	return (int)(layer_configurations.size() - 1);
 }
 
-bool FontFaceHandleDefault::GenerateLayerTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect,
-	int texture_id, int handle_version) const
-{
-	if (handle_version != version)
-	{
-		RMLUI_ERRORMSG("While generating font layer texture: Handle version mismatch in texture vs font-face.");
-		return false;
-	}
-
-	auto it = std::find_if(layers.begin(), layers.end(), [font_effect](const EffectLayerPair& pair) { return pair.font_effect == font_effect; });
-
-	if (it == layers.end())
-	{
-		RMLUI_ERRORMSG("While generating font layer texture: Layer id not found.");
-		return false;
-	}
-
-	return it->layer->GenerateTexture(texture_data, texture_dimensions, texture_id, glyphs);
-}
-
 int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, TexturedMeshList& mesh_list, StringView string, const Vector2f position,
 	const ColourbPremultiplied colour, const float opacity, const float letter_spacing, const int layer_configuration_index)
 {
@@ -208,6 +316,9 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 	// Fetch the requested configuration and generate the geometry for each one.
 	const LayerConfiguration& layer_configuration = layer_configurations[layer_configuration_index];
 
+	if (distance_field_source)
+		return GenerateDistanceFieldString(render_manager, mesh_list, string, position, colour, opacity, letter_spacing, layer_configuration);
+
 	// Each texture represents one geometry.
 	const int num_geometries = std::accumulate(layer_configuration.begin(), layer_configuration.end(), 0,
 		[](int sum, const FontFaceLayer* layer) { return sum + layer->GetNumTextures(); });
@@ -269,6 +380,111 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 	return Math::Max(line_width, 0);
 }
 
+int FontFaceHandleDefault::GenerateDistanceFieldString(RenderManager& render_manager, TexturedMeshList& mesh_list, StringView string,
+	const Vector2f position, const ColourbPremultiplied colour, const float opacity, const float letter_spacing,
+	const LayerConfiguration& layer_configuration)
+{
+	// All our glyphs are mirrored in the source, render any new ones into its atlas before referencing them.
+	FontFaceHandleDefault* source = distance_field_source;
+	source->UpdateLayersOnDirty();
+
+	FontFaceLayer* source_layer = source->base_layer;
+	const int num_textures = source_layer->GetNumTextures();
+	const float scale = float(metrics.size) / float(source->metrics.size);
+
+	int geometry_index = 0;
+	int line_width = 0;
+	bool has_set_size = false;
+
+	for (const FontFaceLayer* layer : layer_configuration)
+	{
+		// Effects are rendered by the shader from the same distance fields as the base layer, unless they don't support it.
+		const FontEffect* font_effect = layer->GetFontEffect();
+		FontEffect::DistanceFieldParameters parameters;
+		if (font_effect && !font_effect->GetDistanceFieldParameters(parameters))
+			continue;
+
+		const ColourbPremultiplied layer_colour = (layer == base_layer ? colour : layer->GetColour(opacity));
+		const CompiledShader* shader = GetDistanceFieldShader(render_manager, font_effect, parameters);
+
+		if (num_textures == 0)
+			continue;
+
+		if (geometry_index + num_textures > (int)mesh_list.size())
+			mesh_list.resize(geometry_index + num_textures);
+
+		for (int tex_index = 0; tex_index < num_textures; ++tex_index)
+		{
+			mesh_list[geometry_index + tex_index].texture = source_layer->GetTexture(render_manager, tex_index);
+			mesh_list[geometry_index + tex_index].shader = shader;
+		}
+
+		mesh_list[geometry_index].mesh.indices.reserve(string.size() * 6);
+		mesh_list[geometry_index].mesh.vertices.reserve(string.size() * 4);
+
+		line_width = 0;
+		Character prior_character = Character::Null;
+
+		for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
+		{
+			Character character = *it_string;
+
+			const FontGlyph* glyph = GetOrAppendGlyph(character);
+			if (!glyph)
+				continue;
+
+			line_width += GetKerning(prior_character, character, has_set_size);
+
+			// Snap the pen position to whole pixels like bitmap glyphs, their scaled shapes are positioned with sub-pixel precision.
+			const Vector2f glyph_position = Vector2f(position.x + float(line_width), position.y).Round() + parameters.offset;
+			source_layer->GenerateGeometry(&mesh_list[geometry_index], character, glyph_position, layer_colour, scale);
+
+			line_width += glyph->advance;
+			line_width += (int)letter_spacing;
+			prior_character = character;
+		}
+
+		geometry_index += num_textures;
+	}
+
+	return Math::Max(line_width, 0);
+}
+
+const CompiledShader* FontFaceHandleDefault::GetDistanceFieldShader(RenderManager& render_manager, const FontEffect* font_effect,
+	const FontEffect::DistanceFieldParameters& parameters)
+{
+	auto it = std::find_if(distance_field_shaders.begin(), distance_field_shaders.end(), [&](const UniquePtr<DistanceFieldShader>& entry) {
+		return entry->render_manager == &render_manager && entry->font_effect == font_effect;
+	});
+
+	if (it == distance_field_shaders.end())
+	{
+		// The distance field values span the spread on each side of the glyph outline, convert them to pixels at our size.
+		const float distance_scale = 2.f * float(FreeType::DistanceFieldSpread * metrics.size) / float(distance_field_source->metrics.size);
+
+		CompiledShader shader = render_manager.CompileShader("distance-field-text",
+			Dictionary{
+				{"distance_scale", Variant(distance_scale)},
+				{"dilation", Variant(parameters.dilation)},
+				{"softness", Variant(parameters.softness)},
+			});
+
+		if (!shader)
+		{
+			static bool warning_logged = false;
+			if (!warning_logged)
+				Log::Message(Log::LT_WARNING, "Distance field glyphs enabled, but the render interface does not support the 'distance-field-text' shader.");
+			warning_logged = true;
+		}
+
+		distance_field_shaders.push_back(MakeUnique<DistanceFieldShader>(DistanceFieldShader{&render_manager, font_effect, std::move(shader)}));
+		it = distance_field_shaders.end() - 1;
+	}
+
+	const CompiledShader& shader = (*it)->shader;
+	return shader ? &shader : nullptr;
+}
+
 bool FontFaceHandleDefault::UpdateLayersOnDirty()
 {
 	bool result = false;
@@ -295,12 +511,13 @@ bool FontFaceHandleDefault::UpdateLayersOnDirty()
 
 int FontFaceHandleDefault::GetVersion() const
 {
-	return version;
+	// Glyphs added to the distance field source, possibly through other handles, also affect our geometry.
+	return version + (distance_field_source ? distance_field_source->version : 0);
 }
 
 bool FontFaceHandleDefault::AppendGlyph(Character character)
 {
-	bool result = FreeType::AppendGlyph(ft_face, metrics.size, character, glyphs);
+	bool result = FreeType::AppendGlyph(ft_face, metrics.size, character, glyphs, rendering);
 	return result;
 }
 
@@ -379,6 +596,9 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 			}
 
 			is_layers_dirty = true;
+
+			if (distance_field_source)
+				distance_field_source->GetOrAppendGlyph(character, false);
 		}
 		else if (look_in_fallback_fonts)
 		{
@@ -386,7 +606,11 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 			for (int i = 0; i < num_fallback_faces; i++)
 			{
 				FontFaceHandleDefault* fallback_face = FontProvider::GetFallbackFontFace(i, metrics.size);
-				if (!fallback_face || fallback_face == this)
+
+				// Distance field handles can only use fallback glyphs which are also rendered as distance fields.
+				if (fallback_face && rendering == GlyphRendering::DistanceField)
+					fallback_face = fallback_face->distance_field_source;
+				if (!fallback_face || fallback_face == this || (distance_field_source && !fallback_face->distance_field_source))
 					continue;
 
 				const FontGlyph* glyph = fallback_face->GetOrAppendGlyph(character, false);
@@ -396,7 +620,11 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 					auto pair = glyphs.emplace(character, glyph->WeakCopy());
 					it_glyph = pair.first;
 					if (pair.second)
+					{
 						is_layers_dirty = true;
+						if (distance_field_source)
+							distance_field_source->GetOrAppendGlyph(character);
+					}
 					break;
 				}
 			}
@@ -446,6 +674,10 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 	const FontEffect* font_effect = layer->GetFontEffect();
 	bool result = false;
 
+	// Without any rendered glyphs, the layers only describe the effects to apply when rendering from the distance field source.
+	if (distance_field_source)
+		return true;
+
 	if (!font_effect)
 	{
 		result = layer->Generate(this);
@@ -29,6 +29,7 @@
 #ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTFACEHANDLE_H
 #define RMLUI_CORE_FONTENGINEDEFAULT_FONTFACEHANDLE_H
 
+#include "../../../Include/RmlUi/Core/CompiledFilterShader.h"
 #include "../../../Include/RmlUi/Core/FontEffect.h"
 #include "../../../Include/RmlUi/Core/FontGlyph.h"
 #include "../../../Include/RmlUi/Core/FontMetrics.h"
@@ -50,7 +51,11 @@ public:
 	FontFaceHandleDefault();
 	~FontFaceHandleDefault();
 
-	bool Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs);
+	/// Initializes the handle for the given font size.
+	/// @param[in] rendering How to render the glyphs of this handle.
+	/// @param[in] distance_field_source The handle to render glyphs from by scaling its distance fields, when only rendering glyph metrics.
+	bool Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs, GlyphRendering rendering = GlyphRendering::Bitmap,
+		FontFaceHandleDefault* distance_field_source = nullptr);
 
 	const FontMetrics& GetFontMetrics() const;
 
@@ -63,19 +68,16 @@ public:
 	/// @return The width, in pixels, this string will occupy if rendered with this handle.
 	int GetStringWidth(StringView string, float letter_spacing, Character prior_character = Character::Null);
 
+	/// Returns the width of every leading part of a string, see FontEngineInterface::GetStringPrefixWidths().
+	/// @param[in] string The string to measure.
+	/// @param[in] prior_character The optionally-specified character that immediately precedes the string.
+	/// @param[out] prefix_widths Entry 'i' is set to the width of the first 'i' characters of the string.
+	void GetStringPrefixWidths(StringView string, float letter_spacing, Character prior_character, Vector<int>& prefix_widths);
+
 	/// Generates, if required, the layer configuration for a given list of font effects.
 	/// @param[in] font_effects The list of font effects to generate the configuration for.
 	/// @return The index to use when generating geometry using this configuration.
 	int GenerateLayerConfiguration(const FontEffectList& font_effects);
-	/// Generates the texture data for a layer (for the texture database).
-	/// @param[out] texture_data The generated texture data.
-	/// @param[out] texture_dimensions The dimensions of the texture.
-	/// @param[in] font_effect The font effect used for the layer.
-	/// @param[in] texture_id The index of the texture within the layer to generate.
-	/// @param[in] handle_version The version of the handle data. Function returns false if out of date.
-	bool GenerateLayerTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id,
-		int handle_version) const;
-
 	/// Generates the geometry required to render a single line of text.
 	/// @param[in] render_manager The render manager responsible for rendering the string.
 	/// @param[out] mesh_list A list to place the new meshes into.
@@ -93,6 +95,23 @@ public:
 	int GetVersion() const;
 
 private:
+	// A measured string, with the width of each of its prefixes. The widths exclude kerning against any prior character,
+	// which only affects the first character with a glyph.
+	struct TextRun {
+		String string;
+		float letter_spacing = 0.f;
+		int first_glyph_index = -1;
+		Character first_glyph_character = Character::Null;
+		uint64_t last_used = 0;
+		Vector<int> prefix_widths;
+	};
+
+	// Measure the given string into the run.
+	void MeasureRun(StringView string, float letter_spacing, TextRun& run);
+
+	// Return the measured run for the given string, measuring and caching it if not already present.
+	const TextRun& GetOrCreateRun(StringView string, float letter_spacing);
+
 	// Build and append glyph to 'glyphs'
 	bool AppendGlyph(Character character);
 
@@ -128,6 +147,14 @@ private:
 	using LayerConfiguration = Vector<FontFaceLayer*>;
 	using LayerConfigurationList = Vector<LayerConfiguration>;
 
+	// Generates the geometry of a string by scaling the glyphs of the distance field source.
+	int GenerateDistanceFieldString(RenderManager& render_manager, TexturedMeshList& mesh_list, StringView string, Vector2f position,
+		ColourbPremultiplied colour, float opacity, float letter_spacing, const LayerConfiguration& layer_configuration);
+
+	// Returns the shader for rendering distance fields with the given effect parameters, or nullptr if not supported by the render interface.
+	const CompiledShader* GetDistanceFieldShader(RenderManager& render_manager, const FontEffect* font_effect,
+		const FontEffect::DistanceFieldParameters& parameters);
+
 	// The list of all font layers, index by the effect that instanced them.
 	FontFaceLayer* base_layer;
 	FontLayerMap layers;
@@ -140,6 +167,11 @@ private:
 	using KerningPairs = UnorderedMap<AsciiPair, KerningIntType>;
 	KerningPairs kerning_pair_cache;
 
+	// Recently measured strings, indexed by the hash of their string and letter spacing. Bounded by discarding the least
+	// recently used runs whenever the cache is full.
+	UnorderedMap<size_t, TextRun> run_cache;
+	uint64_t run_cache_clock = 0;
+
 	bool has_kerning = false;
 	bool is_layers_dirty = false;
 	int version = 0;
@@ -149,6 +181,19 @@ private:
 
 	FontMetrics metrics;
 
+	GlyphRendering rendering = GlyphRendering::Bitmap;
+
+	// Set when the glyphs are rendered from the distance fields of this handle, then we only hold the glyph metrics ourselves.
+	FontFaceHandleDefault* distance_field_source = nullptr;
+
+	struct DistanceFieldShader {
+		RenderManager* render_manager;
+		const FontEffect* font_effect;
+		CompiledShader shader;
+	};
+	// Shaders are referenced by the generated geometry, thus they are kept at stable addresses.
+	Vector<UniquePtr<DistanceFieldShader>> distance_field_shaders;
+
 	FontFaceHandleFreetype ft_face;
 };
 
@@ -45,208 +45,167 @@ FontFaceLayer::~FontFaceLayer() {}
 
 bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool clone_glyph_origins)
 {
-	// Clear the old layout if it exists.
-	{
-		// @performance: We could be much smarter about this, e.g. such as adding new glyphs to the existing texture layout and textures.
-		// Right now we re-generate the whole thing, including textures.
-		texture_layout = TextureLayout{};
-		character_boxes.clear();
-		textures_owned.clear();
-		textures_ptr = &textures_owned;
-	}
-
 	const FontGlyphMap& glyphs = handle->GetGlyphs();
 
-	// Generate the new layout.
 	if (clone)
 	{
-		// Clone the geometry and textures from the clone layer.
-		character_boxes = clone->character_boxes;
-
 		// Point our textures to the cloned layer's textures.
 		textures_ptr = clone->textures_ptr;
 
-		// Request the effect (if we have one) and adjust the origins as appropriate.
-		if (effect && !clone_glyph_origins)
+		// Clone the geometry of any characters the clone layer has added since we last looked.
+		for (auto& pair : clone->character_boxes)
 		{
-			for (auto& pair : glyphs)
-			{
-				Character character = pair.first;
-				const FontGlyph& glyph = pair.second;
-
-				auto it = character_boxes.find(character);
-				if (it == character_boxes.end())
-				{
-					// This can happen if the layers have been dirtied in FontHandleDefault. We will
-					// probably be regenerated soon, just skip the character for now.
-					continue;
-				}
+			const Character character = pair.first;
+			if (character_boxes.find(character) != character_boxes.end())
+				continue;
 
-				TextureBox& box = it->second;
+			TextureBox box = pair.second;
 
-				Vector2i glyph_origin = Vector2i(box.origin);
-				Vector2i glyph_dimensions = Vector2i(box.dimensions);
+			// Request the effect (if we have one) and adjust the origins as appropriate.
+			if (effect && !clone_glyph_origins)
+			{
+				auto it_glyph = glyphs.find(character);
+				if (it_glyph != glyphs.end())
+				{
+					Vector2i glyph_origin = Vector2i(box.origin);
+					Vector2i glyph_dimensions = Vector2i(box.dimensions);
 
-				if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					box.origin = Vector2f(glyph_origin);
-				else
-					box.texture_index = -1;
+					if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, it_glyph->second))
+						box.origin = Vector2f(glyph_origin);
+					else
+						box.texture_index = -1;
+				}
 			}
+
+			character_boxes[character] = box;
 		}
+
+		return true;
 	}
-	else
+
+	// Lay out only the glyphs that are new to this layer, everything already in the atlas stays where it is.
+	Vector<TextureAtlas::Entry> new_entries;
+	for (auto& pair : glyphs)
 	{
-		// Initialise the texture layout for the glyphs.
-		character_boxes.reserve(glyphs.size());
-		for (auto& pair : glyphs)
-		{
-			Character character = pair.first;
-			const FontGlyph& glyph = pair.second;
+		const Character character = pair.first;
+		if (character_boxes.find(character) != character_boxes.end())
+			continue;
 
-			Vector2i glyph_origin(0, 0);
-			Vector2i glyph_dimensions = glyph.bitmap_dimensions;
+		const FontGlyph& glyph = pair.second;
 
-			// Adjust glyph origin / dimensions for the font effect.
-			if (effect)
-			{
-				if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					continue;
-			}
+		Vector2i glyph_origin(0, 0);
+		Vector2i glyph_dimensions = glyph.bitmap_dimensions;
 
-			TextureBox box;
+		// Adjust glyph origin / dimensions for the font effect. Glyphs without any effect output are still recorded, so
+		// they are not tried again on the next generation.
+		TextureBox box;
+		if (!effect || effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+		{
 			box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
 			box.dimensions = Vector2f(glyph_dimensions);
 
 			RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
 
-			character_boxes[character] = box;
-
-			// Add the character's dimensions into the texture layout engine.
-			texture_layout.AddRectangle((int)character, glyph_dimensions);
+			TextureAtlas::Entry entry;
+			entry.id = (int)character;
+			entry.dimensions = glyph_dimensions;
+			new_entries.push_back(entry);
 		}
 
-		constexpr int max_texture_dimensions = 1024;
+		character_boxes[character] = box;
+	}
 
-		// Generate the texture layout; this will position the glyph rectangles efficiently and
-		// allocate the texture data ready for writing.
-		if (!texture_layout.GenerateLayout(max_texture_dimensions))
-			return false;
+	if (new_entries.empty())
+		return true;
 
-		// Iterate over each rectangle in the layout, copying the glyph data into the rectangle as
-		// appropriate and generating geometry.
-		for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
-		{
-			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-			const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
-			Character character = (Character)rectangle.GetId();
-			RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-			TextureBox& box = character_boxes[character];
-
-			// Set the character's texture index.
-			box.texture_index = rectangle.GetTextureIndex();
-
-			// Generate the character's texture coordinates.
-			box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
-			box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
-			box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
-			box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
-		}
+	const int num_uploaded_textures = texture_atlas.GetNumPages();
+	const bool result = texture_atlas.Insert(new_entries);
 
-		const FontEffect* effect_ptr = effect.get();
-		const int handle_version = handle->GetVersion();
+	// Write the new glyphs into their place in the atlas and generate their texture coordinates.
+	for (const TextureAtlas::Entry& entry : new_entries)
+	{
+		if (entry.page < 0)
+			continue;
 
-		// Generate the textures.
-		for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
-		{
-			const int texture_id = i;
-
-			CallbackTextureFunction texture_callback = [handle, effect_ptr, texture_id, handle_version](
-														   const CallbackTextureInterface& texture_interface) -> bool {
-				Vector2i dimensions;
-				Vector<byte> data;
-				if (!handle->GenerateLayerTexture(data, dimensions, effect_ptr, texture_id, handle_version) || data.empty())
-					return false;
-				if (!texture_interface.GenerateTexture(data, dimensions))
-					return false;
-				return true;
-			};
-
-			static_assert(std::is_nothrow_move_constructible<CallbackTextureSource>::value,
-				"CallbackTextureSource must be nothrow move constructible so that it can be placed in the vector below.");
-
-			textures_owned.emplace_back(std::move(texture_callback));
-		}
-	}
+		const Character character = (Character)entry.id;
+		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
+		TextureBox& box = character_boxes[character];
 
-	return true;
-}
+		box.texture_index = entry.page;
 
-bool FontFaceLayer::GenerateTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs)
-{
-	if (texture_id < 0 || texture_id > texture_layout.GetNumTextures())
-		return false;
+		const Vector2f page_dimensions = Vector2f(texture_atlas.GetPageDimensions(entry.page));
+		box.texcoords[0] = Vector2f(entry.position) / page_dimensions;
+		box.texcoords[1] = Vector2f(entry.position + entry.dimensions) / page_dimensions;
 
-	// Generate the texture data.
-	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture();
-	texture_dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
+		GenerateGlyphTexture(texture_atlas.GetPageData(entry.page, entry.position), texture_atlas.GetPageStride(entry.page), box,
+			glyphs.find(character)->second);
+	}
 
-	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
+	// Pages that may already live on the renderer only get their modified region uploaded.
+	Vector<byte> region_data;
+	for (int i = 0; i < num_uploaded_textures; ++i)
 	{
-		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-		Character character = (Character)rectangle.GetId();
-		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
+		const Rectanglei region = texture_atlas.TakeDirtyRegion(i, region_data);
+		if (region.Valid())
+			textures_owned[i].UpdateTexture(region_data, region);
+	}
 
-		TextureBox& box = character_boxes[character];
+	// New pages are generated in full when first rendered.
+	for (int i = num_uploaded_textures; i < texture_atlas.GetNumPages(); ++i)
+	{
+		texture_atlas.MarkClean(i);
 
-		if (box.texture_index != texture_id)
-			continue;
+		const int texture_id = i;
+		CallbackTextureFunction texture_callback = [this, texture_id](const CallbackTextureInterface& texture_interface) -> bool {
+			return texture_interface.GenerateTexture(texture_atlas.GetPageData(texture_id), texture_atlas.GetPageDimensions(texture_id));
+		};
 
-		auto it = glyphs.find((Character)rectangle.GetId());
-		if (it == glyphs.end())
-			continue;
+		static_assert(std::is_nothrow_move_constructible<CallbackTextureSource>::value,
+			"CallbackTextureSource must be nothrow move constructible so that it can be placed in the vector below.");
 
-		const FontGlyph& glyph = it->second;
+		textures_owned.emplace_back(std::move(texture_callback));
+	}
 
-		if (effect == nullptr)
-		{
-			// Copy the glyph's bitmap data into its allocated texture.
-			if (glyph.bitmap_data)
-			{
-				byte* destination = rectangle.GetTextureData();
-				const byte* source = glyph.bitmap_data;
-				const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+	return result;
+}
 
-				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
-				{
-					switch (glyph.color_format)
-					{
-					case ColorFormat::A8:
-					{
-						// We use premultiplied alpha, so copy the alpha into all four channels.
-						for (int k = 0; k < num_bytes_per_line; ++k)
-							for (int c = 0; c < 4; ++c)
-								destination[k * 4 + c] = source[k];
-					}
-					break;
-					case ColorFormat::RGBA8:
-					{
-						memcpy(destination, source, num_bytes_per_line);
-					}
-					break;
-					}
-
-					destination += rectangle.GetTextureStride();
-					source += num_bytes_per_line;
-				}
-			}
+void FontFaceLayer::GenerateGlyphTexture(byte* destination, const int stride, const TextureBox& box, const FontGlyph& glyph) const
+{
+	if (effect)
+	{
+		effect->GenerateGlyphTexture(destination, Vector2i(box.dimensions), stride, glyph);
+		return;
+	}
+
+	// Copy the glyph's bitmap data into its allocated texture.
+	if (!glyph.bitmap_data)
+		return;
+
+	const byte* source = glyph.bitmap_data;
+	const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+
+	for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+	{
+		switch (glyph.color_format)
+		{
+		case ColorFormat::A8:
+		{
+			// We use premultiplied alpha, so copy the alpha into all four channels.
+			for (int k = 0; k < num_bytes_per_line; ++k)
+				for (int c = 0; c < 4; ++c)
+					destination[k * 4 + c] = source[k];
 		}
-		else
+		break;
+		case ColorFormat::RGBA8:
 		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(box.dimensions), rectangle.GetTextureStride(), glyph);
+			memcpy(destination, source, num_bytes_per_line);
+		}
+		break;
 		}
-	}
 
-	return true;
+		destination += stride;
+		source += num_bytes_per_line;
+	}
 }
 
 const FontEffect* FontFaceLayer::GetFontEffect() const
@@ -33,7 +33,7 @@
 #include "../../../Include/RmlUi/Core/FontGlyph.h"
 #include "../../../Include/RmlUi/Core/Geometry.h"
 #include "../../../Include/RmlUi/Core/MeshUtilities.h"
-#include "../TextureLayout.h"
+#include "../TextureAtlas.h"
 
 namespace Rml {
 
@@ -52,20 +52,14 @@ public:
 	FontFaceLayer(const SharedPtr<const FontEffect>& _effect);
 	~FontFaceLayer();
 
-	/// Generates or re-generates the character and texture data for the layer.
+	/// Generates the character and texture data for any glyphs added to the handle since the last call. Glyphs
+	/// already in the layer keep their place in the atlas, and only the modified parts of its textures are updated.
 	/// @param[in] handle The handle generating this layer.
 	/// @param[in] clone The layer to optionally clone geometry and texture data from.
 	/// @param[in] clone_glyph_origins True to keep the character origins from the cloned layer, false to generate new ones.
 	/// @return True if the layer was generated successfully, false if not.
 	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
 
-	/// Generates the texture data for a layer (for the texture database).
-	/// @param[out] texture_data The generated texture data.
-	/// @param[out] texture_dimensions The dimensions of the texture.
-	/// @param[in] texture_id The index of the texture within the layer to generate.
-	/// @param[in] glyphs The glyphs required by the font face handle.
-	bool GenerateTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs);
-
 	/// Generates the geometry required to render a single character.
 	/// @param[out] mesh_list An array of meshes this layer will write to. It must be at least as big as the number of textures in this layer.
 	/// @param[in] character_code The character to generate geometry for.
@@ -88,6 +82,24 @@ public:
 		MeshUtilities::GenerateQuad(mesh, (position + box.origin).Round(), box.dimensions, colour, box.texcoords[0], box.texcoords[1]);
 	}
 
+	/// Generates the geometry required to render a single character, scaled from the size it was rendered at.
+	/// @param[in] scale The scale of the geometry relative to the rendered glyph, applied around the baseline position.
+	inline void GenerateGeometry(TexturedMesh* mesh_list, const Character character_code, const Vector2f position, const ColourbPremultiplied colour,
+		const float scale) const
+	{
+		auto it = character_boxes.find(character_code);
+		if (it == character_boxes.end())
+			return;
+
+		const TextureBox& box = it->second;
+
+		if (box.texture_index < 0)
+			return;
+
+		Mesh& mesh = mesh_list[box.texture_index].mesh;
+		MeshUtilities::GenerateQuad(mesh, position + box.origin * scale, box.dimensions * scale, colour, box.texcoords[0], box.texcoords[1]);
+	}
+
 	/// Returns the effect used to generate the layer.
 	const FontEffect* GetFontEffect() const;
 
@@ -112,6 +124,9 @@ private:
 		int texture_index = -1;
 	};
 
+	// Writes the glyph's bitmap, or the effect applied to it, into the atlas.
+	void GenerateGlyphTexture(byte* destination, int stride, const TextureBox& box, const FontGlyph& glyph) const;
+
 	using CharacterMap = UnorderedMap<Character, TextureBox>;
 	using TextureList = Vector<CallbackTextureSource>;
 
@@ -120,7 +135,7 @@ private:
 	TextureList textures_owned;
 	TextureList* textures_ptr = &textures_owned;
 
-	TextureLayout texture_layout;
+	TextureAtlas texture_atlas;
 	CharacterMap character_boxes;
 	Colourb colour;
 };
@@ -42,6 +42,9 @@ namespace Rml {
 
 static FontProvider* g_font_provider = nullptr;
 
+// Can be set independently of the provider's lifetime.
+static bool g_distance_field_glyphs = false;
+
 FontProvider::FontProvider()
 {
 	RMLUI_ASSERT(!g_font_provider);
@@ -110,6 +113,16 @@ void FontProvider::ReleaseFontResources()
 		name_family.second->ReleaseFontResources();
 }
 
+void FontProvider::SetDistanceFieldGlyphs(bool enable)
+{
+	g_distance_field_glyphs = enable;
+}
+
+bool FontProvider::IsDistanceFieldGlyphsEnabled()
+{
+	return g_distance_field_glyphs;
+}
+
 bool FontProvider::LoadFontFace(const String& file_name, int face_index, bool fallback_face, Style::FontWeight weight)
 {
 	FileInterface* file_interface = GetFileInterface();
@@ -74,6 +74,10 @@ public:
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	static void ReleaseFontResources();
 
+	/// Enables rendering of glyphs from distance fields shared between all font sizes, applies to handles generated after the change.
+	static void SetDistanceFieldGlyphs(bool enable);
+	static bool IsDistanceFieldGlyphsEnabled();
+
 private:
 	FontProvider();
 	~FontProvider();
@@ -43,6 +43,10 @@ struct FaceVariation {
 	int named_instance_index;
 };
 
+// How the glyphs of a font face handle are rendered. Distance fields are scaled to any font size, while handles rendering from another
+// handle's distance fields only need the metrics of their glyphs.
+enum class GlyphRendering { Bitmap, DistanceField, MetricsOnly };
+
 inline bool operator<(const FaceVariation& a, const FaceVariation& b)
 {
 	if (a.weight == b.weight)
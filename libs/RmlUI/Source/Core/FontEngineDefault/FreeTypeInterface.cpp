@@ -35,15 +35,23 @@
 #include <limits.h>
 #include <string.h>
 #include FT_FREETYPE_H
+#include FT_MODULE_H
 #include FT_MULTIPLE_MASTERS_H
 #include FT_TRUETYPE_TABLES_H
 
+// Distance field rendering was introduced in FreeType 2.11.
+#if FREETYPE_MAJOR > 2 || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11)
+	#define RMLUI_FREETYPE_DISTANCE_FIELD
+#endif
+
 namespace Rml {
 
 static FT_Library ft_library = nullptr;
 
-static bool BuildGlyph(FT_Face ft_face, Character character, FontGlyphMap& glyphs, float bitmap_scaling_factor);
-static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, float bitmap_scaling_factor, bool load_default_glyphs);
+static bool BuildGlyph(FT_Face ft_face, Character character, FontGlyphMap& glyphs, float bitmap_scaling_factor, GlyphRendering rendering);
+static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, float bitmap_scaling_factor, bool load_default_glyphs,
+	GlyphRendering rendering);
+static void GenerateReplacementGlyphBitmap(FontGlyph& glyph, GlyphRendering rendering);
 static void GenerateMetrics(FT_Face ft_face, FontMetrics& metrics, float bitmap_scaling_factor);
 static bool SetFontSize(FT_Face ft_face, int font_size, float& out_bitmap_scaling_factor);
 static void BitmapDownscale(byte* bitmap_new, int new_width, int new_height, const byte* bitmap_source, int width, int height, int pitch,
@@ -66,6 +74,13 @@ bool FreeType::Initialise()
 		return false;
 	}
 
+#ifdef RMLUI_FREETYPE_DISTANCE_FIELD
+	// Applies to both the outline and the bitmap distance field renderers.
+	FT_Int spread = FreeType::DistanceFieldSpread;
+	FT_Property_Set(ft_library, "sdf", "spread", &spread);
+	FT_Property_Set(ft_library, "bsdf", "spread", &spread);
+#endif
+
 	return true;
 }
 
@@ -189,7 +204,19 @@ void FreeType::GetFaceStyle(FontFaceHandleFreetype in_face, String* font_family,
 	}
 }
 
-bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs)
+bool FreeType::SupportsDistanceField(FontFaceHandleFreetype face)
+{
+#ifdef RMLUI_FREETYPE_DISTANCE_FIELD
+	FT_Face ft_face = (FT_Face)face;
+	return FT_IS_SCALABLE(ft_face) && !FT_HAS_COLOR(ft_face);
+#else
+	(void)face;
+	return false;
+#endif
+}
+
+bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs,
+	GlyphRendering rendering)
 {
 	FT_Face ft_face = (FT_Face)face;
 
@@ -200,7 +227,7 @@ bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size,
 		return false;
 
 	// Construct the initial list of glyphs.
-	BuildGlyphMap(ft_face, font_size, glyphs, bitmap_scaling_factor, load_default_glyphs);
+	BuildGlyphMap(ft_face, font_size, glyphs, bitmap_scaling_factor, load_default_glyphs, rendering);
 
 	// Generate the metrics for the handle.
 	GenerateMetrics(ft_face, metrics, bitmap_scaling_factor);
@@ -208,7 +235,7 @@ bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size,
 	return true;
 }
 
-bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs)
+bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs, GlyphRendering rendering)
 {
 	FT_Face ft_face = (FT_Face)face;
 
@@ -220,7 +247,7 @@ bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character
 	if (!SetFontSize(ft_face, font_size, bitmap_scaling_factor))
 		return false;
 
-	if (!BuildGlyph(ft_face, character, glyphs, bitmap_scaling_factor))
+	if (!BuildGlyph(ft_face, character, glyphs, bitmap_scaling_factor, rendering))
 		return false;
 
 	return true;
@@ -260,7 +287,8 @@ bool FreeType::HasKerning(FontFaceHandleFreetype face)
 	return FT_HAS_KERNING(ft_face);
 }
 
-static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const float bitmap_scaling_factor, const bool load_default_glyphs)
+static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const float bitmap_scaling_factor, const bool load_default_glyphs,
+	const GlyphRendering rendering)
 {
 	if (load_default_glyphs)
 	{
@@ -271,7 +299,7 @@ static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const
 		FT_ULong code_max = 126;
 
 		for (FT_ULong character_code = code_min; character_code <= code_max; ++character_code)
-			BuildGlyph(ft_face, (Character)character_code, glyphs, bitmap_scaling_factor);
+			BuildGlyph(ft_face, (Character)character_code, glyphs, bitmap_scaling_factor, rendering);
 	}
 
 	// Add a replacement character for rendering unknown characters.
@@ -284,31 +312,75 @@ static void BuildGlyphMap(FT_Face ft_face, int size, FontGlyphMap& glyphs, const
 		glyph.advance = glyph.bitmap_dimensions.x + 2;
 		glyph.bearing = {1, glyph.bitmap_dimensions.y};
 
+		GenerateReplacementGlyphBitmap(glyph, rendering);
+
+		glyphs[replacement_character] = std::move(glyph);
+	}
+}
+
+static void GenerateReplacementGlyphBitmap(FontGlyph& glyph, const GlyphRendering rendering)
+{
+	constexpr int stroke = 1;
+	const Vector2i box_dimensions = glyph.bitmap_dimensions;
+
+	switch (rendering)
+	{
+	case GlyphRendering::Bitmap:
+	{
+		glyph.bitmap_owned_data.reset(new byte[box_dimensions.x * box_dimensions.y]);
+		glyph.bitmap_data = glyph.bitmap_owned_data.get();
+
+		for (int y = 0; y < box_dimensions.y; y++)
+		{
+			for (int x = 0; x < box_dimensions.x; x++)
+			{
+				int i = y * box_dimensions.x + x;
+				bool near_edge = (x < stroke || x >= box_dimensions.x - stroke || y < stroke || y >= box_dimensions.y - stroke);
+				glyph.bitmap_owned_data[i] = (near_edge ? 0xdd : 0);
+			}
+		}
+	}
+	break;
+	case GlyphRendering::DistanceField:
+	{
+		// Pad the box like the distance fields generated by FreeType, and encode the distance to its stroke in the same way.
+		constexpr int spread = FreeType::DistanceFieldSpread;
+		glyph.bitmap_dimensions = box_dimensions + Vector2i(2 * spread);
+		glyph.bearing += Vector2i(-spread, spread);
+
 		glyph.bitmap_owned_data.reset(new byte[glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y]);
 		glyph.bitmap_data = glyph.bitmap_owned_data.get();
 
+		const Vector2f size = Vector2f(box_dimensions);
 		for (int y = 0; y < glyph.bitmap_dimensions.y; y++)
 		{
 			for (int x = 0; x < glyph.bitmap_dimensions.x; x++)
 			{
-				constexpr int stroke = 1;
-				int i = y * glyph.bitmap_dimensions.x + x;
-				bool near_edge = (x < stroke || x >= glyph.bitmap_dimensions.x - stroke || y < stroke || y >= glyph.bitmap_dimensions.y - stroke);
-				glyph.bitmap_owned_data[i] = (near_edge ? 0xdd : 0);
+				const Vector2f p = Vector2f(float(x - spread), float(y - spread)) + Vector2f(0.5f);
+				const Vector2f outside = {Math::Max(Math::Max(-p.x, p.x - size.x), 0.f), Math::Max(Math::Max(-p.y, p.y - size.y), 0.f)};
+				const float inside = Math::Min(Math::Min(p.x, size.x - p.x), Math::Min(p.y, size.y - p.y));
+				const float distance_to_box = (inside > 0.f ? inside : -outside.Magnitude());
+				const float distance_to_stroke = Math::Absolute(distance_to_box - 0.5f * stroke) - 0.5f * stroke;
+				const float value = 128.f - distance_to_stroke * (128.f / float(spread));
+				glyph.bitmap_owned_data[y * glyph.bitmap_dimensions.x + x] = (byte)Math::Clamp(value, 0.f, 255.f);
 			}
 		}
-
-		glyphs[replacement_character] = std::move(glyph);
+	}
+	break;
+	case GlyphRendering::MetricsOnly: break;
 	}
 }
 
-static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap& glyphs, const float bitmap_scaling_factor)
+static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap& glyphs, const float bitmap_scaling_factor,
+	const GlyphRendering rendering)
 {
 	FT_UInt index = FT_Get_Char_Index(ft_face, (FT_ULong)character);
 	if (index == 0)
 		return false;
 
-	FT_Error error = FT_Load_Glyph(ft_face, index, FT_LOAD_COLOR);
+	// Distance fields are scaled to other sizes, thus they should not be hinted for the size they are rendered at.
+	const FT_Int32 load_flags = (rendering == GlyphRendering::DistanceField ? FT_LOAD_NO_HINTING : FT_LOAD_COLOR);
+	FT_Error error = FT_Load_Glyph(ft_face, index, load_flags);
 	if (error != 0)
 	{
 		Log::Message(Log::LT_WARNING, "Unable to load glyph for character '%u' on the font face '%s %s'; error code: %d.", (unsigned int)character,
@@ -316,7 +388,29 @@ static bool BuildGlyph(FT_Face ft_face, const Character character, FontGlyphMap&
 		return false;
 	}
 
-	error = FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL);
+	// Empty outlines, like spaces, have nothing to render into a distance field.
+	const bool empty_distance_field = (rendering == GlyphRendering::DistanceField && ft_face->glyph->outline.n_points == 0);
+	if (rendering == GlyphRendering::MetricsOnly || empty_distance_field)
+	{
+		auto result = glyphs.emplace(character, FontGlyph{});
+		if (!result.second)
+			return false;
+
+		const FT_Glyph_Metrics& ft_metrics = ft_face->glyph->metrics;
+		FontGlyph& glyph = result.first->second;
+		glyph.bearing = Vector2i(int(ft_metrics.horiBearingX >> 6), int(ft_metrics.horiBearingY >> 6));
+		glyph.advance = int(ft_metrics.horiAdvance >> 6);
+		glyph.bitmap_dimensions = Vector2i(int((ft_metrics.width + 63) >> 6), int((ft_metrics.height + 63) >> 6));
+		return true;
+	}
+
+#ifdef RMLUI_FREETYPE_DISTANCE_FIELD
+	const FT_Render_Mode render_mode = (rendering == GlyphRendering::DistanceField ? FT_RENDER_MODE_SDF : FT_RENDER_MODE_NORMAL);
+#else
+	const FT_Render_Mode render_mode = FT_RENDER_MODE_NORMAL;
+#endif
+
+	error = FT_Render_Glyph(ft_face->glyph, render_mode);
 	if (error != 0)
 	{
 		Log::Message(Log::LT_WARNING, "Unable to render glyph for character '%u' on the font face '%s %s'; error code: %d.", (unsigned int)character,
@@ -36,6 +36,10 @@ namespace Rml {
 
 namespace FreeType {
 
+	// Glyphs rendered as signed distance fields are padded by this many pixels on each side. Their values encode the distance to the glyph
+	// outline linearly, from -spread pixels outside to +spread pixels inside, with the value 128 at the outline.
+	constexpr int DistanceFieldSpread = 12;
+
 	// Initialize FreeType library.
 	bool Initialise();
 	// Shutdown FreeType library.
@@ -53,11 +57,15 @@ namespace FreeType {
 	// Retrieves the font family, style and weight of the given font face. Use nullptr to ignore a property.
 	void GetFaceStyle(FontFaceHandleFreetype face, String* font_family, Style::FontStyle* style, Style::FontWeight* weight);
 
+	// Returns true if the glyphs of the face can be rendered as signed distance fields.
+	bool SupportsDistanceField(FontFaceHandleFreetype face);
+
 	// Initializes a face for a given font size. Glyphs are filled with the ASCII subset, and the font face metrics are set.
-	bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs);
+	bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs,
+		GlyphRendering rendering);
 
 	// Build a new glyph representing the given code point and append to 'glyphs'.
-	bool AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs);
+	bool AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs, GlyphRendering rendering);
 
 	// Returns the kerning between two characters.
 	// 'font_size' value of zero assumes the font size is already set on the face, and skips this step for performance reasons.
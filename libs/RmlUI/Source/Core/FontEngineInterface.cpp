@@ -73,6 +73,18 @@ int FontEngineInterface::GetStringWidth(FontFaceHandle /*handle*/, StringView /*
 	return 0;
 }
 
+void FontEngineInterface::GetStringPrefixWidths(FontFaceHandle handle, StringView string, const TextShapingContext& text_shaping_context,
+	Character prior_character, Vector<int>& prefix_widths)
+{
+	prefix_widths.clear();
+	prefix_widths.push_back(0);
+	for (auto it = StringIteratorU8(string); it;)
+	{
+		++it;
+		prefix_widths.push_back(GetStringWidth(handle, StringView(string.begin(), string.begin() + it.offset()), text_shaping_context, prior_character));
+	}
+}
+
 int FontEngineInterface::GenerateString(RenderManager& /*render_manager*/, FontFaceHandle /*face_handle*/, FontEffectsHandle /*font_effects_handle*/,
 	StringView /*string*/, Vector2f /*position*/, ColourbPremultiplied /*colour*/, float /*opacity*/,
 	const TextShapingContext& /*text_shaping_context*/, TexturedMeshList& /*mesh_list*/)
@@ -25,7 +25,6 @@
  * THE SOFTWARE.
  *
  */
-
 #include "GeometryBoxShadow.h"
 #include "../../Include/RmlUi/Core/Box.h"
 #include "../../Include/RmlUi/Core/CompiledFilterShader.h"
@@ -35,16 +34,263 @@
 #include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/MeshUtilities.h"
 #include "../../Include/RmlUi/Core/RenderManager.h"
+#include "../../Include/RmlUi/Core/Utilities.h"
+#include "ControlledLifetimeResource.h"
 
 namespace Rml {
 
-void GeometryBoxShadow::Generate(Geometry& out_shadow_geometry, CallbackTexture& out_shadow_texture, RenderManager& render_manager, Element* element,
-	Geometry& background_border_geometry, BoxShadowList shadow_list, const CornerSizes border_radius, const float opacity)
+// Nine-slicing is only used when it shrinks the texture by at least this many pixels along an axis.
+static constexpr float nine_slice_min_reduction = 32.f;
+
+// Everything that affects the contents of a box-shadow texture, with all lengths resolved to px. The dp-ratio is captured by the resolved lengths.
+struct BoxShadowTextureKey {
+	RenderManager* render_manager;
+	BoxShadowList shadow_list;
+	Vector<RenderBox> padding_boxes;
+	CornerSizes border_radius;
+	ColourbPremultiplied background_color;
+	ColourbPremultiplied border_colors[4];
+};
+
+static bool operator==(const RenderBox& a, const RenderBox& b)
 {
-	// Find the box-shadow texture dimension and offset required to cover all box-shadows and element boxes combined.
-	Vector2f element_offset_in_texture;
-	Vector2i texture_dimensions;
+	return a.GetFillSize() == b.GetFillSize() && a.GetBorderOffset() == b.GetBorderOffset() && a.GetBorderWidths() == b.GetBorderWidths() &&
+		a.GetBorderRadius() == b.GetBorderRadius();
+}
+
+static bool operator==(const BoxShadowTextureKey& a, const BoxShadowTextureKey& b)
+{
+	return a.render_manager == b.render_manager && a.shadow_list == b.shadow_list && a.padding_boxes == b.padding_boxes &&
+		a.border_radius == b.border_radius && a.background_color == b.background_color && a.border_colors[0] == b.border_colors[0] &&
+		a.border_colors[1] == b.border_colors[1] && a.border_colors[2] == b.border_colors[2] && a.border_colors[3] == b.border_colors[3];
+}
+
+} // namespace Rml
+
+namespace std {
+template <>
+struct hash<::Rml::BoxShadowTextureKey> {
+	size_t operator()(const ::Rml::BoxShadowTextureKey& key) const
+	{
+		using namespace ::Rml;
+		using Utilities::HashCombine;
+		auto HashColour = [](size_t& seed, ColourbPremultiplied colour) {
+			HashCombine(seed, (uint32_t(colour.red) << 24) | (uint32_t(colour.green) << 16) | (uint32_t(colour.blue) << 8) | uint32_t(colour.alpha));
+		};
+
+		size_t seed = Hash<const void*>{}(key.render_manager);
+		for (const BoxShadow& shadow : key.shadow_list)
+		{
+			HashColour(seed, shadow.color);
+			HashCombine(seed, shadow.offset_x.number);
+			HashCombine(seed, shadow.offset_y.number);
+			HashCombine(seed, shadow.blur_radius.number);
+			HashCombine(seed, shadow.spread_distance.number);
+			HashCombine(seed, shadow.inset);
+		}
+		for (const RenderBox& box : key.padding_boxes)
+		{
+			HashCombine(seed, box.GetFillSize().x);
+			HashCombine(seed, box.GetFillSize().y);
+			HashCombine(seed, box.GetBorderOffset().x);
+			HashCombine(seed, box.GetBorderOffset().y);
+			for (float width : box.GetBorderWidths())
+				HashCombine(seed, width);
+		}
+		for (float radius : key.border_radius)
+			HashCombine(seed, radius);
+		HashColour(seed, key.background_color);
+		for (ColourbPremultiplied colour : key.border_colors)
+			HashColour(seed, colour);
+		return seed;
+	}
+};
+} // namespace std
+
+namespace Rml {
+
+struct BoxShadowTextureCache {
+	// Only weak references are held, so that each texture is released as soon as the last element using it lets go of it.
+	UnorderedMap<BoxShadowTextureKey, WeakPtr<CallbackTexture>> textures;
+	size_t purge_size = 64;
+};
+
+static ControlledLifetimeResource<BoxShadowTextureCache> box_shadow_texture_cache;
+
+static RenderBox ToBorderBox(const RenderBox& padding_box)
+{
+	const EdgeSizes border_widths = padding_box.GetBorderWidths();
+	const Vector2f border_size = padding_box.GetFillSize() + Vector2f(border_widths[1] + border_widths[3], border_widths[0] + border_widths[2]);
+	return RenderBox(border_size, padding_box.GetBorderOffset(), EdgeSizes{}, padding_box.GetBorderRadius());
+}
+
+// A single row or column of the nine-slice geometry, mapping a span of the shadow geometry to a span of the texture.
+struct ShadowSlice {
+	float position, size;
+	float texcoord_begin, texcoord_end;
+};
+using ShadowSlices = Vector<ShadowSlice>;
+
+// Returns the slices needed to cover 'full_size' with a texture of 'texture_size', where the texture has been shrunk by 'reduction' pixels by
+// cutting out a uniform span starting at 'split'.
+static ShadowSlices MakeSlices(float full_size, float texture_size, float split, float reduction)
+{
+	if (reduction <= 0.f)
+		return ShadowSlices{{0.f, full_size, 0.f, 1.f}};
+
+	// Stretch the center slice using the middle of a single texel, which we know is surrounded by identical texels.
+	const float split_texcoord = split / texture_size;
+	const float center_texcoord = (split + 0.5f) / texture_size;
+	return ShadowSlices{
+		{0.f, split, 0.f, split_texcoord},
+		{split, reduction, center_texcoord, center_texcoord},
+		{split + reduction, full_size - split - reduction, split_texcoord, 1.f},
+	};
+}
+
+static bool GenerateShadowTexture(const CallbackTextureInterface& texture_interface, const BoxShadowTextureKey& key, Vector2i texture_dimensions,
+	Vector2f element_offset_in_texture)
+{
+	RenderManager& render_manager = texture_interface.GetRenderManager();
+	const BoxShadowList& shadow_list = key.shadow_list;
+
+	Mesh mesh_background_border; // Render geometry for the background and border, rendered opaquely below the shadows.
+	Mesh mesh_padding;           // Render geometry for inner box-shadow.
+	Mesh mesh_padding_border;    // Clipping mask for outer box-shadow.
+
+	bool has_inner_shadow = false;
+	bool has_outer_shadow = false;
+	for (const BoxShadow& shadow : shadow_list)
+	{
+		if (shadow.inset)
+			has_inner_shadow = true;
+		else
+			has_outer_shadow = true;
+	}
+
+	// Generate the geometry for all the element's boxes.
+	for (const RenderBox& padding_box : key.padding_boxes)
+	{
+		ColourbPremultiplied white(255);
+		MeshUtilities::GenerateBackgroundBorder(mesh_background_border, padding_box, key.background_color, key.border_colors);
+		if (has_inner_shadow)
+			MeshUtilities::GenerateBackground(mesh_padding, padding_box, white);
+		if (has_outer_shadow)
+			MeshUtilities::GenerateBackground(mesh_padding_border, ToBorderBox(padding_box), white);
+	}
+
+	const RenderState initial_render_state = render_manager.GetState();
+	render_manager.ResetState();
+	render_manager.SetScissorRegion(Rectanglei::FromSize(texture_dimensions));
+
+	// The scissor region will be clamped to the current window size, check the resulting scissor region.
+	const Rectanglei scissor_region = render_manager.GetScissorRegion();
+	if (scissor_region.Width() <= 0 || scissor_region.Height() <= 0)
+	{
+		// The window may become zero-sized for example when minimized. Just skip the texture generation for now, we
+		// expect to be called again later when the window is restored.
+		render_manager.SetState(initial_render_state);
+		return false;
+	}
+	if (scissor_region != Rectanglei::FromSize(texture_dimensions))
+	{
+		Log::Message(Log::LT_INFO,
+			"The desired box-shadow texture dimensions (%d, %d) are larger than the current window region (%d, %d). Results may be clipped.",
+			texture_dimensions.x, texture_dimensions.y, scissor_region.Width(), scissor_region.Height());
+	}
+
+	render_manager.PushLayer();
+
+	Geometry geometry_background_border = render_manager.MakeGeometry(std::move(mesh_background_border));
+	geometry_background_border.Render(element_offset_in_texture);
+
+	for (int shadow_index = (int)shadow_list.size() - 1; shadow_index >= 0; shadow_index--)
+	{
+		const BoxShadow& shadow = shadow_list[shadow_index];
+		const Vector2f shadow_offset = {shadow.offset_x.number, shadow.offset_y.number};
+		const bool inset = shadow.inset;
+		const float spread_distance = shadow.spread_distance.number;
+		const float blur_radius = shadow.blur_radius.number;
+
+		CornerSizes spread_radii = key.border_radius;
+		for (int i = 0; i < 4; i++)
+		{
+			float& radius = spread_radii[i];
+			float spread_factor = (inset ? -1.f : 1.f);
+			if (radius < spread_distance)
+			{
+				const float ratio_minus_one = (radius / spread_distance) - 1.f;
+				spread_factor *= 1.f + ratio_minus_one * ratio_minus_one * ratio_minus_one;
+			}
+			radius = Math::Max(radius + spread_factor * spread_distance, 0.f);
+		}
+
+		Mesh mesh_shadow;
+
+		// Generate the shadow geometry. For outer box-shadows it is rendered normally, while for inset box-shadows it is used as a clipping mask.
+		for (const RenderBox& padding_box : key.padding_boxes)
+		{
+			const float signed_spread_distance = (inset ? -spread_distance : spread_distance);
+			RenderBox render_box = (inset ? padding_box : ToBorderBox(padding_box));
+			render_box.SetFillSize(Math::Max(render_box.GetFillSize() + Vector2f(2.f * signed_spread_distance), Vector2f{0.001f}));
+			render_box.SetBorderRadius(spread_radii);
+			render_box.SetBorderOffset(render_box.GetBorderOffset() - Vector2f(signed_spread_distance));
+			MeshUtilities::GenerateBackground(mesh_shadow, render_box, shadow.color);
+		}
+
+		CompiledFilter blur;
+		if (blur_radius >= 0.5f)
+		{
+			blur = render_manager.CompileFilter("blur", Dictionary{{"sigma", Variant(0.5f * blur_radius)}});
+			if (blur)
+				render_manager.PushLayer();
+		}
+
+		Geometry geometry_shadow = render_manager.MakeGeometry(std::move(mesh_shadow));
+
+		if (inset)
+		{
+			render_manager.SetClipMask(ClipMaskOperation::SetInverse, &geometry_shadow, shadow_offset + element_offset_in_texture);
+
+			for (Rml::Vertex& vertex : mesh_padding.vertices)
+				vertex.colour = shadow.color;
+
+			// @performance: Don't need to copy the mesh if this is the last use of it.
+			Geometry geometry_padding = render_manager.MakeGeometry(Mesh(mesh_padding));
+			geometry_padding.Render(element_offset_in_texture);
+
+			render_manager.SetClipMask(ClipMaskOperation::Set, &geometry_padding, element_offset_in_texture);
+		}
+		else
+		{
+			Mesh mesh = mesh_padding_border;
+			Geometry geometry_padding_border = render_manager.MakeGeometry(std::move(mesh));
+			render_manager.SetClipMask(ClipMaskOperation::SetInverse, &geometry_padding_border, element_offset_in_texture);
+			geometry_shadow.Render(shadow_offset + element_offset_in_texture);
+		}
+
+		if (blur)
+		{
+			FilterHandleList filters;
+			blur.AddHandleTo(filters);
+			render_manager.CompositeLayers(render_manager.GetTopLayer(), render_manager.GetNextLayer(), BlendMode::Blend, filters);
+			render_manager.PopLayer();
+			blur.Release();
+		}
+	}
+
+	texture_interface.SaveLayerAsTexture();
+
+	render_manager.PopLayer();
+	render_manager.SetState(initial_render_state);
 
+	return true;
+}
+
+void GeometryBoxShadow::Generate(Geometry& out_shadow_geometry, SharedPtr<CallbackTexture>& out_shadow_texture, RenderManager& render_manager,
+	Element* element, BoxShadowList shadow_list, const ColourbPremultiplied background_color, const ColourbPremultiplied border_colors[4],
+	const CornerSizes border_radius, const float opacity)
+{
 	// Resolve all lengths to px units.
 	for (BoxShadow& shadow : shadow_list)
 	{
@@ -54,6 +300,50 @@ void GeometryBoxShadow::Generate(Geometry& out_shadow_geometry, CallbackTexture&
 		shadow.offset_y = NumericValue(element->ResolveLength(shadow.offset_y), Unit::PX);
 	}
 
+	Vector<RenderBox> padding_boxes;
+	padding_boxes.reserve(element->GetNumBoxes());
+	for (int i = 0; i < element->GetNumBoxes(); i++)
+		padding_boxes.push_back(element->GetRenderBox(BoxArea::Padding, i));
+
+	// Distance from each edge of the border box, beyond which the texture is guaranteed to be uniform along that edge. Accounts for anything
+	// that can vary near the corners, with an additional pixel for rounding.
+	float corner_extent = 0.f;
+	{
+		float max_shadow_extent = 0.f;
+		for (const BoxShadow& shadow : shadow_list)
+		{
+			const float offset = Math::Max(Math::Absolute(shadow.offset_x.number), Math::Absolute(shadow.offset_y.number));
+			max_shadow_extent =
+				Math::Max(max_shadow_extent, offset + Math::Absolute(shadow.spread_distance.number) + 1.5f * shadow.blur_radius.number);
+		}
+		float max_border_radius = 0.f;
+		for (float radius : border_radius)
+			max_border_radius = Math::Max(max_border_radius, radius);
+		float max_border_width = 0.f;
+		for (float width : padding_boxes[0].GetBorderWidths())
+			max_border_width = Math::Max(max_border_width, width);
+
+		corner_extent = Math::RoundUp(max_border_radius + max_border_width + max_shadow_extent) + 1.f;
+	}
+
+	// For large single-box elements, shrink the box in the texture by an integer number of pixels so that the pixel grid is unaffected. We keep
+	// at least four uniform texels between the corners, which lets the nine-slice geometry sample the edges without bleeding from the corners.
+	Vector2f reduction;
+	if (padding_boxes.size() == 1)
+	{
+		RenderBox& padding_box = padding_boxes[0];
+		const Vector2f border_size = ToBorderBox(padding_box).GetFillSize();
+		auto GetReduction = [corner_extent](float size) {
+			const float axis_reduction = Math::RoundDown(size - 2.f * corner_extent - 4.f);
+			return axis_reduction >= nine_slice_min_reduction ? axis_reduction : 0.f;
+		};
+		reduction = Vector2f(GetReduction(border_size.x), GetReduction(border_size.y));
+		padding_box.SetFillSize(padding_box.GetFillSize() - reduction);
+	}
+
+	// Find the box-shadow texture dimension and offset required to cover all box-shadows and element boxes combined.
+	Vector2f element_offset_in_texture;
+	Vector2i texture_dimensions;
 	{
 		Vector2f extend_min;
 		Vector2f extend_max;
@@ -73,9 +363,9 @@ void GeometryBoxShadow::Generate(Geometry& out_shadow_geometry, CallbackTexture&
 		Rectanglef texture_region;
 
 		// Extend the render-texture further to cover all the element's boxes.
-		for (int i = 0; i < element->GetNumBoxes(); i++)
+		for (const RenderBox& padding_box : padding_boxes)
 		{
-			const RenderBox box = element->GetRenderBox(BoxArea::Border, i);
+			const RenderBox box = ToBorderBox(padding_box);
 			texture_region = texture_region.Join(Rectanglef::FromPositionSize(box.GetBorderOffset(), box.GetFillSize()));
 		}
 
@@ -86,149 +376,71 @@ void GeometryBoxShadow::Generate(Geometry& out_shadow_geometry, CallbackTexture&
 		texture_dimensions = Vector2i(texture_region.Size());
 	}
 
-	// Callback for generating the box-shadow texture. Using a callback ensures that the texture can be regenerated at any time, for example if the
-	// device loses its GPU context and the client calls Rml::ReleaseTextures().
-	auto texture_callback = [&background_border_geometry, element, border_radius, texture_dimensions, element_offset_in_texture,
-								shadow_list = std::move(shadow_list)](const CallbackTextureInterface& texture_interface) -> bool {
-		RenderManager& render_manager = texture_interface.GetRenderManager();
-
-		Mesh mesh_padding;        // Render geometry for inner box-shadow.
-		Mesh mesh_padding_border; // Clipping mask for outer box-shadow.
-
-		bool has_inner_shadow = false;
-		bool has_outer_shadow = false;
-		for (const BoxShadow& shadow : shadow_list)
-		{
-			if (shadow.inset)
-				has_inner_shadow = true;
-			else
-				has_outer_shadow = true;
-		}
-
-		// Generate the geometry for all the element's boxes and extend the render-texture further to cover all of them.
-		for (int i = 0; i < element->GetNumBoxes(); i++)
-		{
-			ColourbPremultiplied white(255);
-			if (has_inner_shadow)
-				MeshUtilities::GenerateBackground(mesh_padding, element->GetRenderBox(BoxArea::Padding, i), white);
-			if (has_outer_shadow)
-				MeshUtilities::GenerateBackground(mesh_padding_border, element->GetRenderBox(BoxArea::Border, i), white);
-		}
-
-		const RenderState initial_render_state = render_manager.GetState();
-		render_manager.ResetState();
-		render_manager.SetScissorRegion(Rectanglei::FromSize(texture_dimensions));
+	// Split the texture at a texel boundary well within the uniform region of each edge.
+	const Vector2f split_position = element_offset_in_texture + padding_boxes[0].GetBorderOffset() + Vector2f(corner_extent + 1.f);
+	const Vector2f split = {Math::RoundUp(split_position.x), Math::RoundUp(split_position.y)};
 
-		// The scissor region will be clamped to the current window size, check the resulting scissor region.
-		const Rectanglei scissor_region = render_manager.GetScissorRegion();
-		if (scissor_region.Width() <= 0 || scissor_region.Height() <= 0)
-		{
-			// The window may become zero-sized for example when minimized. Just skip the texture generation for now, we
-			// expect to be called again later when the window is restored.
-			render_manager.SetState(initial_render_state);
-			return false;
-		}
-		if (scissor_region != Rectanglei::FromSize(texture_dimensions))
-		{
-			Log::Message(Log::LT_INFO,
-				"The desired box-shadow texture dimensions (%d, %d) are larger than the current window region (%d, %d). "
-				"Results may be clipped. In element: %s",
-				texture_dimensions.x, texture_dimensions.y, scissor_region.Width(), scissor_region.Height(), element->GetAddress().c_str());
-		}
-
-		render_manager.PushLayer();
+	BoxShadowTextureKey key{&render_manager, std::move(shadow_list), std::move(padding_boxes), border_radius, background_color,
+		{border_colors[0], border_colors[1], border_colors[2], border_colors[3]}};
 
-		background_border_geometry.Render(element_offset_in_texture);
+	auto& textures = box_shadow_texture_cache->textures;
+	auto it = textures.find(key);
+	SharedPtr<CallbackTexture> shadow_texture = (it != textures.end() ? it->second.lock() : nullptr);
 
-		for (int shadow_index = (int)shadow_list.size() - 1; shadow_index >= 0; shadow_index--)
+	if (!shadow_texture)
+	{
+		// Callback for generating the box-shadow texture. Using a callback ensures that the texture can be regenerated at any time, for example if
+		// the device loses its GPU context and the client calls Rml::ReleaseTextures(). The callback only refers to data it owns, since the texture
+		// may outlive the element it was first generated for.
+		auto texture_callback = [key, texture_dimensions, element_offset_in_texture](const CallbackTextureInterface& texture_interface) -> bool {
+			return GenerateShadowTexture(texture_interface, key, texture_dimensions, element_offset_in_texture);
+		};
+		shadow_texture = MakeShared<CallbackTexture>(render_manager.MakeCallbackTexture(std::move(texture_callback)));
+
+		if (textures.size() >= box_shadow_texture_cache->purge_size)
 		{
-			const BoxShadow& shadow = shadow_list[shadow_index];
-			const Vector2f shadow_offset = {shadow.offset_x.number, shadow.offset_y.number};
-			const bool inset = shadow.inset;
-			const float spread_distance = shadow.spread_distance.number;
-			const float blur_radius = shadow.blur_radius.number;
-
-			CornerSizes spread_radii = border_radius;
-			for (int i = 0; i < 4; i++)
+			for (auto it_purge = textures.begin(); it_purge != textures.end();)
 			{
-				float& radius = spread_radii[i];
-				float spread_factor = (inset ? -1.f : 1.f);
-				if (radius < spread_distance)
-				{
-					const float ratio_minus_one = (radius / spread_distance) - 1.f;
-					spread_factor *= 1.f + ratio_minus_one * ratio_minus_one * ratio_minus_one;
-				}
-				radius = Math::Max(radius + spread_factor * spread_distance, 0.f);
-			}
-
-			Mesh mesh_shadow;
-
-			// Generate the shadow geometry. For outer box-shadows it is rendered normally, while for inset box-shadows it is used as a clipping mask.
-			for (int i = 0; i < element->GetNumBoxes(); i++)
-			{
-				const float signed_spread_distance = (inset ? -spread_distance : spread_distance);
-				RenderBox render_box = element->GetRenderBox(inset ? BoxArea::Padding : BoxArea::Border, i);
-				render_box.SetFillSize(Math::Max(render_box.GetFillSize() + Vector2f(2.f * signed_spread_distance), Vector2f{0.001f}));
-				render_box.SetBorderRadius(spread_radii);
-				render_box.SetBorderOffset(render_box.GetBorderOffset() - Vector2f(signed_spread_distance));
-				MeshUtilities::GenerateBackground(mesh_shadow, render_box, shadow.color);
-			}
-
-			CompiledFilter blur;
-			if (blur_radius >= 0.5f)
-			{
-				blur = render_manager.CompileFilter("blur", Dictionary{{"sigma", Variant(0.5f * blur_radius)}});
-				if (blur)
-					render_manager.PushLayer();
-			}
-
-			Geometry geometry_shadow = render_manager.MakeGeometry(std::move(mesh_shadow));
-
-			if (inset)
-			{
-				render_manager.SetClipMask(ClipMaskOperation::SetInverse, &geometry_shadow, shadow_offset + element_offset_in_texture);
-
-				for (Rml::Vertex& vertex : mesh_padding.vertices)
-					vertex.colour = shadow.color;
-
-				// @performance: Don't need to copy the mesh if this is the last use of it.
-				Geometry geometry_padding = render_manager.MakeGeometry(Mesh(mesh_padding));
-				geometry_padding.Render(element_offset_in_texture);
-
-				render_manager.SetClipMask(ClipMaskOperation::Set, &geometry_padding, element_offset_in_texture);
-			}
-			else
-			{
-				Mesh mesh = mesh_padding_border;
-				Geometry geometry_padding_border = render_manager.MakeGeometry(std::move(mesh));
-				render_manager.SetClipMask(ClipMaskOperation::SetInverse, &geometry_padding_border, element_offset_in_texture);
-				geometry_shadow.Render(shadow_offset + element_offset_in_texture);
-			}
-
-			if (blur)
-			{
-				FilterHandleList filters;
-				blur.AddHandleTo(filters);
-				render_manager.CompositeLayers(render_manager.GetTopLayer(), render_manager.GetNextLayer(), BlendMode::Blend, filters);
-				render_manager.PopLayer();
-				blur.Release();
+				if (it_purge->second.expired())
+					it_purge = textures.erase(it_purge);
+				else
+					++it_purge;
 			}
+			box_shadow_texture_cache->purge_size = Math::Max(size_t(64), 2 * textures.size());
 		}
-
-		texture_interface.SaveLayerAsTexture();
-
-		render_manager.PopLayer();
-		render_manager.SetState(initial_render_state);
-
-		return true;
-	};
+		textures[std::move(key)] = shadow_texture;
+	}
 
 	Mesh mesh = out_shadow_geometry.Release(Geometry::ReleaseMode::ClearMesh);
 	const byte alpha = byte(opacity * 255.f);
-	MeshUtilities::GenerateQuad(mesh, -element_offset_in_texture, Vector2f(texture_dimensions), ColourbPremultiplied(alpha, alpha));
+	const ColourbPremultiplied color(alpha, alpha);
+	const Vector2f texture_size = Vector2f(texture_dimensions);
+	const Vector2f full_size = texture_size + reduction;
+
+	const ShadowSlices slices_x = MakeSlices(full_size.x, texture_size.x, split.x, reduction.x);
+	const ShadowSlices slices_y = MakeSlices(full_size.y, texture_size.y, split.y, reduction.y);
+	for (const ShadowSlice& slice_y : slices_y)
+	{
+		for (const ShadowSlice& slice_x : slices_x)
+		{
+			MeshUtilities::GenerateQuad(mesh, Vector2f(slice_x.position, slice_y.position) - element_offset_in_texture,
+				Vector2f(slice_x.size, slice_y.size), color, Vector2f(slice_x.texcoord_begin, slice_y.texcoord_begin),
+				Vector2f(slice_x.texcoord_end, slice_y.texcoord_end));
+		}
+	}
 
-	out_shadow_texture = render_manager.MakeCallbackTexture(std::move(texture_callback));
+	out_shadow_texture = std::move(shadow_texture);
 	out_shadow_geometry = render_manager.MakeGeometry(std::move(mesh));
 }
 
+void GeometryBoxShadow::Initialize()
+{
+	box_shadow_texture_cache.Initialize();
+}
+
+void GeometryBoxShadow::Shutdown()
+{
+	box_shadow_texture_cache.Shutdown();
+}
+
 } // namespace Rml
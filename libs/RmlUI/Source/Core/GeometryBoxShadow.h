@@ -42,16 +42,22 @@ class GeometryBoxShadow {
 public:
 	/// Generate the texture and geometry for a box shadow.
 	/// @param[out] out_shadow_geometry The target geometry.
-	/// @param[out] out_shadow_texture The target texture, assumes pointer stability during the lifetime of the shadow geometry.
+	/// @param[out] out_shadow_texture The target texture, shared with any other elements which generate an identical box-shadow texture.
 	/// @param[in] render_manager The render manager to generate the shadow for.
 	/// @param[in] element The element to generate the shadow for.
-	/// @param[in] background_border_geometry The geometry of the background and border, assumed to already have been generated. Assumes pointer
-	/// stability during the lifetime of the shadow geometry.
 	/// @param[in] shadow_list The list of box-shadows to generate.
+	/// @param[in] background_color The background color of the element, rendered opaquely into the texture.
+	/// @param[in] border_colors The border colors of the element, rendered opaquely into the texture.
 	/// @param[in] border_radius The border radius of the element.
 	/// @param[in] opacity The opacity of the element.
-	static void Generate(Geometry& out_shadow_geometry, CallbackTexture& out_shadow_texture, RenderManager& render_manager, Element* element,
-		Geometry& background_border_geometry, BoxShadowList shadow_list, CornerSizes border_radius, float opacity);
+	/// @note Large single-box elements use a nine-sliced texture, where only the corners and a single row and column of the edges are rendered
+	/// into the texture, which is then stretched by the geometry to cover the full box.
+	static void Generate(Geometry& out_shadow_geometry, SharedPtr<CallbackTexture>& out_shadow_texture, RenderManager& render_manager,
+		Element* element, BoxShadowList shadow_list, ColourbPremultiplied background_color, const ColourbPremultiplied border_colors[4],
+		CornerSizes border_radius, float opacity);
+
+	static void Initialize();
+	static void Shutdown();
 };
 
 } // namespace Rml
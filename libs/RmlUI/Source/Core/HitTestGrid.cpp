@@ -0,0 +1,160 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "HitTestGrid.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "TransformState.h"
+#include <float.h>
+
+namespace Rml {
+
+// Stacking contexts with fewer children than this are tested linearly.
+static constexpr int min_num_children = 32;
+
+// The grid never uses more than this number of columns or rows.
+static constexpr int max_num_cells_per_axis = 64;
+
+const Vector<int>* HitTestGrid::GetCandidates(Element* element, Vector2f point)
+{
+	RMLUI_ASSERT(element->local_stacking_context && !element->stacking_context_dirty);
+
+	ElementDocument* document = element->GetOwnerDocument();
+	if (!document)
+		return nullptr;
+
+	if (dirty || geometry_generation != document->geometry_generation)
+	{
+		Build(element);
+		geometry_generation = document->geometry_generation;
+		dirty = false;
+	}
+
+	if (!enabled)
+		return nullptr;
+
+	// Border boxes include their far edges, as do the last cells.
+	const Vector2f cell = (point - origin) / cell_size;
+	if (!(cell.x >= 0.f && cell.y >= 0.f && cell.x <= float(num_columns) && cell.y <= float(num_rows)))
+		return &unbounded_children;
+
+	const int column = Math::Min(int(cell.x), num_columns - 1);
+	const int row = Math::Min(int(cell.y), num_rows - 1);
+	return &cells[row * num_columns + column];
+}
+
+void HitTestGrid::Build(Element* element)
+{
+	const ElementList& stacking_context = element->stacking_context;
+	const int num_children = (int)stacking_context.size();
+
+	cells.clear();
+	unbounded_children.clear();
+
+	enabled = (num_children >= min_num_children);
+	if (!enabled)
+		return;
+
+	// Find the bounds of each child's border boxes in window coordinates, matching 'Element::IsPointWithinElement'.
+	struct Bounds {
+		Vector2f min;
+		Vector2f max;
+		bool unbounded;
+	};
+	Vector<Bounds> child_bounds(num_children);
+	Vector2f grid_min(FLT_MAX, FLT_MAX);
+	Vector2f grid_max(-FLT_MAX, -FLT_MAX);
+
+	for (int i = 0; i < num_children; i++)
+	{
+		Element* child = stacking_context[i];
+		Bounds& bounds = child_bounds[i];
+
+		// Transformed elements are projected before testing them, while the descendants of nested stacking contexts
+		// may be located anywhere.
+		const TransformState* transform_state = child->GetTransformState();
+		bounds.unbounded = (child->local_stacking_context || (transform_state && transform_state->GetTransform()));
+		if (bounds.unbounded)
+			continue;
+
+		const Vector2f position = child->GetAbsoluteOffset(BoxArea::Border);
+		bounds.min = Vector2f(FLT_MAX, FLT_MAX);
+		bounds.max = Vector2f(-FLT_MAX, -FLT_MAX);
+
+		for (int j = 0; j < child->GetNumBoxes(); j++)
+		{
+			Vector2f box_offset;
+			const Box& box = child->GetBox(j, box_offset);
+			const Vector2f box_position = position + box_offset;
+			bounds.min = Math::Min(bounds.min, box_position);
+			bounds.max = Math::Max(bounds.max, box_position + box.GetSize(BoxArea::Border));
+		}
+
+		grid_min = Math::Min(grid_min, bounds.min);
+		grid_max = Math::Max(grid_max, bounds.max);
+	}
+
+	if (grid_min.x > grid_max.x || grid_min.y > grid_max.y)
+	{
+		grid_min = {};
+		grid_max = {};
+	}
+
+	// Aim for a couple of children in each cell, while keeping the grid reasonably small.
+	const int num_cells_per_axis = Math::Clamp(int(Math::SquareRoot(float(num_children) * 0.5f)) + 1, 1, max_num_cells_per_axis);
+	num_columns = num_cells_per_axis;
+	num_rows = num_cells_per_axis;
+	origin = grid_min;
+	cell_size = Math::Max((grid_max - grid_min) / Vector2f(float(num_columns), float(num_rows)), Vector2f(1.f, 1.f));
+
+	// Add the children in stacking order, so that the candidates of each cell are sorted as well.
+	cells.resize(num_columns * num_rows);
+	for (int i = 0; i < num_children; i++)
+	{
+		const Bounds& bounds = child_bounds[i];
+		if (bounds.unbounded)
+		{
+			unbounded_children.push_back(i);
+			for (Vector<int>& cell : cells)
+				cell.push_back(i);
+			continue;
+		}
+
+		const int column_begin = Math::Clamp(int((bounds.min.x - origin.x) / cell_size.x), 0, num_columns - 1);
+		const int column_end = Math::Clamp(int((bounds.max.x - origin.x) / cell_size.x), 0, num_columns - 1);
+		const int row_begin = Math::Clamp(int((bounds.min.y - origin.y) / cell_size.y), 0, num_rows - 1);
+		const int row_end = Math::Clamp(int((bounds.max.y - origin.y) / cell_size.y), 0, num_rows - 1);
+
+		for (int row = row_begin; row <= row_end; row++)
+			for (int column = column_begin; column <= column_end; column++)
+				cells[row * num_columns + column].push_back(i);
+	}
+}
+
+} // namespace Rml
@@ -0,0 +1,76 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_HITTESTGRID_H
+#define RMLUI_CORE_HITTESTGRID_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/*
+    A uniform grid over the border boxes of the elements in a local stacking context. Used to find the elements that may
+    contain a given point, without visiting every element in the stacking context.
+
+    Elements with a transform, and nested stacking contexts whose descendants may extend beyond their own box, are
+    instead tested for every point. The grid is rebuilt when the stacking context changes, or when the geometry of any
+    element in its document changes.
+*/
+class HitTestGrid {
+public:
+	/// Returns the indices into the element's stacking context of the children which may contain the given point.
+	/// @param[in] element An element with a local stacking context that has already been built.
+	/// @return The indices in stacking order, or nullptr if all children should be tested.
+	const Vector<int>* GetCandidates(Element* element, Vector2f point);
+
+	/// Called when the element's stacking context has been rebuilt.
+	void DirtyStackingContext() { dirty = true; }
+
+private:
+	void Build(Element* element);
+
+	bool dirty = true;
+	uint64_t geometry_generation = 0;
+
+	// Without enough elements in the stacking context, testing them all is just as fast.
+	bool enabled = false;
+
+	Vector2f origin;
+	Vector2f cell_size;
+	int num_columns = 0;
+	int num_rows = 0;
+
+	Vector<Vector<int>> cells;
+	// Children tested regardless of their box, also used for points outside the grid.
+	Vector<int> unbounded_children;
+};
+
+} // namespace Rml
+#endif
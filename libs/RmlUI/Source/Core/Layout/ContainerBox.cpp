@@ -33,6 +33,7 @@
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "FlexFormattingContext.h"
 #include "FormattingContext.h"
+#include "LayoutCache.h"
 #include "LayoutDetails.h"
 #include <algorithm>
 #include <cmath>
@@ -57,6 +58,7 @@ void ContainerBox::AddAbsoluteElement(Element* element, Vector2f static_position
 {
 	// We may possibly be adding the same element from a previous layout iteration. If so, this ensures it is updated with the latest static position.
 	absolute_elements[element] = AbsoluteElement{static_position, static_relative_offset_parent};
+	LayoutCache::OnAbsoluteElementAdded(depth);
 }
 
 void ContainerBox::AddRelativeElement(Element* element)
@@ -130,7 +132,7 @@ void ContainerBox::SubmitElementLayout()
 }
 
 ContainerBox::ContainerBox(Type type, Element* element, ContainerBox* parent_container) :
-	LayoutBox(type), element(element), parent_container(parent_container)
+	LayoutBox(type), element(element), parent_container(parent_container), depth(parent_container ? parent_container->depth + 1 : 0)
 {
 	if (element)
 	{
@@ -59,6 +59,9 @@ public:
 	// Returns true if this box acts as a containing block for absolutely positioned descendants.
 	bool IsAbsolutePositioningContainingBlock() const { return is_absolute_positioning_containing_block; }
 
+	// Returns the number of ancestor containers of this box.
+	int GetDepth() const { return depth; }
+
 protected:
 	ContainerBox(Type type, Element* element, ContainerBox* parent_container);
 
@@ -103,6 +106,7 @@ private:
 	bool is_absolute_positioning_containing_block = false;
 
 	ContainerBox* parent_container = nullptr;
+	int depth = 0;
 };
 
 /**
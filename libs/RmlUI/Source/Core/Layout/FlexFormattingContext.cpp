@@ -33,6 +33,7 @@
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "../../../Include/RmlUi/Core/Types.h"
 #include "ContainerBox.h"
+#include "LayoutCache.h"
 #include "LayoutDetails.h"
 #include <algorithm>
 #include <float.h>
@@ -117,6 +118,12 @@ UniquePtr<LayoutBox> FlexFormattingContext::Format(ContainerBox* parent_containe
 
 Vector2f FlexFormattingContext::GetMaxContentSize(Element* element)
 {
+	Vector2f max_content_size;
+	if (LayoutCache::FindMaxContentSize(element, max_content_size))
+		return max_content_size;
+
+	LayoutCache::MeasureScope measure_scope;
+
 	// A large but finite number is used here, since layouting doesn't always work well with infinities.
 	const Vector2f infinity(10000.0f, 10000.0f);
 	RootBox root(infinity);
@@ -133,6 +140,11 @@ Vector2f FlexFormattingContext::GetMaxContentSize(Element* element)
 	Vector2f flex_resulting_content_size, content_overflow_size;
 	float flex_baseline = 0.f;
 	context.Format(flex_resulting_content_size, content_overflow_size, flex_baseline);
+
+	// The flex items have now been placed for this measurement, thus they no longer match the element's last layout.
+	LayoutCache::Discard(element);
+	LayoutCache::StoreMaxContentSize(element, flex_resulting_content_size);
+
 	return flex_resulting_content_size;
 }
 
@@ -359,6 +371,7 @@ void FlexFormattingContext::Format(Vector2f& flex_resulting_content_size, Vector
 			if (initial_box_size.x < 0.f && flex_available_content_size.x >= 0.f)
 				format_box.SetContent(Vector2f(flex_available_content_size.x - item.cross.sum_edges, initial_box_size.y));
 
+			LayoutCache::MeasureScope measure_scope;
 			FormattingContext::FormatIndependent(flex_container_box, element, (format_box.GetSize().x >= 0 ? &format_box : nullptr),
 				FormattingContextType::Block);
 			item.inner_flex_base_size = element->GetBox().GetSize().y;
@@ -702,6 +715,7 @@ void FlexFormattingContext::Format(Vector2f& flex_resulting_content_size, Vector
 				if (content_size.y < 0.0f)
 				{
 					item.box.SetContent(Vector2f(GetInnerUsedMainSize(item), content_size.y));
+					LayoutCache::MeasureScope measure_scope;
 					FormattingContext::FormatIndependent(flex_container_box, item.element, &item.box, FormattingContextType::Block);
 					item.hypothetical_cross_size = item.element->GetBox().GetSize().y + item.cross.sum_edges;
 				}
@@ -33,6 +33,8 @@
 #include "BlockFormattingContext.h"
 #include "FlexFormattingContext.h"
 #include "LayoutBox.h"
+#include "LayoutCache.h"
+#include "LayoutDetails.h"
 #include "ReplacedFormattingContext.h"
 #include "TableFormattingContext.h"
 
@@ -66,15 +68,31 @@ UniquePtr<LayoutBox> FormattingContext::FormatIndependent(ContainerBox* parent_c
 		type = FormattingContextType::Block;
 	}
 
+	if (type == FormattingContextType::None)
+		return nullptr;
+
+	// Reuse the previous result if neither the element's contents nor the conditions it is formatted under have changed.
+	const Vector2f containing_block = LayoutDetails::GetContainingBlock(parent_container, computed.position()).size;
+	if (UniquePtr<LayoutBox> cached_box = LayoutCache::Find(element, containing_block, override_initial_box, type))
+		return cached_box;
+
+	LayoutCache::FormatScope format_scope(parent_container);
+	UniquePtr<LayoutBox> layout_box;
+
 	switch (type)
 	{
-	case FormattingContextType::Block: return BlockFormattingContext::Format(parent_container, element, override_initial_box);
-	case FormattingContextType::Table: return TableFormattingContext::Format(parent_container, element, override_initial_box);
-	case FormattingContextType::Flex: return FlexFormattingContext::Format(parent_container, element, override_initial_box);
+	case FormattingContextType::Block: layout_box = BlockFormattingContext::Format(parent_container, element, override_initial_box); break;
+	case FormattingContextType::Table: layout_box = TableFormattingContext::Format(parent_container, element, override_initial_box); break;
+	case FormattingContextType::Flex: layout_box = FlexFormattingContext::Format(parent_container, element, override_initial_box); break;
 	case FormattingContextType::None: break;
 	}
 
-	return nullptr;
+	if (layout_box)
+		LayoutCache::Store(element, containing_block, override_initial_box, type, *layout_box, format_scope.IsSelfContained());
+	else
+		LayoutCache::Discard(element);
+
+	return layout_box;
 }
 
 } // namespace Rml
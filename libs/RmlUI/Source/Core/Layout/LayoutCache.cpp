@@ -0,0 +1,445 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "LayoutCache.h"
+#include "../../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../../Include/RmlUi/Core/Element.h"
+#include "../../../Include/RmlUi/Core/ElementDocument.h"
+#include "../ElementMeta.h"
+#include "ContainerBox.h"
+#include <climits>
+
+namespace Rml {
+
+// Incremented whenever a result is stored or invalidated. Results are only valid if stored after the element was last invalidated.
+static uint64_t layout_stamp = 0;
+
+// The smallest box tree depth of any container that absolutely positioned elements were added to in the current format scope.
+static int absolute_container_min_depth = INT_MAX;
+
+// Greater than zero while formatting a document.
+static int layout_depth = 0;
+
+// Identifies the current layout pass, measurements from other passes are discarded.
+static uint64_t layout_pass = 0;
+
+// The maximum number of measurements kept for each element during a layout pass.
+static constexpr size_t max_num_measurements = 4;
+
+// Greater than zero while measuring elements, during which the measurements of the current layout pass can be reused.
+static int measure_depth = 0;
+
+// Greater than zero while measuring shrink-to-fit widths, which requires cached results to include it.
+static int shrink_to_fit_measure_depth = 0;
+
+void LayoutCache::DirtyLayout(Element* element, bool contents_only)
+{
+	element->DirtyRenderCommands();
+
+	if (layout_depth > 0)
+	{
+		// Don't mark the elements as dirty, as that would reformat them during every following layout. Yet, make sure
+		// their results are not reused in case they are formatted again for other reasons.
+		for (Element* ancestor = element; ancestor; ancestor = ancestor->GetParentNode())
+		{
+			LayoutState& state = GetState(ancestor);
+			state.formatted.stamp = 0;
+			state.shrink_to_fit.stamp = 0;
+			state.relayout_boundary = false;
+		}
+		return;
+	}
+
+	// Our ancestors' formatting results depend on ours, so they need to be formatted again too. However, we stop at
+	// relayout boundaries, whose outer dimensions do not depend on their contents. These are formatted on their own
+	// during the next layout. Note that changes to the boundary element itself always propagate to its ancestors,
+	// unless only its contents changed.
+	Element* boundary = nullptr;
+	LayoutState& element_state = GetState(element);
+	if (contents_only && element_state.relayout_boundary)
+	{
+		if (!element_state.dirty)
+			boundary = element;
+		element_state.dirty = true;
+	}
+	else
+	{
+		element_state.dirty = true;
+		for (Element* ancestor = element->GetParentNode(); ancestor; ancestor = ancestor->GetParentNode())
+		{
+			LayoutState& state = GetState(ancestor);
+			if (state.dirty)
+				break;
+
+			state.dirty = true;
+
+			if (state.relayout_boundary)
+			{
+				boundary = ancestor;
+				break;
+			}
+		}
+	}
+
+	// Mark the path to the boundary, so that it can be found during layout without visiting the rest of the tree.
+	if (boundary)
+	{
+		for (Element* ancestor = boundary->GetParentNode(); ancestor; ancestor = ancestor->GetParentNode())
+		{
+			LayoutState& state = GetState(ancestor);
+			if (state.dirty || state.dirty_boundary_descendant)
+				break;
+
+			state.dirty_boundary_descendant = true;
+		}
+	}
+
+	if (ElementDocument* document = element->GetOwnerDocument())
+		document->layout_dirty = true;
+}
+
+void LayoutCache::FormatRelayoutBoundaries(Element* root)
+{
+	const uint64_t invalidated_stamp = ++layout_stamp;
+
+	ElementList changed_boundaries;
+	CollectChanges(root, invalidated_stamp, changed_boundaries);
+
+	for (Element* boundary : changed_boundaries)
+	{
+		// Boundaries inside other changed parts of the tree are formatted together with them.
+		bool ancestor_invalidated = false;
+		for (Element* ancestor = boundary->GetParentNode(); ancestor && !ancestor_invalidated; ancestor = ancestor->GetParentNode())
+		{
+			ancestor_invalidated = (GetState(ancestor).invalidated_stamp >= invalidated_stamp);
+			if (ancestor == root)
+				break;
+		}
+
+		if (ancestor_invalidated)
+			continue;
+
+		if (!FormatRelayoutBoundary(boundary))
+		{
+			// The change was visible from outside the boundary after all, format its ancestors as well.
+			for (Element* ancestor = boundary->GetParentNode(); ancestor; ancestor = ancestor->GetParentNode())
+			{
+				GetState(ancestor).invalidated_stamp = ++layout_stamp;
+				if (ancestor == root)
+					break;
+			}
+		}
+	}
+}
+
+UniquePtr<LayoutBox> LayoutCache::Find(Element* element, Vector2f containing_block, const Box* override_box, FormattingContextType type)
+{
+	const LayoutState& state = GetState(element);
+
+	if (IsValid(state, state.formatted, containing_block, override_box, type))
+	{
+		// Measurements may have left the element with a different box, restore the one its contents are placed in.
+		element->SetBox(state.formatted.box);
+		return MakeUnique<CachedBox>(state.formatted);
+	}
+
+	// Measurements only need the resulting sizes, not the placement of the element's contents.
+	if (measure_depth > 0 && state.measurements_pass == layout_pass)
+	{
+		for (const LayoutState::Formatted& measurement : state.measurements)
+		{
+			if (IsValid(state, measurement, containing_block, override_box, type))
+			{
+				element->SetBox(measurement.box);
+				return MakeUnique<CachedBox>(measurement);
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+void LayoutCache::Store(Element* element, Vector2f containing_block, const Box* override_box, FormattingContextType type,
+	const LayoutBox& layout_box, bool self_contained)
+{
+	LayoutState& state = GetState(element);
+	state.relayout_boundary = false;
+
+	// Positioned descendants placed outside of the element would be lost when reusing the result.
+	if (!self_contained)
+	{
+		state.formatted.stamp = 0;
+		return;
+	}
+
+	LayoutState::Formatted formatted;
+	formatted.containing_block = containing_block;
+	formatted.has_override_box = (override_box != nullptr);
+	if (override_box)
+		formatted.override_box = *override_box;
+	formatted.type = type;
+
+	formatted.box = element->GetBox();
+	formatted.visible_overflow_size = layout_box.GetVisibleOverflowSize();
+	formatted.has_baseline = layout_box.GetBaselineOfLastLine(formatted.baseline);
+
+	// The shrink-to-fit width is only needed, and only cheap to retrieve, when measuring it for an ancestor. Retrieving
+	// it may format the element's contents again though, such as for the max-content size of flex containers.
+	const uint64_t stamp_before_shrink_to_fit = layout_stamp;
+	formatted.has_shrink_to_fit_width = (shrink_to_fit_measure_depth > 0);
+	if (formatted.has_shrink_to_fit_width)
+		formatted.shrink_to_fit_width = layout_box.GetShrinkToFitWidth();
+	const bool contents_formatted_again = (layout_stamp != stamp_before_shrink_to_fit);
+
+	formatted.stamp = ++layout_stamp;
+
+	if (measure_depth > 0)
+	{
+		if (state.measurements_pass != layout_pass)
+		{
+			state.measurements.clear();
+			state.measurements_pass = layout_pass;
+		}
+		else if (state.measurements.size() >= max_num_measurements)
+		{
+			state.measurements.erase(state.measurements.begin());
+		}
+		state.measurements.push_back(formatted);
+	}
+
+	// The contents are now placed according to the last formatting, only this result can be reused outside measurements.
+	if (contents_formatted_again)
+	{
+		state.formatted.stamp = 0;
+		return;
+	}
+
+	state.formatted = formatted;
+
+	// Block containers with a definite width and height in normal flow act as relayout boundaries: Their outer
+	// dimensions and shrink-to-fit width do not depend on their contents. Flex items are excluded since their size is
+	// resolved from measurements by the flex container.
+	using namespace Style;
+	const ComputedValues& computed = element->GetComputedValues();
+	const Display display = computed.display();
+	Element* parent = element->GetParentNode();
+	state.relayout_boundary = (!override_box && type == FormattingContextType::Block &&
+		(display == Display::Block || display == Display::FlowRoot || display == Display::InlineBlock) && computed.width().type == Width::Length &&
+		computed.height().type == Height::Length && parent &&
+		!(parent->GetDisplay() == Display::Flex || parent->GetDisplay() == Display::InlineFlex));
+}
+
+void LayoutCache::Discard(Element* element)
+{
+	LayoutState& state = GetState(element);
+	state.formatted.stamp = 0;
+	state.relayout_boundary = false;
+}
+
+bool LayoutCache::FindShrinkToFitWidth(Element* element, Vector2f containing_block, float& out_width)
+{
+	const LayoutState& state = GetState(element);
+	if (state.dirty || state.shrink_to_fit.stamp <= state.invalidated_stamp || state.shrink_to_fit.containing_block != containing_block)
+		return false;
+
+	out_width = state.shrink_to_fit.width;
+	return true;
+}
+
+void LayoutCache::StoreShrinkToFitWidth(Element* element, Vector2f containing_block, float width)
+{
+	LayoutState::ShrinkToFit& shrink_to_fit = GetState(element).shrink_to_fit;
+	shrink_to_fit.stamp = ++layout_stamp;
+	shrink_to_fit.containing_block = containing_block;
+	shrink_to_fit.width = width;
+}
+
+bool LayoutCache::FindMaxContentSize(Element* element, Vector2f& out_size)
+{
+	const LayoutState& state = GetState(element);
+	if (state.dirty || state.max_content.stamp <= state.invalidated_stamp)
+		return false;
+
+	out_size = state.max_content.size;
+	return true;
+}
+
+void LayoutCache::StoreMaxContentSize(Element* element, Vector2f size)
+{
+	LayoutState::MaxContent& max_content = GetState(element).max_content;
+	max_content.stamp = ++layout_stamp;
+	max_content.size = size;
+}
+
+LayoutCache::FormatScope::FormatScope(const ContainerBox* parent_container) :
+	parent_depth(parent_container->GetDepth()), previous_min_depth(absolute_container_min_depth)
+{
+	absolute_container_min_depth = INT_MAX;
+}
+
+LayoutCache::FormatScope::~FormatScope()
+{
+	absolute_container_min_depth = Math::Min(previous_min_depth, absolute_container_min_depth);
+}
+
+bool LayoutCache::FormatScope::IsSelfContained() const
+{
+	// The formatted element's own container is one level deeper than its parent, as are all containers inside it.
+	return absolute_container_min_depth > parent_depth;
+}
+
+LayoutCache::LayoutScope::LayoutScope()
+{
+	if (layout_depth == 0)
+		layout_pass += 1;
+	layout_depth += 1;
+}
+
+LayoutCache::LayoutScope::~LayoutScope()
+{
+	layout_depth -= 1;
+}
+
+LayoutCache::MeasureScope::MeasureScope()
+{
+	measure_depth += 1;
+}
+
+LayoutCache::MeasureScope::~MeasureScope()
+{
+	measure_depth -= 1;
+}
+
+LayoutCache::ShrinkToFitScope::ShrinkToFitScope()
+{
+	shrink_to_fit_measure_depth += 1;
+}
+
+LayoutCache::ShrinkToFitScope::~ShrinkToFitScope()
+{
+	shrink_to_fit_measure_depth -= 1;
+}
+
+void LayoutCache::OnAbsoluteElementAdded(int container_depth)
+{
+	absolute_container_min_depth = Math::Min(absolute_container_min_depth, container_depth);
+}
+
+LayoutState& LayoutCache::GetState(Element* element)
+{
+	return element->meta->layout_state;
+}
+
+bool LayoutCache::IsValid(const LayoutState& state, const LayoutState::Formatted& formatted, Vector2f containing_block, const Box* override_box,
+	FormattingContextType type)
+{
+	if (state.dirty || formatted.stamp <= state.invalidated_stamp)
+		return false;
+
+	if (formatted.type != type || formatted.containing_block != containing_block || formatted.has_override_box != (override_box != nullptr) ||
+		(override_box && !(formatted.override_box == *override_box)))
+		return false;
+
+	if (shrink_to_fit_measure_depth > 0 && !formatted.has_shrink_to_fit_width)
+		return false;
+
+	return true;
+}
+
+void LayoutCache::CollectChanges(Element* element, uint64_t invalidated_stamp, ElementList& changed_boundaries)
+{
+	LayoutState& state = GetState(element);
+
+	if (state.dirty)
+	{
+		state.dirty = false;
+		state.invalidated_stamp = invalidated_stamp;
+
+		// Boundaries that were only dirtied by their descendants can be formatted on their own.
+		Element* parent = element->GetParentNode();
+		if (state.relayout_boundary && parent && GetState(parent).invalidated_stamp != invalidated_stamp)
+			changed_boundaries.push_back(element);
+	}
+
+	state.dirty_boundary_descendant = false;
+
+	const int num_children = element->GetNumChildren(true);
+	for (int i = 0; i < num_children; i++)
+	{
+		Element* child = element->GetChild(i);
+		const LayoutState& child_state = GetState(child);
+		if (child_state.dirty || child_state.dirty_boundary_descendant)
+			CollectChanges(child, invalidated_stamp, changed_boundaries);
+	}
+}
+
+bool LayoutCache::FormatRelayoutBoundary(Element* element)
+{
+	LayoutState& state = GetState(element);
+	const LayoutState::Formatted previous = state.formatted;
+	const Box previous_box = element->GetBox();
+
+	// Format the boundary under the same conditions as last time, then see if anything changed from the outside.
+	RootBox root(previous.containing_block);
+	UniquePtr<LayoutBox> layout_box = FormattingContext::FormatIndependent(&root, element, nullptr, previous.type);
+
+	const LayoutState::Formatted& current = state.formatted;
+	if (!layout_box || !state.relayout_boundary || !(element->GetBox() == previous_box) ||
+		current.visible_overflow_size != previous.visible_overflow_size || current.has_baseline != previous.has_baseline ||
+		(current.has_baseline && current.baseline != previous.baseline))
+		return false;
+
+	element->ClampScrollOffsetRecursive();
+	return true;
+}
+
+CachedBox::CachedBox(const LayoutState::Formatted& formatted) :
+	LayoutBox(Type::Cached), box(formatted.box), baseline(formatted.baseline), shrink_to_fit_width(formatted.shrink_to_fit_width),
+	has_baseline(formatted.has_baseline)
+{
+	SetVisibleOverflowSize(formatted.visible_overflow_size);
+}
+
+bool CachedBox::GetBaselineOfLastLine(float& out_baseline) const
+{
+	if (has_baseline)
+		out_baseline = baseline;
+	return has_baseline;
+}
+
+float CachedBox::GetShrinkToFitWidth() const
+{
+	return shrink_to_fit_width;
+}
+
+String CachedBox::DebugDumpTree(int depth) const
+{
+	return String(depth * 2, ' ') + "CachedBox";
+}
+
+} // namespace Rml
@@ -0,0 +1,206 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_LAYOUT_LAYOUTCACHE_H
+#define RMLUI_CORE_LAYOUT_LAYOUTCACHE_H
+
+#include "../../../Include/RmlUi/Core/Box.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+#include "FormattingContext.h"
+#include "LayoutBox.h"
+
+namespace Rml {
+
+class ContainerBox;
+
+/*
+    Layout state stored with each element, see 'LayoutCache'.
+*/
+struct LayoutState {
+	// The inputs and results from the last time the element was formatted as an independent formatting context.
+	struct Formatted {
+		uint64_t stamp = 0;
+		Vector2f containing_block;
+		Box override_box;
+		bool has_override_box = false;
+		FormattingContextType type = FormattingContextType::None;
+
+		Box box;
+		Vector2f visible_overflow_size;
+		float baseline = 0.f;
+		bool has_baseline = false;
+		float shrink_to_fit_width = 0.f;
+		bool has_shrink_to_fit_width = false;
+	};
+	// The shrink-to-fit width from the last time the element was measured for it.
+	struct ShrinkToFit {
+		uint64_t stamp = 0;
+		Vector2f containing_block;
+		float width = 0.f;
+	};
+	// The max-content size from the last time the element was measured for it, only used by flex containers.
+	struct MaxContent {
+		uint64_t stamp = 0;
+		Vector2f size;
+	};
+
+	Formatted formatted;
+	ShrinkToFit shrink_to_fit;
+	MaxContent max_content;
+
+	// Results from measuring the element during the current layout pass, under any conditions other than the last one.
+	Vector<Formatted> measurements;
+	uint64_t measurements_pass = 0;
+
+	// Results stored before this stamp no longer apply to the element's content.
+	uint64_t invalidated_stamp = 0;
+
+	// The element or any of its descendants have changed since the last layout.
+	bool dirty = false;
+	// A relayout boundary below this element has changed since the last layout.
+	bool dirty_boundary_descendant = false;
+	// Changes to the element's descendants can't affect the layout outside of it, see 'LayoutCache::DirtyLayout'.
+	bool relayout_boundary = false;
+};
+
+/*
+    Reuses the formatting results of independent formatting contexts whose content and inputs are unchanged.
+
+    A formatting result is keyed by the element's containing block, its override box, and its formatting context type.
+    The override box determines the available size mode: Definite where it has a size, otherwise automatic, while
+    shrink-to-fit measurements format it under a max-content width. Only the last result is kept between layouts, as
+    this is the one the element and its descendants are currently placed by. During a layout pass, measurements under
+    other conditions are additionally kept for the rest of the pass, such as when a flex container first measures its
+    items and then formats them to their final size. This avoids exponential formatting of nested flex containers.
+
+    Changes to an element mark it and its ancestors as dirty, which discards their formatting results on the next layout.
+    Elements with a fixed width and height act as relayout boundaries: changes to their descendants stop there, and the
+    boundary is formatted on its own before the rest of the document. Only if that changes the box, overflow, or
+    baseline seen by its parent are its ancestors formatted again.
+*/
+class LayoutCache {
+public:
+	/// Marks the element as changed, so that it is formatted again during the next layout of its document.
+	/// @param[in] contents_only True if only the element's children changed, such as when adding or removing them.
+	static void DirtyLayout(Element* element, bool contents_only = false);
+
+	/// Formats any changed relayout boundaries below the given root, and invalidates the changed parts of the tree.
+	/// @note Must be called before formatting the root itself.
+	static void FormatRelayoutBoundaries(Element* root);
+
+	/// Returns a box standing in for the element's previous formatting result if it can be reused, otherwise nullptr.
+	static UniquePtr<LayoutBox> Find(Element* element, Vector2f containing_block, const Box* override_box, FormattingContextType type);
+	/// Stores the result of formatting the element, to be reused if neither the element nor the inputs change.
+	/// @param[in] self_contained False if any positioned descendants were placed in a containing block outside the element.
+	static void Store(Element* element, Vector2f containing_block, const Box* override_box, FormattingContextType type,
+		const LayoutBox& layout_box, bool self_contained);
+	/// Discards the element's formatting result, used when its descendants are formatted in other ways.
+	static void Discard(Element* element);
+
+	/// Returns the element's previously measured shrink-to-fit width, if it can be reused.
+	static bool FindShrinkToFitWidth(Element* element, Vector2f containing_block, float& out_width);
+	static void StoreShrinkToFitWidth(Element* element, Vector2f containing_block, float width);
+
+	/// Returns the flex container's previously measured max-content size, if it can be reused.
+	static bool FindMaxContentSize(Element* element, Vector2f& out_size);
+	static void StoreMaxContentSize(Element* element, Vector2f size);
+
+	// Active while formatting a document. Changes to elements during this time, such as from enabling scrollbars, are
+	// already accounted for by the layout engine and do not mark them as dirty.
+	class LayoutScope {
+	public:
+		LayoutScope();
+		~LayoutScope();
+	};
+
+	// Tracks absolutely positioned elements escaping the independent formatting context currently being formatted.
+	class FormatScope {
+	public:
+		FormatScope(const ContainerBox* parent_container);
+		~FormatScope();
+		// Returns true if no absolutely positioned elements were added to containers outside the formatted element.
+		bool IsSelfContained() const;
+
+	private:
+		int parent_depth;
+		int previous_min_depth;
+	};
+
+	// Marks the formatting performed during its lifetime as a measurement, whose results are only used for sizing.
+	// The measured elements must be formatted again under their final conditions afterward.
+	class MeasureScope {
+	public:
+		MeasureScope();
+		~MeasureScope();
+	};
+
+	// Marks the formatting performed during its lifetime as a measurement of shrink-to-fit widths.
+	class ShrinkToFitScope {
+	public:
+		ShrinkToFitScope();
+		~ShrinkToFitScope();
+
+	private:
+		MeasureScope measure_scope;
+	};
+
+	/// Called when an absolutely positioned element is added to a container at the given depth in the box tree.
+	static void OnAbsoluteElementAdded(int container_depth);
+
+private:
+	static LayoutState& GetState(Element* element);
+
+	static bool IsValid(const LayoutState& state, const LayoutState::Formatted& formatted, Vector2f containing_block, const Box* override_box,
+		FormattingContextType type);
+
+	static void CollectChanges(Element* element, uint64_t invalidated_stamp, ElementList& changed_boundaries);
+	static bool FormatRelayoutBoundary(Element* element);
+};
+
+/*
+    A layout box standing in for an element whose previous formatting result was reused.
+*/
+class CachedBox final : public LayoutBox {
+public:
+	CachedBox(const LayoutState::Formatted& formatted);
+
+	const Box* GetIfBox() const override { return &box; }
+	bool GetBaselineOfLastLine(float& out_baseline) const override;
+	float GetShrinkToFitWidth() const override;
+
+	String DebugDumpTree(int depth) const override;
+
+private:
+	Box box;
+	float baseline;
+	float shrink_to_fit_width;
+	bool has_baseline;
+};
+
+} // namespace Rml
+#endif
@@ -35,6 +35,7 @@
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "ContainerBox.h"
 #include "FormattingContext.h"
+#include "LayoutCache.h"
 #include "LayoutEngine.h"
 #include <float.h>
 
@@ -274,10 +275,17 @@ float LayoutDetails::GetShrinkToFitWidth(Element* element, Vector2f containing_b
 	// width. For block containers, this is essentially its largest line or child box.
 	// @performance. Some formatting can be simplified, e.g. absolute elements do not contribute to the shrink-to-fit
 	// width. Also, children of elements with a fixed width and height don't need to be formatted further.
-	RootBox root(Math::Max(containing_block, Vector2f(0.f)));
-	UniquePtr<LayoutBox> layout_box = FormattingContext::FormatIndependent(&root, element, &box, FormattingContextType::Block);
+	float shrink_to_fit_width = 0.f;
+	if (!LayoutCache::FindShrinkToFitWidth(element, containing_block, shrink_to_fit_width))
+	{
+		LayoutCache::ShrinkToFitScope shrink_to_fit_scope;
+		RootBox root(Math::Max(containing_block, Vector2f(0.f)));
+		UniquePtr<LayoutBox> layout_box = FormattingContext::FormatIndependent(&root, element, &box, FormattingContextType::Block);
+
+		shrink_to_fit_width = layout_box->GetShrinkToFitWidth();
+		LayoutCache::StoreShrinkToFitWidth(element, containing_block, shrink_to_fit_width);
+	}
 
-	float shrink_to_fit_width = layout_box->GetShrinkToFitWidth();
 	if (containing_block.x >= 0)
 	{
 		const float available_width =
@@ -32,6 +32,7 @@
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "ContainerBox.h"
 #include "FormattingContext.h"
+#include "LayoutCache.h"
 
 namespace Rml {
 
@@ -39,6 +40,12 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block)
 {
 	RMLUI_ASSERT(element && containing_block.x >= 0 && containing_block.y >= 0);
 
+	LayoutCache::LayoutScope layout_scope;
+
+	// Changes inside relayout boundaries are formatted first. Any other changed parts of the tree are then formatted
+	// below, while the cached results are reused for everything else.
+	LayoutCache::FormatRelayoutBoundaries(element);
+
 	RootBox root(containing_block);
 
 	auto layout_box = FormattingContext::FormatIndependent(&root, element, nullptr, FormattingContextType::Block);
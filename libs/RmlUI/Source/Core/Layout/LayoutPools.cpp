@@ -35,6 +35,7 @@
 #include "FormattingContext.h"
 #include "InlineBox.h"
 #include "InlineContainer.h"
+#include "LayoutCache.h"
 #include "LineBox.h"
 #include "ReplacedFormattingContext.h"
 #include <algorithm>
@@ -51,7 +52,8 @@ static constexpr size_t ChunkSizeBig = std::max({sizeof(BlockContainer)});
 static constexpr size_t ChunkSizeMedium =
 	std::max({sizeof(InlineContainer), sizeof(InlineBox), sizeof(RootBox), sizeof(FlexContainer), sizeof(TableWrapper)});
 static constexpr size_t ChunkSizeSmall =
-	std::max({sizeof(ReplacedBox), sizeof(InlineLevelBox_Text), sizeof(InlineLevelBox_Atomic), sizeof(LineBox), sizeof(FloatedBoxSpace)});
+	std::max({sizeof(ReplacedBox), sizeof(InlineLevelBox_Text), sizeof(InlineLevelBox_Atomic), sizeof(LineBox), sizeof(FloatedBoxSpace),
+		sizeof(CachedBox)});
 
 struct LayoutPoolsData {
 	Pool<LayoutChunk<ChunkSizeBig>> layout_chunk_pool_big{50, true};
@@ -0,0 +1,331 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "RenderCommandList.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "RenderManagerAccess.h"
+
+namespace Rml {
+
+void RenderCommandList::Record(RenderManager& render_manager, Element* element)
+{
+	RMLUI_ZoneScoped;
+
+	commands.clear();
+	transforms.clear();
+	clip_mask_lists.clear();
+	composite_layers.clear();
+	filter_handles.clear();
+	spans.clear();
+	span_indices.clear();
+	num_dirty_spans = 0;
+	dirty = false;
+
+	RenderManagerAccess::SetCommandList(&render_manager, this);
+	element->Render();
+	RenderManagerAccess::SetCommandList(&render_manager, nullptr);
+
+	RMLUI_ASSERT(open_span < 0);
+
+	statistics = render_manager.GetStatistics();
+	num_released_resources = RenderManagerAccess::GetNumReleasedResources(&render_manager);
+	num_released_geometry = RenderManagerAccess::GetNumReleasedGeometry(&render_manager);
+	recorded_data_size = transforms.size() + clip_mask_lists.size() + composite_layers.size() + filter_handles.size();
+}
+
+void RenderCommandList::Replay(RenderManager& render_manager)
+{
+	RMLUI_ZoneScoped;
+	RMLUI_ASSERT(!dirty);
+
+	int num_commands_replayed = 0;
+
+	if (num_dirty_spans == 0)
+	{
+		for (const Command& command : commands)
+			Execute(render_manager, command);
+
+		num_commands_replayed = (int)commands.size();
+	}
+	else
+	{
+		// Build a new list from the previous commands, while rendering the dirty spans anew.
+		Vector<Command> previous_commands;
+		previous_commands.swap(commands);
+		commands.reserve(previous_commands.size());
+
+		auto ReplayPreviousCommands = [&](int begin, int end) {
+			for (int i = begin; i < end; i++)
+			{
+				Execute(render_manager, previous_commands[i]);
+				commands.push_back(previous_commands[i]);
+			}
+			num_commands_replayed += end - begin;
+		};
+
+		int previous_index = 0;
+		for (int i = 0; i < (int)spans.size(); i++)
+		{
+			ElementSpan& span = spans[i];
+			ReplayPreviousCommands(previous_index, span.begin);
+			previous_index = span.end;
+
+			if (span.dirty)
+			{
+				RenderElementSpan(render_manager, i);
+			}
+			else
+			{
+				const int begin = (int)commands.size();
+				ReplayPreviousCommands(span.begin, span.end);
+				span.begin = begin;
+				span.end = (int)commands.size();
+			}
+		}
+
+		ReplayPreviousCommands(previous_index, (int)previous_commands.size());
+
+		// Geometry released while rendering the spans belonged to their elements, whose previous commands are now replaced.
+		num_released_geometry = RenderManagerAccess::GetNumReleasedGeometry(&render_manager);
+
+		// Spans rendered anew add to the command data, record the list from scratch once it has grown too much.
+		const size_t data_size = transforms.size() + clip_mask_lists.size() + composite_layers.size() + filter_handles.size();
+		if (data_size > 2 * recorded_data_size + 64)
+			dirty = true;
+	}
+
+	RenderStatistics& render_statistics = RenderManagerAccess::GetStatistics(&render_manager);
+	render_statistics = statistics;
+	render_statistics.commands_replayed = num_commands_replayed;
+}
+
+bool RenderCommandList::IsDirty(RenderManager& render_manager) const
+{
+	// Released resources may still be referenced by the commands.
+	return dirty || num_released_resources != RenderManagerAccess::GetNumReleasedResources(&render_manager) ||
+		num_released_geometry != RenderManagerAccess::GetNumReleasedGeometry(&render_manager);
+}
+
+void RenderCommandList::DirtyElement(Element* element)
+{
+	if (dirty)
+		return;
+
+	auto it = span_indices.find(element);
+	if (it != span_indices.end())
+	{
+		ElementSpan& span = spans[it->second];
+		if (!span.dirty)
+		{
+			span.dirty = true;
+			num_dirty_spans += 1;
+		}
+	}
+}
+
+void RenderCommandList::AddRender(StableVectorIndex geometry, Vector2f translation, Texture texture, CompiledShaderHandle shader)
+{
+	Command& command = AddCommand(Type::Render);
+	command.geometry = geometry;
+	command.translation = translation;
+	command.texture = texture;
+	command.shader = shader;
+}
+
+void RenderCommandList::AddScissorRegion(Rectanglei region)
+{
+	AddCommand(Type::ScissorRegion).scissor_region = region;
+}
+
+void RenderCommandList::AddClipMask(const ClipMaskGeometryList& clip_mask_list)
+{
+	if (clip_mask_list.empty())
+	{
+		AddCommand(Type::ClipMask, -1);
+		return;
+	}
+
+	AddCommand(Type::ClipMask, (int)clip_mask_lists.size());
+	clip_mask_lists.push_back(clip_mask_list);
+}
+
+void RenderCommandList::AddTransform(const Matrix4f* transform)
+{
+	if (!transform)
+	{
+		AddCommand(Type::Transform, -1);
+		return;
+	}
+
+	AddCommand(Type::Transform, (int)transforms.size());
+	transforms.push_back(*transform);
+}
+
+void RenderCommandList::AddPushLayer()
+{
+	AddCommand(Type::PushLayer);
+}
+
+void RenderCommandList::AddCompositeLayers(int source_depth, int destination_depth, BlendMode blend_mode, Span<const CompiledFilterHandle> filters)
+{
+	AddCommand(Type::CompositeLayers, (int)composite_layers.size());
+	composite_layers.push_back(CompositeLayersData{source_depth, destination_depth, blend_mode, (int)filter_handles.size(), (int)filters.size()});
+	filter_handles.insert(filter_handles.end(), filters.begin(), filters.end());
+}
+
+void RenderCommandList::AddPopLayer()
+{
+	AddCommand(Type::PopLayer);
+}
+
+void RenderCommandList::OnReleaseGeometry(StableVectorIndex geometry)
+{
+	// Temporary geometry, released right after being rendered, can't be replayed. Then render the element again during every replay.
+	const int begin = (open_span >= 0 ? spans[open_span].begin : 0);
+	for (int i = begin; i < (int)commands.size(); i++)
+	{
+		if (commands[i].type == Type::Render && commands[i].geometry == geometry)
+		{
+			if (open_span >= 0 && !spans[open_span].dirty)
+			{
+				spans[open_span].dirty = true;
+				num_dirty_spans += 1;
+			}
+			else if (open_span < 0)
+			{
+				dirty = true;
+			}
+			return;
+		}
+	}
+}
+
+void RenderCommandList::BeginElement(Element* element)
+{
+	RMLUI_ASSERTMSG(open_span < 0, "Elements should not render other elements while rendering their own geometry.");
+
+	open_span = (int)spans.size();
+	open_span_changes_state = false;
+
+	span_indices[element] = open_span;
+	spans.push_back(ElementSpan{element, (int)commands.size(), (int)commands.size(), false, false});
+}
+
+void RenderCommandList::EndElement(const RenderManager& render_manager)
+{
+	RMLUI_ASSERT(open_span >= 0 && open_span < (int)spans.size());
+
+	ElementSpan& span = spans[open_span];
+	span.end = (int)commands.size();
+	open_span = -1;
+
+	// Snapshot the state after the element, so that the following commands are unaffected if the span is replaced.
+	if (open_span_changes_state)
+	{
+		span.changes_state = true;
+		AddRenderState(render_manager.GetState());
+	}
+}
+
+auto RenderCommandList::AddCommand(Type type, int index) -> Command&
+{
+	if (open_span >= 0 && type != Type::Render)
+		open_span_changes_state = true;
+
+	commands.emplace_back();
+	Command& command = commands.back();
+	command.type = type;
+	command.index = index;
+	return command;
+}
+
+void RenderCommandList::AddRenderState(const RenderState& render_state)
+{
+	AddScissorRegion(render_state.scissor_region);
+	AddClipMask(render_state.clip_mask_list);
+	AddTransform(&render_state.transform);
+}
+
+void RenderCommandList::Execute(RenderManager& render_manager, const Command& command)
+{
+	switch (command.type)
+	{
+	case Type::Render:
+		RenderManagerAccess::RenderGeometry(&render_manager, command.geometry, command.translation, command.texture, command.shader);
+		break;
+	case Type::ScissorRegion: render_manager.SetScissorRegion(command.scissor_region); break;
+	case Type::ClipMask:
+		if (command.index < 0)
+			render_manager.DisableClipMask();
+		else
+			render_manager.SetClipMask(clip_mask_lists[command.index]);
+		break;
+	case Type::Transform: render_manager.SetTransform(command.index < 0 ? nullptr : &transforms[command.index]); break;
+	case Type::PushLayer: render_manager.PushLayer(); break;
+	case Type::CompositeLayers:
+	{
+		const CompositeLayersData& data = composite_layers[command.index];
+		RenderManagerAccess::CompositeLayers(&render_manager, data.source_depth, data.destination_depth, data.blend_mode,
+			Span<const CompiledFilterHandle>(filter_handles.data() + data.filters_begin, data.num_filters));
+	}
+	break;
+	case Type::PopLayer: render_manager.PopLayer(); break;
+	}
+}
+
+void RenderCommandList::RenderElementSpan(RenderManager& render_manager, int span_index)
+{
+	ElementSpan& span = spans[span_index];
+	span.dirty = false;
+	num_dirty_spans -= 1;
+
+	const RenderState initial_state = render_manager.GetState();
+
+	open_span = span_index;
+	open_span_changes_state = false;
+	span.begin = (int)commands.size();
+
+	RenderManagerAccess::SetCommandList(&render_manager, this);
+	span.element->RenderSelf();
+	RenderManagerAccess::SetCommandList(&render_manager, nullptr);
+
+	span.end = (int)commands.size();
+	open_span = -1;
+
+	// Unless the previous commands of this element changed the render state, the following commands have no snapshot
+	// to restore the state from. Then we need to add one.
+	if (open_span_changes_state && !span.changes_state)
+	{
+		render_manager.SetState(initial_state);
+		AddRenderState(initial_state);
+		span.changes_state = true;
+	}
+}
+
+} // namespace Rml
@@ -0,0 +1,141 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_RENDERCOMMANDLIST_H
+#define RMLUI_CORE_RENDERCOMMANDLIST_H
+
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "../../Include/RmlUi/Core/RenderManager.h"
+#include "../../Include/RmlUi/Core/StableVector.h"
+#include "../../Include/RmlUi/Core/Texture.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/*
+    The render commands submitted to a render manager while rendering the element tree, used for retained rendering.
+
+    Unchanged frames replay the recorded commands without visiting any elements. The commands submitted while rendering
+    an element's own background, decoration, and contents are kept as a separate span, so that an element changing
+    only its looks can have its span rendered again while the rest of the list is replayed. Any change to the layout,
+    stacking order, or render state of the elements requires the whole list to be recorded again.
+*/
+class RenderCommandList : NonCopyMoveable {
+public:
+	/// Renders the element and records the submitted commands, replacing any previous commands.
+	void Record(RenderManager& render_manager, Element* element);
+	/// Submits the recorded commands again, rendering any spans of dirty elements anew.
+	void Replay(RenderManager& render_manager);
+
+	/// Returns true if the list must be recorded again before it can be replayed.
+	bool IsDirty(RenderManager& render_manager) const;
+
+	/// Marks the span of the given element to be rendered again during the next replay, if it was recorded.
+	void DirtyElement(Element* element);
+	/// Marks all commands as dirty, requiring the list to be recorded again.
+	void DirtyAll() { dirty = true; }
+
+	/// Called by the render manager for every command submitted while recording.
+	void AddRender(StableVectorIndex geometry, Vector2f translation, Texture texture, CompiledShaderHandle shader);
+	void AddScissorRegion(Rectanglei region);
+	void AddClipMask(const ClipMaskGeometryList& clip_mask_list);
+	void AddTransform(const Matrix4f* transform);
+	void AddPushLayer();
+	void AddCompositeLayers(int source_depth, int destination_depth, BlendMode blend_mode, Span<const CompiledFilterHandle> filters);
+	void AddPopLayer();
+
+	/// Called by the render manager when geometry is released while recording.
+	void OnReleaseGeometry(StableVectorIndex geometry);
+
+	/// Called by elements around rendering their own geometry, before rendering their stacking context.
+	void BeginElement(Element* element);
+	void EndElement(const RenderManager& render_manager);
+
+private:
+	enum class Type : byte { Render, ScissorRegion, ClipMask, Transform, PushLayer, CompositeLayers, PopLayer };
+
+	struct Command {
+		Type type;
+		// Index into the data list of the command type, or -1 to disable the clip mask or transform.
+		int index;
+		Rectanglei scissor_region;
+		Vector2f translation;
+		StableVectorIndex geometry;
+		Texture texture;
+		CompiledShaderHandle shader;
+	};
+
+	struct CompositeLayersData {
+		// Layers are identified by their depth in the layer stack, as the layer handles may change between frames.
+		int source_depth;
+		int destination_depth;
+		BlendMode blend_mode;
+		int filters_begin;
+		int num_filters;
+	};
+
+	struct ElementSpan {
+		Element* element;
+		int begin;
+		int end;
+		bool dirty;
+		// True if the render state was changed by the element, in which case the following commands restore it.
+		bool changes_state;
+	};
+
+	Command& AddCommand(Type type, int index = -1);
+	void AddRenderState(const RenderState& render_state);
+	void Execute(RenderManager& render_manager, const Command& command);
+	void RenderElementSpan(RenderManager& render_manager, int span_index);
+
+	Vector<Command> commands;
+	Vector<Matrix4f> transforms;
+	Vector<ClipMaskGeometryList> clip_mask_lists;
+	Vector<CompositeLayersData> composite_layers;
+	Vector<CompiledFilterHandle> filter_handles;
+
+	Vector<ElementSpan> spans;
+	UnorderedMap<Element*, int> span_indices;
+	int num_dirty_spans = 0;
+
+	// The span currently being recorded, if any.
+	int open_span = -1;
+	bool open_span_changes_state = false;
+
+	bool dirty = true;
+	int num_released_resources = 0;
+	int num_released_geometry = 0;
+	// The size of the command data after recording, the data grows as dirty spans are rendered again.
+	size_t recorded_data_size = 0;
+	RenderStatistics statistics;
+};
+
+} // namespace Rml
+#endif
@@ -51,6 +51,11 @@ void RenderInterface::RenderToClipMask(ClipMaskOperation /*operation*/, Compiled
 
 void RenderInterface::SetTransform(const Matrix4f* /*transform*/) {}
 
+bool RenderInterface::UpdateTexture(TextureHandle /*texture*/, Span<const byte> /*source*/, Rectanglei /*region*/)
+{
+	return false;
+}
+
 LayerHandle RenderInterface::PushLayer()
 {
 	return {};
@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "RenderCommandList.h"
 #include "TextureDatabase.h"
 
 namespace Rml {
@@ -80,6 +81,7 @@ void RenderManager::PrepareRender(Vector2i dimensions)
 #endif
 
 	SetViewport(dimensions);
+	statistics = {};
 }
 
 void RenderManager::SetViewport(Vector2i dimensions)
@@ -120,6 +122,9 @@ void RenderManager::DisableScissorRegion()
 
 void RenderManager::SetScissorRegion(Rectanglei new_region)
 {
+	if (command_list)
+		command_list->AddScissorRegion(new_region);
+
 	const bool old_scissor_enable = state.scissor_region.Valid();
 	const bool new_scissor_enable = new_region.Valid();
 
@@ -144,6 +149,9 @@ Rectanglei RenderManager::GetScissorRegion() const
 
 void RenderManager::DisableClipMask()
 {
+	if (command_list)
+		command_list->AddClipMask({});
+
 	if (!state.clip_mask_list.empty())
 	{
 		state.clip_mask_list.clear();
@@ -155,11 +163,18 @@ void RenderManager::SetClipMask(ClipMaskOperation operation, Geometry* geometry,
 {
 	RMLUI_ASSERT(geometry && geometry->render_manager == this);
 	state.clip_mask_list = {ClipMaskGeometry{operation, geometry, translation, nullptr}};
+
+	if (command_list)
+		command_list->AddClipMask(state.clip_mask_list);
+
 	ApplyClipMask(state.clip_mask_list);
 }
 
 void RenderManager::SetClipMask(ClipMaskGeometryList in_clip_elements)
 {
+	if (command_list)
+		command_list->AddClipMask(in_clip_elements);
+
 	if (state.clip_mask_list != in_clip_elements)
 	{
 		state.clip_mask_list = std::move(in_clip_elements);
@@ -172,6 +187,9 @@ void RenderManager::SetTransform(const Matrix4f* p_new_transform)
 	static const Matrix4f identity_transform = Matrix4f::Identity();
 	const Matrix4f& new_transform = (p_new_transform ? *p_new_transform : identity_transform);
 
+	if (command_list)
+		command_list->AddTransform(p_new_transform);
+
 	if (state.transform != new_transform)
 	{
 		render_interface->SetTransform(p_new_transform);
@@ -186,6 +204,10 @@ void RenderManager::ApplyClipMask(const ClipMaskGeometryList& clip_elements)
 
 	if (clip_mask_enabled)
 	{
+		// The transforms used to render the clip mask are part of the clip mask command.
+		RenderCommandList* recording_command_list = command_list;
+		command_list = nullptr;
+
 		const Matrix4f initial_transform = state.transform;
 
 		for (const ClipMaskGeometry& element_clip : clip_elements)
@@ -198,6 +220,8 @@ void RenderManager::ApplyClipMask(const ClipMaskGeometryList& clip_elements)
 
 		// Apply the initially set transform in case it was changed.
 		SetTransform(&initial_transform);
+
+		command_list = recording_command_list;
 	}
 }
 
@@ -248,22 +272,54 @@ void RenderManager::Render(const Geometry& geometry, Vector2f translation, Textu
 		return;
 	}
 
-	if (CompiledGeometryHandle geometry_handle = GetCompiledGeometryHandle(geometry.resource_handle))
+	if (command_list)
+		command_list->AddRender(geometry.resource_handle, translation, texture, shader.resource_handle);
+
+	RenderGeometry(geometry.resource_handle, translation, texture, shader.resource_handle);
+}
+
+void RenderManager::RenderGeometry(StableVectorIndex geometry, Vector2f translation, Texture texture, CompiledShaderHandle shader)
+{
+	if (CompiledGeometryHandle geometry_handle = GetCompiledGeometryHandle(geometry))
 	{
 		TextureHandle texture_handle = {};
 		if (texture.file_index != TextureFileIndex::Invalid)
+		{
 			texture_handle = texture_database->file_database.GetHandle(render_interface, texture.file_index);
+		}
 		else if (texture.callback_index != StableVectorIndex::Invalid)
+		{
+			// Any commands submitted while generating the texture belong to the texture, and not to the recorded commands.
+			RenderCommandList* recording_command_list = command_list;
+			command_list = nullptr;
 			texture_handle = texture_database->callback_database.GetHandle(this, render_interface, texture.callback_index);
+			command_list = recording_command_list;
+		}
 
 		RMLUI_ZoneScopedNC("RenderGeometry", 0x3E60B2);
 		if (shader)
-			render_interface->RenderShader(shader.resource_handle, geometry_handle, translation, texture_handle);
+			render_interface->RenderShader(shader, geometry_handle, translation, texture_handle);
 		else
 			render_interface->RenderGeometry(geometry_handle, translation, texture_handle);
 	}
 }
 
+int RenderManager::GetLayerDepth(LayerHandle layer) const
+{
+	for (int i = (int)render_stack.size() - 1; i >= 0; i--)
+	{
+		if (render_stack[i] == layer)
+			return i;
+	}
+	return -1;
+}
+
+LayerHandle RenderManager::GetLayerAtDepth(int depth) const
+{
+	RMLUI_ASSERT(depth < (int)render_stack.size());
+	return depth < 0 ? LayerHandle{} : render_stack[depth];
+}
+
 void RenderManager::GetTextureSourceList(StringList& source_list) const
 {
 	texture_database->file_database.GetSourceList(source_list);
@@ -277,6 +333,7 @@ const Mesh& RenderManager::GetMesh(const Geometry& geometry) const
 
 bool RenderManager::ReleaseTexture(const String& texture_source)
 {
+	num_released_resources += 1;
 	return texture_database->file_database.ReleaseTexture(render_interface, texture_source);
 }
 
@@ -321,6 +378,9 @@ CompiledShader RenderManager::CompileShader(const String& name, const Dictionary
 
 LayerHandle RenderManager::PushLayer()
 {
+	if (command_list)
+		command_list->AddPushLayer();
+
 	const LayerHandle layer = render_interface->PushLayer();
 	render_stack.push_back(layer);
 	return layer;
@@ -330,12 +390,20 @@ void RenderManager::CompositeLayers(LayerHandle source, LayerHandle destination,
 {
 	RMLUI_ASSERT(source == 0 || std::find(render_stack.begin(), render_stack.end(), source) != render_stack.end());
 	RMLUI_ASSERT(destination == 0 || std::find(render_stack.begin(), render_stack.end(), destination) != render_stack.end());
+
+	if (command_list)
+		command_list->AddCompositeLayers(GetLayerDepth(source), GetLayerDepth(destination), blend_mode, filters);
+
 	render_interface->CompositeLayers(source, destination, blend_mode, filters);
 }
 
 void RenderManager::PopLayer()
 {
 	RMLUI_ASSERT(!render_stack.empty());
+
+	if (command_list)
+		command_list->AddPopLayer();
+
 	render_interface->PopLayer();
 	render_stack.pop_back();
 }
@@ -353,6 +421,10 @@ LayerHandle RenderManager::GetNextLayer() const
 
 CompiledFilter RenderManager::SaveLayerAsMaskImage()
 {
+	// The mask image is released after use, thus it can't be part of any replayed commands.
+	if (command_list)
+		command_list->DirtyAll();
+
 	if (CompiledFilterHandle handle = render_interface->SaveLayerAsMaskImage())
 	{
 		compiled_filter_count += 1;
@@ -365,6 +437,7 @@ void RenderManager::ReleaseResource(const CallbackTexture& texture)
 {
 	RMLUI_ASSERT(texture.render_manager == this && texture.resource_handle != texture.InvalidHandle());
 
+	num_released_resources += 1;
 	texture_database->callback_database.ReleaseTexture(render_interface, texture.resource_handle);
 }
 
@@ -373,6 +446,10 @@ Mesh RenderManager::ReleaseResource(const Geometry& geometry)
 	RMLUI_ASSERT(geometry.render_manager == this && geometry.resource_handle != geometry.InvalidHandle());
 	RMLUI_ZoneScopedNC("ReleaseGeometry", 0x1E60D2);
 
+	num_released_geometry += 1;
+	if (command_list)
+		command_list->OnReleaseGeometry(geometry.resource_handle);
+
 	GeometryData data = geometry_list.erase(geometry.resource_handle);
 	if (data.handle)
 		render_interface->ReleaseGeometry(data.handle);
@@ -383,6 +460,7 @@ void RenderManager::ReleaseResource(const CompiledFilter& filter)
 {
 	RMLUI_ASSERT(filter.render_manager == this && filter.resource_handle != filter.InvalidHandle());
 
+	num_released_resources += 1;
 	render_interface->ReleaseFilter(filter.resource_handle);
 	compiled_filter_count -= 1;
 }
@@ -391,6 +469,7 @@ void RenderManager::ReleaseResource(const CompiledShader& shader)
 {
 	RMLUI_ASSERT(shader.render_manager == this && shader.resource_handle != shader.InvalidHandle());
 
+	num_released_resources += 1;
 	render_interface->ReleaseShader(shader.resource_handle);
 	compiled_shader_count -= 1;
 }
@@ -39,7 +39,19 @@ Vector2i RenderManagerAccess::GetDimensions(RenderManager* render_manager, Textu
 
 Vector2i RenderManagerAccess::GetDimensions(RenderManager* render_manager, StableVectorIndex callback_texture)
 {
-	return render_manager->texture_database->callback_database.GetDimensions(render_manager, render_manager->render_interface, callback_texture);
+	// Any commands submitted while generating the texture belong to the texture, and not to the recorded commands.
+	RenderCommandList* recording_command_list = render_manager->command_list;
+	render_manager->command_list = nullptr;
+	const Vector2i dimensions =
+		render_manager->texture_database->callback_database.GetDimensions(render_manager, render_manager->render_interface, callback_texture);
+	render_manager->command_list = recording_command_list;
+	return dimensions;
+}
+
+void RenderManagerAccess::UpdateTexture(RenderManager* render_manager, StableVectorIndex callback_texture, Span<const byte> source,
+	Rectanglei region)
+{
+	render_manager->texture_database->callback_database.UpdateTexture(render_manager->render_interface, callback_texture, source, region);
 }
 
 void RenderManagerAccess::Render(RenderManager* render_manager, const Geometry& geometry, Vector2f translation, Texture texture,
@@ -48,6 +60,19 @@ void RenderManagerAccess::Render(RenderManager* render_manager, const Geometry&
 	render_manager->Render(geometry, translation, texture, shader);
 }
 
+void RenderManagerAccess::RenderGeometry(RenderManager* render_manager, StableVectorIndex geometry, Vector2f translation, Texture texture,
+	CompiledShaderHandle shader)
+{
+	render_manager->RenderGeometry(geometry, translation, texture, shader);
+}
+
+void RenderManagerAccess::CompositeLayers(RenderManager* render_manager, int source_depth, int destination_depth, BlendMode blend_mode,
+	Span<const CompiledFilterHandle> filters)
+{
+	render_manager->CompositeLayers(render_manager->GetLayerAtDepth(source_depth), render_manager->GetLayerAtDepth(destination_depth), blend_mode,
+		filters);
+}
+
 void RenderManagerAccess::GetTextureSourceList(RenderManager* render_manager, StringList& source_list)
 {
 	render_manager->GetTextureSourceList(source_list);
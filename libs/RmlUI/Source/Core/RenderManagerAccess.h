@@ -51,6 +51,7 @@ private:
 
 	static Vector2i GetDimensions(RenderManager* render_manager, TextureFileIndex texture);
 	static Vector2i GetDimensions(RenderManager* render_manager, StableVectorIndex callback_texture);
+	static void UpdateTexture(RenderManager* render_manager, StableVectorIndex callback_texture, Span<const byte> source, Rectanglei region);
 
 	static void Render(RenderManager* render_manager, const Geometry& geometry, Vector2f translation, Texture texture, const CompiledShader& shader);
 
@@ -61,10 +62,23 @@ private:
 	static void ReleaseAllTextures(RenderManager* render_manager);
 	static void ReleaseAllCompiledGeometry(RenderManager* render_manager);
 
+	static RenderStatistics& GetStatistics(RenderManager* render_manager) { return render_manager->statistics; }
+
+	static RenderCommandList* GetCommandList(RenderManager* render_manager) { return render_manager->command_list; }
+	static void SetCommandList(RenderManager* render_manager, RenderCommandList* command_list) { render_manager->command_list = command_list; }
+	static int GetNumReleasedResources(RenderManager* render_manager) { return render_manager->num_released_resources; }
+	static int GetNumReleasedGeometry(RenderManager* render_manager) { return render_manager->num_released_geometry; }
+	static void RenderGeometry(RenderManager* render_manager, StableVectorIndex geometry, Vector2f translation, Texture texture,
+		CompiledShaderHandle shader);
+	static void CompositeLayers(RenderManager* render_manager, int source_depth, int destination_depth, BlendMode blend_mode,
+		Span<const CompiledFilterHandle> filters);
+
 	friend class CompiledFilter;
 	friend class CompiledShader;
 	friend class CallbackTexture;
+	friend class Element;
 	friend class Geometry;
+	friend class RenderCommandList;
 	friend class Texture;
 
 	friend StringList Rml::GetTextureSourceList();
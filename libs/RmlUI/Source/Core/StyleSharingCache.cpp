@@ -26,71 +26,44 @@
  *
  */
 
-#include "TextureLayoutRectangle.h"
+#include "StyleSharingCache.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "ElementDefinition.h"
 
 namespace Rml {
 
-TextureLayoutRectangle::TextureLayoutRectangle(const int _id, const Vector2i dimensions) : dimensions(dimensions), texture_position(0, 0)
+Style::SharedValuesPtr StyleSharingCache::Find(const Key& key) const
 {
-	id = _id;
-	texture_index = -1;
-
-	texture_data = nullptr;
-	texture_stride = 0;
+	for (int i = 0; i < num_entries; i++)
+	{
+		const Key& entry_key = entries[i].key;
+		if (entry_key.definition == key.definition && entry_key.parent_values == key.parent_values &&
+			entry_key.document_font_size == key.document_font_size && entry_key.dp_ratio == key.dp_ratio &&
+			entry_key.vp_dimensions == key.vp_dimensions)
+		{
+			return entries[i].values;
+		}
+	}
+	return nullptr;
 }
 
-TextureLayoutRectangle::~TextureLayoutRectangle() {}
-
-int TextureLayoutRectangle::GetId() const
+void StyleSharingCache::Insert(Key key, Style::SharedValuesPtr values)
 {
-	return id;
-}
+	// The entries keep their definition and parent values alive, so that their addresses can't be reused by others.
+	Entry& entry = entries[next_entry];
+	entry.key = std::move(key);
+	entry.values = std::move(values);
 
-Vector2i TextureLayoutRectangle::GetPosition() const
-{
-	return texture_position;
-}
-
-Vector2i TextureLayoutRectangle::GetDimensions() const
-{
-	return dimensions;
-}
-
-void TextureLayoutRectangle::Place(const int _texture_index, const Vector2i position)
-{
-	texture_index = _texture_index;
-	texture_position = position;
-}
-
-void TextureLayoutRectangle::Unplace()
-{
-	texture_index = -1;
-}
-
-bool TextureLayoutRectangle::IsPlaced() const
-{
-	return texture_index > -1;
-}
-
-void TextureLayoutRectangle::Allocate(byte* _texture_data, int _texture_stride)
-{
-	texture_data = _texture_data + ((texture_position.y * _texture_stride) + texture_position.x * 4);
-	texture_stride = _texture_stride;
-}
-
-int TextureLayoutRectangle::GetTextureIndex()
-{
-	return texture_index;
-}
-
-byte* TextureLayoutRectangle::GetTextureData()
-{
-	return texture_data;
+	next_entry = (next_entry + 1) % max_num_entries;
+	num_entries = Math::Min(num_entries + 1, max_num_entries);
 }
 
-int TextureLayoutRectangle::GetTextureStride() const
+void StyleSharingCache::Clear()
 {
-	return texture_stride;
+	for (int i = 0; i < num_entries; i++)
+		entries[i] = Entry{};
+	num_entries = 0;
+	next_entry = 0;
 }
 
 } // namespace Rml
@@ -0,0 +1,78 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_STYLESHARINGCACHE_H
+#define RMLUI_CORE_STYLESHARINGCACHE_H
+
+#include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class ElementDefinition;
+
+/*
+    A small cache of recently computed values in a document, keyed by all the inputs used to compute them.
+
+    Elements without any inline properties are fully styled by their definition and their parent's values. When such
+    siblings or cousins share the same definition and equal parent values, they can refer to the very same computed
+    values instead of computing and storing their own copy.
+*/
+class StyleSharingCache {
+public:
+	struct Key {
+		SharedPtr<const ElementDefinition> definition;
+		Style::SharedValuesPtr parent_values;
+		float document_font_size;
+		float dp_ratio;
+		Vector2f vp_dimensions;
+	};
+
+	/// Returns the values previously computed from the given inputs, or nullptr if there are none.
+	Style::SharedValuesPtr Find(const Key& key) const;
+	/// Stores values computed from the given inputs, replacing the oldest entry when full.
+	void Insert(Key key, Style::SharedValuesPtr values);
+
+	/// Removes all entries, such as when any of the values are no longer valid for their inputs.
+	void Clear();
+
+private:
+	static constexpr int max_num_entries = 32;
+
+	struct Entry {
+		Key key;
+		Style::SharedValuesPtr values;
+	};
+
+	Entry entries[max_num_entries];
+	int num_entries = 0;
+	int next_entry = 0;
+};
+
+} // namespace Rml
+#endif
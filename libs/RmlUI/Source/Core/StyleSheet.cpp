@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
+#include "AncestorFilter.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
 #include "StyleSheetNode.h"
@@ -190,16 +191,17 @@ const Sprite* StyleSheet::GetSprite(const String& name) const
 	return spritesheet_list.GetSprite(name);
 }
 
-SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Element* element) const
+SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Element* element, const AncestorFilter* ancestor_filter) const
 {
-	RMLUI_ASSERT_NONRECURSIVE;
-
-	// Using static to avoid allocations. Make sure we don't call this function recursively.
-	static Vector<const StyleSheetNode*> applicable_nodes;
+	// Using thread-local storage to avoid allocations, definitions may be resolved on several threads at once.
+	static thread_local Vector<const StyleSheetNode*> applicable_nodes;
 	applicable_nodes.clear();
 
-	auto AddApplicableNodes = [element](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
-		auto it_nodes = node_index.find(Hash<String>()(key));
+	if (ancestor_filter && !ancestor_filter->IsValidFor(element))
+		ancestor_filter = nullptr;
+
+	auto AddApplicableNodes = [element, ancestor_filter](const StyleSheetIndex::NodeIndex& node_index, size_t key) {
+		auto it_nodes = node_index.find(key);
 		if (it_nodes != node_index.end())
 		{
 			const StyleSheetIndex::NodeList& nodes = it_nodes->second;
@@ -209,34 +211,41 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 				// We found a node that has at least one requirement matching the element. Now see if we satisfy the remaining requirements of the
 				// node, including all ancestor nodes. What this involves is traversing the style nodes backwards, trying to match nodes in the
 				// element's hierarchy to nodes in the style hierarchy.
-				if (node->IsApplicable(element, nullptr))
+				if (node->IsApplicable(element, nullptr, ancestor_filter))
 					applicable_nodes.push_back(node);
 			}
 		}
 	};
 
 	// See if there are any styles defined for this element.
-	const String& tag = element->GetTagName();
-	const String& id = element->GetId();
-	const StringList& class_names = element->GetStyle()->GetClassNameList();
+	const ElementStyle* style = element->GetStyle();
 
 	// Text elements are never matched.
-	if (tag == "#text")
+	if (element->GetTagName() == "#text")
 		return nullptr;
 
 	// First, look up the indexed requirements.
-	if (!id.empty())
-		AddApplicableNodes(styled_node_index.ids, id);
+	if (style->GetIdAtom() != Atom::Invalid)
+		AddApplicableNodes(styled_node_index.ids, size_t(style->GetIdAtom()));
+
+	for (Atom class_atom : style->GetClassAtoms())
+		AddApplicableNodes(styled_node_index.classes, size_t(class_atom));
 
-	for (const String& name : class_names)
-		AddApplicableNodes(styled_node_index.classes, name);
+	AddApplicableNodes(styled_node_index.tags, size_t(style->GetTagAtom()));
 
-	AddApplicableNodes(styled_node_index.tags, tag);
+	if (!styled_node_index.pseudo_classes.empty())
+		style->ForEachPseudoClass([&](PseudoClassId pseudo_class) { AddApplicableNodes(styled_node_index.pseudo_classes, size_t(pseudo_class)); });
+
+	if (!styled_node_index.attributes.empty())
+	{
+		for (const auto& attribute : element->GetAttributes())
+			AddApplicableNodes(styled_node_index.attributes, Hash<String>()(attribute.first));
+	}
 
 	// Also check all remaining nodes that don't contain any indexed requirements.
 	for (const StyleSheetNode* node : styled_node_index.other)
 	{
-		if (node->IsApplicable(element, nullptr))
+		if (node->IsApplicable(element, nullptr, ancestor_filter))
 			applicable_nodes.push_back(node);
 	}
 
@@ -254,6 +263,7 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 	});
 
 	// Check if this puppy has already been cached in the node index.
+	std::lock_guard<std::mutex> lock(node_cache_mutex);
 	SharedPtr<const ElementDefinition>& definition = node_cache[applicable_nodes];
 	if (!definition)
 	{
@@ -30,6 +30,8 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "AncestorFilter.h"
+#include "ElementStyle.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetSelector.h"
 #include <algorithm>
@@ -42,6 +44,13 @@ static inline bool IsTextElement(const Element* element)
 	return element->GetTagName() == "#text";
 }
 
+// Returns true if every class in the selector is set on the element, both lists must be sorted.
+static inline bool MatchClasses(const AtomList& selector_classes, const ElementStyle* style)
+{
+	const AtomList& element_classes = style->GetClassAtoms();
+	return std::includes(element_classes.begin(), element_classes.end(), selector_classes.begin(), selector_classes.end());
+}
+
 StyleSheetNode::StyleSheetNode()
 {
 	CalculateAndSetSpecificity();
@@ -50,11 +59,13 @@ StyleSheetNode::StyleSheetNode()
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, const CompoundSelector& selector) : parent(parent), selector(selector)
 {
 	CalculateAndSetSpecificity();
+	CalculateAncestorHashes();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, CompoundSelector&& selector) : parent(parent), selector(std::move(selector))
 {
 	CalculateAndSetSpecificity();
+	CalculateAncestorHashes();
 }
 
 StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const CompoundSelector& other)
@@ -129,8 +140,8 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 	// If this has properties defined, then we insert it into the styled node index.
 	if (properties.GetNumProperties() > 0)
 	{
-		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, const String& key, const StyleSheetNode* node) {
-			StyleSheetIndex::NodeList& nodes = node_index[Hash<String>()(key)];
+		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, size_t key, const StyleSheetNode* node) {
+			StyleSheetIndex::NodeList& nodes = node_index[key];
 			auto it = std::find(nodes.begin(), nodes.end(), node);
 			if (it == nodes.end())
 				nodes.push_back(node);
@@ -138,19 +149,27 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 
 		// Add this node to the appropriate index for looking up applicable nodes later. Prioritize the most unique requirement first and the most
 		// general requirement last. This way we are able to rule out as many nodes as possible as quickly as possible.
-		if (!selector.id.empty())
+		if (selector.id != Atom::Invalid)
 		{
-			IndexInsertNode(styled_node_index.ids, selector.id, this);
+			IndexInsertNode(styled_node_index.ids, size_t(selector.id), this);
 		}
-		else if (!selector.class_names.empty())
+		else if (!selector.classes.empty())
 		{
 			// @performance Right now we just use the first class for simplicity. Later we may want to devise a better strategy to try to add the
 			// class with the most unique name. For example by adding the class from this node's list that has the fewest existing matches.
-			IndexInsertNode(styled_node_index.classes, selector.class_names.front(), this);
+			IndexInsertNode(styled_node_index.classes, size_t(selector.classes.front()), this);
+		}
+		else if (selector.tag != Atom::Invalid)
+		{
+			IndexInsertNode(styled_node_index.tags, size_t(selector.tag), this);
+		}
+		else if (!selector.pseudo_classes.empty())
+		{
+			IndexInsertNode(styled_node_index.pseudo_classes, size_t(selector.pseudo_classes.front()), this);
 		}
-		else if (!selector.tag.empty())
+		else if (!selector.attributes.empty())
 		{
-			IndexInsertNode(styled_node_index.tags, selector.tag, this);
+			IndexInsertNode(styled_node_index.attributes, Hash<String>()(selector.attributes.front().name), this);
 		}
 		else
 		{
@@ -179,21 +198,20 @@ const PropertyDictionary& StyleSheetNode::GetProperties() const
 
 bool StyleSheetNode::Match(const Element* element, const Element* scope) const
 {
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	const ElementStyle* style = element->GetStyle();
+
+	if (selector.tag != Atom::Invalid && selector.tag != style->GetTagAtom())
 		return false;
 
-	if (!selector.id.empty() && selector.id != element->GetId())
+	if (selector.id != Atom::Invalid && selector.id != style->GetIdAtom())
 		return false;
 
-	for (auto& name : selector.class_names)
-	{
-		if (!element->IsClassSet(name))
-			return false;
-	}
+	if (!selector.classes.empty() && !MatchClasses(selector.classes, style))
+		return false;
 
-	for (auto& name : selector.pseudo_class_names)
+	for (PseudoClassId pseudo_class : selector.pseudo_classes)
 	{
-		if (!element->IsPseudoClassSet(name))
+		if (!style->IsPseudoClassSet(pseudo_class))
 			return false;
 	}
 
@@ -355,34 +373,37 @@ bool StyleSheetNode::TraverseMatch(const Element* element, const Element* scope)
 	return false;
 }
 
-bool StyleSheetNode::IsApplicable(const Element* element, const Element* scope) const
+bool StyleSheetNode::IsApplicable(const Element* element, const Element* scope, const AncestorFilter* ancestor_filter) const
 {
 	// Determine whether the element matches the current node and its entire lineage. The entire hierarchy of the element's document will be
 	// considered during the match as necessary.
 
 	// We could in principle just call Match() here and then go on with the ancestor style nodes. Instead, we test the requirements of this node in a
 	// particular order for performance reasons.
-	for (const String& name : selector.pseudo_class_names)
+	const ElementStyle* style = element->GetStyle();
+
+	for (PseudoClassId pseudo_class : selector.pseudo_classes)
 	{
-		if (!element->IsPseudoClassSet(name))
+		if (!style->IsPseudoClassSet(pseudo_class))
 			return false;
 	}
 
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	if (selector.tag != Atom::Invalid && selector.tag != style->GetTagAtom())
 		return false;
 
-	for (const String& name : selector.class_names)
-	{
-		if (!element->IsClassSet(name))
-			return false;
-	}
+	if (!selector.classes.empty() && !MatchClasses(selector.classes, style))
+		return false;
 
-	if (!selector.id.empty() && selector.id != element->GetId())
+	if (selector.id != Atom::Invalid && selector.id != style->GetIdAtom())
 		return false;
 
 	if (!selector.attributes.empty() && !MatchAttributes(element))
 		return false;
 
+	// Rule out any names required of the ancestors in constant time, before walking the hierarchy.
+	if (ancestor_filter && !ancestor_filter->MightContainAll(ancestor_hashes))
+		return false;
+
 	// Check the structural selector requirements last as they can be quite slow.
 	if (!selector.structural_selectors.empty() && !MatchStructuralSelector(element, scope))
 		return false;
@@ -399,15 +420,15 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 	// First calculate the specificity of this node alone.
 	specificity = 0;
 
-	if (!selector.tag.empty())
+	if (selector.tag != Atom::Invalid)
 		specificity += SelectorSpecificity::Tag;
 
-	if (!selector.id.empty())
+	if (selector.id != Atom::Invalid)
 		specificity += SelectorSpecificity::ID;
 
-	specificity += SelectorSpecificity::Class * (int)selector.class_names.size();
+	specificity += SelectorSpecificity::Class * (int)selector.classes.size();
 	specificity += SelectorSpecificity::Attribute * (int)selector.attributes.size();
-	specificity += SelectorSpecificity::PseudoClass * (int)selector.pseudo_class_names.size();
+	specificity += SelectorSpecificity::PseudoClass * (int)selector.pseudo_classes.size();
 
 	for (const StructuralSelector& selector : selector.structural_selectors)
 		specificity += selector.specificity;
@@ -417,4 +438,32 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 		specificity += parent->specificity;
 }
 
+void StyleSheetNode::CalculateAncestorHashes()
+{
+	Vector<uint32_t> id_hashes, class_hashes, tag_hashes;
+
+	for (const StyleSheetNode* node = this; node->parent && node->parent->parent; node = node->parent)
+	{
+		// Only descendant and child combinators match the parent node against an ancestor, the sibling combinators match it against a sibling.
+		if (node->selector.combinator != SelectorCombinator::Descendant && node->selector.combinator != SelectorCombinator::Child)
+			continue;
+
+		const CompoundSelector& ancestor = node->parent->selector;
+		if (ancestor.id != Atom::Invalid)
+			id_hashes.push_back(AncestorFilter::GetHash(ancestor.id, AncestorFilter::NameType::Id));
+		for (Atom class_atom : ancestor.classes)
+			class_hashes.push_back(AncestorFilter::GetHash(class_atom, AncestorFilter::NameType::Class));
+		if (ancestor.tag != Atom::Invalid)
+			tag_hashes.push_back(AncestorFilter::GetHash(ancestor.tag, AncestorFilter::NameType::Tag));
+	}
+
+	// Keep only a few of the most unique names, as each additional name gives diminishing returns.
+	constexpr size_t max_ancestor_hashes = 4;
+	ancestor_hashes = std::move(id_hashes);
+	ancestor_hashes.insert(ancestor_hashes.end(), class_hashes.begin(), class_hashes.end());
+	ancestor_hashes.insert(ancestor_hashes.end(), tag_hashes.begin(), tag_hashes.end());
+	if (ancestor_hashes.size() > max_ancestor_hashes)
+		ancestor_hashes.resize(max_ancestor_hashes);
+}
+
 } // namespace Rml
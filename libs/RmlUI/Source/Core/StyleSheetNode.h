@@ -35,6 +35,7 @@
 
 namespace Rml {
 
+class AncestorFilter;
 struct StyleSheetIndex;
 class StyleSheetNode;
 using StyleSheetNodeList = Vector<UniquePtr<StyleSheetNode>>;
@@ -74,13 +75,16 @@ public:
 	/// Returns true if this node is applicable to the given element, given its IDs, classes and heritage.
 	/// @note For performance reasons this call does not check whether 'element' is a text element. The caller must manually check this condition and
 	/// consider any text element not applicable.
-	bool IsApplicable(const Element* element, const Element* scope) const;
+	/// @param[in] ancestor_filter If set, must represent the ancestors of the element. Used to quickly rule out the node based on its ancestor
+	/// requirements.
+	bool IsApplicable(const Element* element, const Element* scope, const AncestorFilter* ancestor_filter = nullptr) const;
 
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
 
 private:
 	void CalculateAndSetSpecificity();
+	void CalculateAncestorHashes();
 
 	// Match an element to the local node requirements.
 	inline bool Match(const Element* element, const Element* scope) const;
@@ -99,6 +103,9 @@ private:
 	// A measure of specificity of this node; the attribute in a node with a higher value will override those of a node with a lower value.
 	int specificity = 0;
 
+	// Hashes of the most unique names required of the element's ancestors by our parent nodes, to be looked up in the ancestor filter.
+	Vector<uint32_t> ancestor_hashes;
+
 	PropertyDictionary properties;
 
 	StyleSheetNodeList children;
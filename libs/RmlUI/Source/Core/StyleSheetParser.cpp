@@ -37,6 +37,7 @@
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetContainer.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
+#include "Atom.h"
 #include "ComputeProperty.h"
 #include "ControlledLifetimeResource.h"
 #include "StyleSheetFactory.h"
@@ -967,8 +968,8 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 
 				switch (rule[start_index])
 				{
-				case '#': selector.id = String(p_begin + 1, p_end); break;
-				case '.': selector.class_names.push_back(String(p_begin + 1, p_end)); break;
+				case '#': selector.id = AtomTable::GetOrInsert(String(p_begin + 1, p_end)); break;
+				case '.': selector.classes.push_back(AtomTable::GetOrInsert(String(p_begin + 1, p_end))); break;
 				case ':':
 				{
 					String pseudo_class_name = String(p_begin + 1, p_end);
@@ -976,7 +977,7 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 					if (node_selector.type != StructuralSelectorType::Invalid)
 						selector.structural_selectors.push_back(node_selector);
 					else
-						selector.pseudo_class_names.push_back(std::move(pseudo_class_name));
+						selector.pseudo_classes.push_back(AtomTable::GetOrInsertPseudoClass(pseudo_class_name));
 				}
 				break;
 				case '[':
@@ -1014,7 +1015,7 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 					selector.attributes.push_back(std::move(attribute));
 				}
 				break;
-				default: selector.tag = String(p_begin, p_end); break;
+				default: selector.tag = AtomTable::GetOrInsert(String(p_begin, p_end)); break;
 				}
 			}
 
@@ -1027,9 +1028,9 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 		}
 
 		// Sort the classes and pseudo-classes so they are consistent across equivalent declarations that shuffle the order around.
-		std::sort(selector.class_names.begin(), selector.class_names.end());
+		std::sort(selector.classes.begin(), selector.classes.end());
 		std::sort(selector.attributes.begin(), selector.attributes.end());
-		std::sort(selector.pseudo_class_names.begin(), selector.pseudo_class_names.end());
+		std::sort(selector.pseudo_classes.begin(), selector.pseudo_classes.end());
 		std::sort(selector.structural_selectors.begin(), selector.structural_selectors.end());
 
 		// Add the new child node, or retrieve the existing child if we have an exact match.
@@ -28,6 +28,7 @@
 
 #include "StyleSheetSelector.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "ElementStyle.h"
 #include "StyleSheetNode.h"
 #include <tuple>
 
@@ -38,6 +39,11 @@ static inline bool IsTextElement(const Element* element)
 	return element->GetTagName() == "#text";
 }
 
+static inline bool IsSameType(const Element* a, const Element* b)
+{
+	return a->GetStyle()->GetTagAtom() == b->GetStyle()->GetTagAtom();
+}
+
 // Returns true if a positive integer can be found for n in the equation an + b = count.
 static bool IsNth(int a, int b, int count)
 {
@@ -77,9 +83,9 @@ bool operator==(const CompoundSelector& a, const CompoundSelector& b)
 		return false;
 	if (a.id != b.id)
 		return false;
-	if (a.class_names != b.class_names)
+	if (a.classes != b.classes)
 		return false;
-	if (a.pseudo_class_names != b.pseudo_class_names)
+	if (a.pseudo_classes != b.pseudo_classes)
 		return false;
 	if (a.attributes != b.attributes)
 		return false;
@@ -166,7 +172,7 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 				break;
 
 			// Skip nodes that don't share our tag.
-			if (child->GetTagName() != element->GetTagName())
+			if (!IsSameType(child, element))
 				continue;
 
 			element_index++;
@@ -192,7 +198,7 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 				break;
 
 			// Skip nodes that don't share our tag.
-			if (child->GetTagName() != element->GetTagName())
+			if (!IsSameType(child, element))
 				continue;
 
 			element_index++;
@@ -266,7 +272,7 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 				return true;
 
 			// Otherwise, if this child shares our element's tag, then our element is not the first tagged child; the selector fails.
-			if (child->GetTagName() == element->GetTagName())
+			if (IsSameType(child, element))
 				return false;
 
 			child_index++;
@@ -290,7 +296,7 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 				return true;
 
 			// Otherwise, if this child shares our element's tag, then our element is not the first tagged child; the selector fails.
-			if (child->GetTagName() == element->GetTagName())
+			if (IsSameType(child, element))
 				return false;
 
 			child_index--;
@@ -340,7 +346,7 @@ bool IsSelectorApplicable(const Element* element, const StructuralSelector& sele
 				continue;
 
 			// Skip the child if it does not share our tag.
-			if (child->GetTagName() != element->GetTagName())
+			if (!IsSameType(child, element))
 				continue;
 
 			// We've found a similarly-tagged child to our element; selector fails.
@@ -30,6 +30,7 @@
 #define RMLUI_CORE_STYLESHEETSELECTOR_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include "Atom.h"
 
 namespace Rml {
 
@@ -137,12 +138,14 @@ using StructuralSelectorList = Vector<StructuralSelector>;
     Compound selector contains all the basic selectors for a single node.
 
     Such as div#foo.bar:nth-child(2)
+
+    Names are stored as atoms, with the classes and pseudo classes sorted by their value.
  */
 struct CompoundSelector {
-	String tag;
-	String id;
-	StringList class_names;
-	StringList pseudo_class_names;
+	Atom tag = Atom::Invalid;
+	Atom id = Atom::Invalid;
+	AtomList classes;
+	PseudoClassIdList pseudo_classes;
 	AttributeSelectorList attributes;
 	StructuralSelectorList structural_selectors;
 	SelectorCombinator combinator = SelectorCombinator::Descendant; // Determines how to match with our parent node.
@@ -0,0 +1,189 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TextureAtlas.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include <algorithm>
+#include <string.h>
+
+namespace Rml {
+
+// Rectangles are separated by this many transparent pixels, so that linear filtering does not bleed between neighbours.
+static constexpr int atlas_padding = 1;
+static constexpr int min_page_size = 128;
+
+TextureAtlas::TextureAtlas(int max_page_size) : max_page_size(max_page_size) {}
+
+bool TextureAtlas::Insert(Vector<Entry>& entries)
+{
+	Vector<Entry*> sorted_entries;
+	sorted_entries.reserve(entries.size());
+	for (Entry& entry : entries)
+	{
+		entry.page = -1;
+		if (entry.dimensions.x > 0 && entry.dimensions.y > 0)
+			sorted_entries.push_back(&entry);
+	}
+
+	// Tallest first, so that shelves are filled with entries of similar height.
+	std::stable_sort(sorted_entries.begin(), sorted_entries.end(),
+		[](const Entry* lhs, const Entry* rhs) { return lhs->dimensions.y > rhs->dimensions.y; });
+
+	bool result = true;
+
+	for (size_t i = 0; i < sorted_entries.size(); i++)
+	{
+		Entry& entry = *sorted_entries[i];
+		const Vector2i padded_dimensions = entry.dimensions + Vector2i(atlas_padding);
+
+		if (padded_dimensions.x + atlas_padding > max_page_size || padded_dimensions.y + atlas_padding > max_page_size)
+		{
+			result = false;
+			continue;
+		}
+
+		for (int page_index = 0; page_index < (int)pages.size(); page_index++)
+		{
+			if (PlaceOnPage(pages[page_index], padded_dimensions, entry.position))
+			{
+				entry.page = page_index;
+				break;
+			}
+		}
+
+		if (entry.page >= 0)
+			continue;
+
+		// Size the new page for the remaining entries with room to spare for glyphs added later, under optimal packing.
+		int remaining_area = 0;
+		int largest_side = 0;
+		for (size_t j = i; j < sorted_entries.size(); j++)
+		{
+			const Vector2i dimensions = sorted_entries[j]->dimensions + Vector2i(atlas_padding);
+			remaining_area += dimensions.x * dimensions.y;
+			largest_side = Math::Max(largest_side, Math::Max(dimensions.x, dimensions.y) + atlas_padding);
+		}
+
+		Page page;
+		page.size = Math::ToPowerOfTwo(Math::Max(int(Math::SquareRoot(2.f * float(remaining_area))), largest_side));
+		page.size = Math::Clamp(page.size, min_page_size, max_page_size);
+		page.data.resize(size_t(page.size * page.size * 4), 0);
+		pages.push_back(std::move(page));
+
+		const bool placed = PlaceOnPage(pages.back(), padded_dimensions, entry.position);
+		RMLUI_ASSERT(placed);
+		(void)placed;
+		entry.page = (int)pages.size() - 1;
+	}
+
+	return result;
+}
+
+bool TextureAtlas::PlaceOnPage(Page& page, Vector2i dimensions, Vector2i& out_position)
+{
+	// Best fit: the lowest shelf that is tall enough and still has room.
+	Shelf* best_shelf = nullptr;
+	for (Shelf& shelf : page.shelves)
+	{
+		if (dimensions.y <= shelf.height && shelf.width + dimensions.x <= page.size && (!best_shelf || shelf.height < best_shelf->height))
+			best_shelf = &shelf;
+	}
+
+	if (!best_shelf)
+	{
+		if (page.shelves_height + dimensions.y > page.size || atlas_padding + dimensions.x > page.size)
+			return false;
+
+		page.shelves.push_back(Shelf{page.shelves_height, dimensions.y, atlas_padding});
+		page.shelves_height += dimensions.y;
+		best_shelf = &page.shelves.back();
+	}
+
+	out_position = Vector2i(best_shelf->width, best_shelf->y);
+	best_shelf->width += dimensions.x;
+
+	const Rectanglei placed_region = Rectanglei::FromPositionSize(out_position, dimensions - Vector2i(atlas_padding));
+	page.dirty_region = (page.dirty_region.Valid() ? page.dirty_region.Join(placed_region) : placed_region);
+
+	return true;
+}
+
+int TextureAtlas::GetNumPages() const
+{
+	return (int)pages.size();
+}
+
+Vector2i TextureAtlas::GetPageDimensions(int page) const
+{
+	RMLUI_ASSERT(page >= 0 && page < GetNumPages());
+	return Vector2i(pages[page].size);
+}
+
+byte* TextureAtlas::GetPageData(int page, Vector2i position)
+{
+	RMLUI_ASSERT(page >= 0 && page < GetNumPages());
+	return pages[page].data.data() + (position.y * pages[page].size + position.x) * 4;
+}
+
+int TextureAtlas::GetPageStride(int page) const
+{
+	RMLUI_ASSERT(page >= 0 && page < GetNumPages());
+	return pages[page].size * 4;
+}
+
+Span<const byte> TextureAtlas::GetPageData(int page) const
+{
+	RMLUI_ASSERT(page >= 0 && page < GetNumPages());
+	return pages[page].data;
+}
+
+Rectanglei TextureAtlas::TakeDirtyRegion(int page_index, Vector<byte>& region_data)
+{
+	RMLUI_ASSERT(page_index >= 0 && page_index < GetNumPages());
+	Page& page = pages[page_index];
+
+	const Rectanglei region = page.dirty_region;
+	page.dirty_region = Rectanglei::MakeInvalid();
+	if (!region.Valid() || region.Width() == 0 || region.Height() == 0)
+		return Rectanglei::MakeInvalid();
+
+	const int row_bytes = region.Width() * 4;
+	region_data.resize(size_t(row_bytes * region.Height()));
+	for (int y = 0; y < region.Height(); y++)
+		memcpy(region_data.data() + y * row_bytes, GetPageData(page_index, region.Position() + Vector2i(0, y)), row_bytes);
+
+	return region;
+}
+
+void TextureAtlas::MarkClean(int page)
+{
+	RMLUI_ASSERT(page >= 0 && page < GetNumPages());
+	pages[page].dirty_region = Rectanglei::MakeInvalid();
+}
+
+} // namespace Rml
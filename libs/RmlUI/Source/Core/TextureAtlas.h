@@ -0,0 +1,102 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_TEXTUREATLAS_H
+#define RMLUI_CORE_TEXTUREATLAS_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    An append-only texture atlas, used by the font system to store glyphs.
+
+    Rectangles are packed onto shelves across a series of square RGBA8 pages. Placed rectangles never move and pages never
+    resize, so adding to the atlas keeps all previously returned positions valid. Each page tracks the region written to
+    since it was last uploaded, so that only that part needs to be sent to the renderer.
+ */
+
+class TextureAtlas {
+public:
+	struct Entry {
+		// Client-specified identifier, not used by the atlas.
+		int id = 0;
+		Vector2i dimensions;
+		// Set by Insert(), -1 if the entry is empty or could not be placed.
+		int page = -1;
+		Vector2i position;
+	};
+
+	/// @param[in] max_page_size The maximum width and height of any page.
+	TextureAtlas(int max_page_size = 1024);
+
+	/// Places new entries in the atlas, adding pages as required. Entries are packed tallest first.
+	/// @param[in,out] entries The entries to place, their page and position is written back.
+	/// @return False if any entry was larger than the maximum page size, true otherwise.
+	bool Insert(Vector<Entry>& entries);
+
+	int GetNumPages() const;
+	Vector2i GetPageDimensions(int page) const;
+
+	/// Returns the pixels of the given rectangle in a page, for writing into.
+	byte* GetPageData(int page, Vector2i position);
+	/// Returns the stride in bytes between rows of a page.
+	int GetPageStride(int page) const;
+	/// Returns the full contents of a page.
+	Span<const byte> GetPageData(int page) const;
+
+	/// Copies out the region of a page modified since the last call, and marks the page clean.
+	/// @param[out] region_data The pixels of the region, tightly packed.
+	/// @return The dirty region, or an invalid rectangle if the page is clean.
+	Rectanglei TakeDirtyRegion(int page, Vector<byte>& region_data);
+	/// Marks a page clean without copying out its modified region, such as when the full page is about to be uploaded.
+	void MarkClean(int page);
+
+private:
+	struct Shelf {
+		int y;
+		int height;
+		int width;
+	};
+
+	struct Page {
+		int size = 0;
+		Vector<byte> data;
+		Vector<Shelf> shelves;
+		int shelves_height = 1;
+		Rectanglei dirty_region = Rectanglei::MakeInvalid();
+	};
+
+	bool PlaceOnPage(Page& page, Vector2i dimensions, Vector2i& out_position);
+
+	int max_page_size;
+	Vector<Page> pages;
+};
+
+} // namespace Rml
+#endif
@@ -71,6 +71,21 @@ TextureHandle CallbackTextureDatabase::GetHandle(RenderManager* render_manager,
 	return EnsureLoaded(render_manager, render_interface, callback_index).texture_handle;
 }
 
+void CallbackTextureDatabase::UpdateTexture(RenderInterface* render_interface, StableVectorIndex callback_index, Span<const byte> source,
+	Rectanglei region)
+{
+	CallbackTextureEntry& data = texture_list[callback_index];
+	if (!data.texture_handle)
+		return;
+
+	if (render_interface->UpdateTexture(data.texture_handle, source, region))
+		return;
+
+	render_interface->ReleaseTexture(data.texture_handle);
+	data.texture_handle = {};
+	data.dimensions = {};
+}
+
 auto CallbackTextureDatabase::EnsureLoaded(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index)
 	-> CallbackTextureEntry&
 {
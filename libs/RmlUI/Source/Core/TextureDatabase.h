@@ -48,6 +48,10 @@ public:
 	Vector2i GetDimensions(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index);
 	TextureHandle GetHandle(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index);
 
+	// Overwrites a region of a generated texture. If the render interface cannot update textures in place, the texture is released so that
+	// the callback generates it again on next use. Textures not yet generated are left alone, they will pick up the new contents when they are.
+	void UpdateTexture(RenderInterface* render_interface, StableVectorIndex callback_index, Span<const byte> source, Rectanglei region);
+
 	size_t size() const;
 
 	void ReleaseAllTextures(RenderInterface* render_interface);
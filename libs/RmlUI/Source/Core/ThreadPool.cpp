@@ -0,0 +1,128 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "ThreadPool.h"
+#include "../../Include/RmlUi/Core/Math.h"
+
+namespace Rml {
+
+ThreadPool::ThreadPool(int num_threads)
+{
+	threads.reserve(num_threads);
+	for (int i = 0; i < num_threads; i++)
+		threads.emplace_back([this] { WorkerLoop(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	work_available.notify_all();
+
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+int ThreadPool::GetNumThreads() const
+{
+	return (int)threads.size();
+}
+
+void ThreadPool::ParallelFor(int count, int chunk_size, const Function<void(int begin, int end)>& function)
+{
+	RMLUI_ASSERT(chunk_size > 0);
+	if (count <= 0)
+		return;
+
+	// Not worth waking up the workers for a single chunk.
+	if (threads.empty() || count <= chunk_size)
+	{
+		function(0, count);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		job_function = &function;
+		job_count = count;
+		job_chunk_size = chunk_size;
+		next_index = 0;
+		job_generation += 1;
+		num_busy_workers = (int)threads.size();
+	}
+	work_available.notify_all();
+
+	RunChunks();
+
+	std::unique_lock<std::mutex> lock(mutex);
+	work_finished.wait(lock, [this] { return num_busy_workers == 0; });
+	job_function = nullptr;
+}
+
+void ThreadPool::WorkerLoop()
+{
+	uint64_t handled_generation = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			work_available.wait(lock, [&] { return stopping || job_generation != handled_generation; });
+			if (stopping)
+				return;
+			handled_generation = job_generation;
+		}
+
+		RunChunks();
+
+		bool last_worker = false;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			num_busy_workers -= 1;
+			last_worker = (num_busy_workers == 0);
+		}
+		if (last_worker)
+			work_finished.notify_one();
+	}
+}
+
+void ThreadPool::RunChunks()
+{
+	while (true)
+	{
+		const int begin = next_index.fetch_add(job_chunk_size);
+		if (begin >= job_count)
+			break;
+
+		const int end = Math::Min(begin + job_chunk_size, job_count);
+		(*job_function)(begin, end);
+	}
+}
+
+} // namespace Rml
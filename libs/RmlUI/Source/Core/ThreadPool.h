@@ -0,0 +1,82 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUI_CORE_THREADPOOL_H
+#define RMLUI_CORE_THREADPOOL_H
+
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+
+/**
+    A fixed set of worker threads for running data-parallel loops.
+
+    A loop is split into chunks that the workers and the calling thread take from a shared counter, so that threads which
+    finish early continue with the remaining chunks instead of waiting on slower ones.
+ */
+
+class ThreadPool : public NonCopyMoveable {
+public:
+	/// @param[in] num_threads The number of worker threads, in addition to the calling thread.
+	ThreadPool(int num_threads);
+	~ThreadPool();
+
+	int GetNumThreads() const;
+
+	/// Calls the function on consecutive ranges [begin, end) covering [0, count), spread over all threads. Returns when every range is done.
+	/// @param[in] count The number of items in the loop.
+	/// @param[in] chunk_size The maximum number of items in each range.
+	/// @param[in] function The function to call for each range, must be safe to call concurrently.
+	void ParallelFor(int count, int chunk_size, const Function<void(int begin, int end)>& function);
+
+private:
+	void WorkerLoop();
+	void RunChunks();
+
+	Vector<std::thread> threads;
+
+	std::mutex mutex;
+	std::condition_variable work_available;
+	std::condition_variable work_finished;
+	bool stopping = false;
+	uint64_t job_generation = 0;
+	int num_busy_workers = 0;
+
+	// The current job, set by the calling thread while holding the mutex.
+	const Function<void(int, int)>* job_function = nullptr;
+	int job_count = 0;
+	int job_chunk_size = 0;
+	std::atomic<int> next_index{0};
+};
+
+} // namespace Rml
+#endif
@@ -166,6 +166,7 @@ void WidgetScroll::Update()
 					ScrollLineDown();
 			}
 
+			RequestUpdate();
 			if (Context* ctx = parent->GetContext())
 				ctx->RequestNextUpdate(arrow_timers[i]);
 		}
@@ -378,7 +379,7 @@ void WidgetScroll::ProcessEvent(Event& event)
 				if (traversable_track_length > 0)
 				{
 					float traversable_track_origin = track->GetAbsoluteOffset().x + bar_drag_anchor;
-					new_bar_position = (event.GetParameter("mouse_x", 0.f) - traversable_track_origin) / traversable_track_length;
+					new_bar_position = (event.GetMousePosition().x - traversable_track_origin) / traversable_track_length;
 				}
 			}
 			else
@@ -387,7 +388,7 @@ void WidgetScroll::ProcessEvent(Event& event)
 				if (traversable_track_length > 0)
 				{
 					float traversable_track_origin = track->GetAbsoluteOffset().y + bar_drag_anchor;
-					new_bar_position = (event.GetParameter("mouse_y", 0.f) - traversable_track_origin) / traversable_track_length;
+					new_bar_position = (event.GetMousePosition().y - traversable_track_origin) / traversable_track_length;
 				}
 			}
 
@@ -397,9 +398,9 @@ void WidgetScroll::ProcessEvent(Event& event)
 		else if (event == EventId::Dragstart)
 		{
 			if (orientation == HORIZONTAL)
-				bar_drag_anchor = event.GetParameter("mouse_x", 0.f) - bar->GetAbsoluteOffset().x;
+				bar_drag_anchor = event.GetMousePosition().x - bar->GetAbsoluteOffset().x;
 			else
-				bar_drag_anchor = event.GetParameter("mouse_y", 0.f) - bar->GetAbsoluteOffset().y;
+				bar_drag_anchor = event.GetMousePosition().y - bar->GetAbsoluteOffset().y;
 		}
 	}
 	else if (event.GetTargetElement() == track)
@@ -409,12 +410,12 @@ void WidgetScroll::ProcessEvent(Event& event)
 			float click_position = 0.f;
 			if (orientation == HORIZONTAL)
 			{
-				float mouse_position = event.GetParameter("mouse_x", 0.f);
+				float mouse_position = event.GetMousePosition().x;
 				click_position = (mouse_position - track->GetAbsoluteOffset().x) / track->GetBox().GetSize().x;
 			}
 			else
 			{
-				float mouse_position = event.GetParameter<float>("mouse_y", 0);
+				float mouse_position = event.GetMousePosition().y;
 				click_position = (mouse_position - track->GetAbsoluteOffset().y) / track->GetBox().GetSize().y;
 			}
 
@@ -431,12 +432,14 @@ void WidgetScroll::ProcessEvent(Event& event)
 		{
 			arrow_timers[0] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			RequestUpdate();
 			ScrollLineUp();
 		}
 		else if (event.GetTargetElement() == arrows[1])
 		{
 			arrow_timers[1] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			RequestUpdate();
 			ScrollLineDown();
 		}
 	}
@@ -504,6 +507,12 @@ void WidgetScroll::ScrollPageUp()
 	Scroll(-SCROLL_PAGE_FACTOR * bar_length, ScrollBehavior::Auto);
 }
 
+void WidgetScroll::RequestUpdate()
+{
+	if (Element* element_scroll = parent->GetParentNode())
+		element_scroll->RequestUpdate();
+}
+
 void WidgetScroll::Scroll(float distance, ScrollBehavior behavior)
 {
 	float traversable_track_length = (track_length - bar_length);
@@ -103,6 +103,9 @@ private:
 	// Scrolls the parent element by the given distance.
 	void Scroll(float distance, ScrollBehavior behavior);
 
+	// Updates the scrolled element during the next context update, which advances our arrow timers.
+	void RequestUpdate();
+
 	Element* parent;
 
 	Orientation orientation;
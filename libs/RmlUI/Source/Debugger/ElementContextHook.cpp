@@ -51,7 +51,8 @@ void ElementContextHook::OnRender()
 	// Make sure we're in the front of the render queue for this context (at least next frame).
 	PullToFront();
 
-	// Render the debugging elements.
+	// Render the debugging elements, which are not part of any retained render commands.
+	DirtyRender();
 	debugger->Render();
 }
 
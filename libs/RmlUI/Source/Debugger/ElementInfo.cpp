@@ -94,6 +94,9 @@ void ElementInfo::Reset()
 
 void ElementInfo::OnUpdate()
 {
+	// The source element is polled for changes, so keep updating.
+	RequestUpdate();
+
 	if (source_element && (update_source_element || force_update_once) && IsVisible())
 	{
 		const double t = GetSystemInterface()->GetElapsedTime();
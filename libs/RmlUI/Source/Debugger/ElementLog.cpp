@@ -192,6 +192,7 @@ void ElementLog::AddLogMessage(Log::Type type, const String& message)
 
 	// Force a refresh of the RML.
 	dirty_logs = true;
+	RequestUpdate();
 }
 
 void ElementLog::OnUpdate()
@@ -267,6 +268,7 @@ void ElementLog::ProcessEvent(Event& event)
 					}
 				}
 				dirty_logs = true;
+				RequestUpdate();
 			}
 			else
 			{
@@ -280,6 +282,7 @@ void ElementLog::ProcessEvent(Event& event)
 						else
 							event.GetTargetElement()->SetInnerRML("Off");
 						dirty_logs = true;
+						RequestUpdate();
 					}
 				}
 			}
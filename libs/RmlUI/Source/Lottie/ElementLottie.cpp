@@ -69,6 +69,9 @@ void ElementLottie::OnUpdate()
 	if (!animation)
 		return;
 
+	// Keep updating to request new frames while the animation is playing.
+	RequestUpdate();
+
 	const auto t = GetSystemInterface()->GetElapsedTime();
 
 	if (time_animation_start < 0.0)
@@ -88,6 +91,9 @@ void ElementLottie::OnRender()
 {
 	if (animation)
 	{
+		// The texture is updated with the current frame of the animation on every render.
+		DirtyRender();
+
 		if (geometry_dirty)
 			GenerateGeometry();
 
@@ -109,6 +115,7 @@ void ElementLottie::OnAttributeChange(const ElementAttributes& changed_attribute
 	if (changed_attributes.count("src"))
 	{
 		animation_dirty = true;
+		RequestUpdate();
 		DirtyLayout();
 	}
 }
@@ -0,0 +1,130 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<title>Benchmark Sample</title>
+	<style>
+		@keyframes fade {
+			from { opacity: 1; }
+			to   { opacity: 0.2; }
+		}
+		@keyframes spin {
+			from { transform: rotate(0deg); }
+			to   { transform: rotate(180deg); }
+		}
+		@keyframes tint {
+			from { image-color: #fff; }
+			to   { image-color: #f00; }
+		}
+		@keyframes grow {
+			from { width: 4px; }
+			to   { width: 12px; }
+		}
+		body {
+			width: 800px;
+			height: 600px;
+		}
+		div {
+			display: inline-block;
+			width: 8px;
+			height: 8px;
+			margin: 1px;
+			background: #fff;
+		}
+		.opacity div { animation: fade 1s infinite alternate; }
+		.transform div { animation: spin 1s infinite alternate; }
+		.image-color div { animation: tint 1s infinite alternate; }
+		.width div { animation: grow 1s infinite alternate; }
+	</style>
+</head>
+
+<body/>
+</rml>
+)";
+
+TEST_CASE("animation")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	constexpr int num_elements = 2000;
+	String rml;
+	for (int i = 0; i < num_elements; i++)
+		rml += "<div/>";
+	document->SetInnerRML(rml);
+
+	auto IncrementTime = [system_interface = TestsShell::GetTestsSystemInterface(), t = 0.0]() mutable {
+		constexpr double dt = 1.0 / 60.0;
+		t += dt;
+		system_interface->SetTime(t);
+	};
+
+	nanobench::Bench bench;
+	bench.title("Animation of 2000 elements");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	for (const char* property : {"opacity", "transform", "image-color", "width"})
+	{
+		document->SetClassNames(property);
+		context->Update();
+		context->Render();
+
+		bench.run(String("Update (") + property + ")", [&] {
+			IncrementTime();
+			context->Update();
+		});
+		bench.run(String("Update + Render (") + property + ")", [&] {
+			IncrementTime();
+			context->Update();
+			context->Render();
+		});
+	}
+
+	document->Close();
+	TestsShell::GetTestsSystemInterface()->SetTime(0.0);
+}
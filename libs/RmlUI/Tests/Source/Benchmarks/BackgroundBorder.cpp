@@ -140,3 +140,67 @@ TEST_CASE("backgrounds_and_borders")
 
 	document->Close();
 }
+
+static String document_box_shadow_rml = R"(
+<rml>
+<head>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body > div {
+			display: inline-block;
+			margin: 10px;
+			width: 180px;
+			height: 120px;
+			background: #fff;
+			border: 1px #ccc;
+			border-radius: 8px;
+			box-shadow: #000a 0 4px 12px, #0005 0 1px 3px;
+		}
+	</style>
+</head>
+
+<body/>
+</rml>
+)";
+
+TEST_CASE("box_shadows")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_box_shadow_rml);
+	REQUIRE(document);
+
+	String rml;
+	for (int i = 0; i < 100; i++)
+		rml += "<div/>";
+	document->SetInnerRML(rml);
+	document->Show();
+
+	nanobench::Bench bench;
+	bench.title("Box shadows");
+	bench.relative(true);
+	bench.minEpochIterations(100);
+	bench.warmup(50);
+
+	TestsShell::RenderLoop();
+
+	bench.run("Reference (update + render)", [&] {
+		context->Update();
+		context->Render();
+	});
+
+	ElementList elements;
+	document->QuerySelectorAll(elements, "body > div");
+	REQUIRE(!elements.empty());
+
+	bench.run("Box-shadow all", [&] {
+		// Force regeneration of the box-shadows without changing layout
+		for (auto& element : elements)
+			element->SetProperty(Rml::PropertyId::BackgroundColor, Rml::Property(Colourb(255, 255, 255), Unit::COLOUR));
+		context->Update();
+		context->Render();
+	});
+
+	document->Close();
+}
@@ -83,6 +83,15 @@ static const String document_rml = R"(
 <p><span data-for="arrays.b">{{ it }} </span></p>
 <p><span data-for="arrays.c">{{ it.val }} </span></p>
 <p><span data-for="arrays.d">{{ 'a: ' + it.a + ', b: ' + it.b + ', c: ' + it.c.val + ' :: ' }}</span></p>
+
+<div id="rows" style="display: none">
+<div class="row" data-for="row, i : rows">
+	<span class="index">{{ i }}</span>
+	<span class="name" data-class-large="row.a > 10">{{ row.c.val }}</span>
+	<span class="values">a: {{ row.a }}, b: {{ row.b }}</span>
+	<button data-attr-value="row.a">Select</button>
+</div>
+</div>
 </div>
 </body>
 </rml>
@@ -115,6 +124,7 @@ struct Arrays {
 
 static UniquePtr<Basic> basic;
 static UniquePtr<Arrays> arrays;
+static Vector<Basic> rows;
 
 static DataModelHandle InitializeDataBindings(Context* context)
 {
@@ -153,6 +163,7 @@ static DataModelHandle InitializeDataBindings(Context* context)
 	}
 	arrays = MakeUnique<Arrays>();
 	constructor.Bind("arrays", arrays.get());
+	constructor.Bind("rows", &rows);
 
 	DataModelHandle model_handle = constructor.GetModelHandle();
 
@@ -239,6 +250,54 @@ TEST_CASE("data_binding")
 		});
 	}
 
+	SUBCASE("for")
+	{
+		nanobench::Bench bench;
+		bench.title("Data bindings: Populate data-for rows");
+		bench.relative(true);
+
+		for (int num_rows : {100, 1000})
+		{
+			bench.complexityN(num_rows);
+			bench.run("Populate " + ToString(num_rows) + " rows", [&] {
+				rows.resize(num_rows);
+				model_handle.DirtyVariable("rows");
+				context->Update();
+
+				rows.clear();
+				model_handle.DirtyVariable("rows");
+				context->Update();
+			});
+		}
+	}
+
+	SUBCASE("for_resize")
+	{
+		nanobench::Bench bench;
+		bench.title("Data bindings: Grow and shrink data-for rows");
+		bench.relative(true);
+
+		for (int num_rows : {1000, 5000})
+		{
+			const int step = num_rows / 10;
+			bench.complexityN(num_rows);
+			bench.run("Grow and shrink " + ToString(num_rows) + " rows", [&] {
+				for (int size = step; size <= num_rows; size += step)
+				{
+					rows.resize(size);
+					model_handle.DirtyVariable("rows");
+					context->Update();
+				}
+				for (int size = num_rows - step; size >= 0; size -= step)
+				{
+					rows.resize(size);
+					model_handle.DirtyVariable("rows");
+					context->Update();
+				}
+			});
+		}
+	}
+
 	TestsShell::RenderLoop();
 
 	document->Close();
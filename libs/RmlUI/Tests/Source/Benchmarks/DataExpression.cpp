@@ -53,11 +53,11 @@ TEST_CASE("data_expressions")
 	bench.title("Data expression");
 	bench.relative(true);
 
-	auto bench_expression = [&](const String& expression, const char* parse_name, const char* execute_name) {
+	auto bench_program = [&](const String& expression, bool is_assignment, const String& name) {
 		DataParser parser(expression, interface);
 
 		bool result = true;
-		bench.run(parse_name, [&] { result &= parser.Parse(false); });
+		bench.run(name + " (parse)", [&] { result &= parser.Parse(is_assignment); });
 
 		REQUIRE(result);
 
@@ -65,33 +65,27 @@ TEST_CASE("data_expressions")
 		AddressList addresses = parser.ReleaseAddresses();
 		DataInterpreter interpreter(program, addresses, interface);
 
-		bench.run(execute_name, [&] { result &= interpreter.Run(); });
+		bench.run(name + " (execute)", [&] { result &= interpreter.Run(); });
 
 		REQUIRE(result);
-	};
-
-	bench_expression("2 * 2", "Simple (parse)", "Simple (execute)");
-
-	bench_expression("true || false ? true && radius==1+2 ? 'Absolutely!' : color_value : 'no'", "Complex (parse)", "Complex (execute)");
 
-	auto bench_assignment = [&](const String& expression, const char* parse_name, const char* execute_name) {
-		DataParser parser(expression, interface);
+		DataCompiler compiler(program, addresses, interface);
+		compiler.Compile();
+		VariableList variables = compiler.ReleaseVariables();
+		DataInterpreter compiled_interpreter(program, addresses, interface, &variables);
 
-		bool result = true;
-		bench.run(parse_name, [&] { result &= parser.Parse(true); });
+		bench.run(name + " (execute compiled)", [&] { result &= compiled_interpreter.Run(); });
 
 		REQUIRE(result);
+	};
 
-		Program program = parser.ReleaseProgram();
-		AddressList addresses = parser.ReleaseAddresses();
-		DataInterpreter interpreter(program, addresses, interface);
+	bench_program("2 * 2", false, "Simple");
 
-		bench.run(execute_name, [&] { result &= interpreter.Run(); });
+	bench_program("true || false ? true && radius==1+2 ? 'Absolutely!' : color_value : 'no'", false, "Complex");
 
-		REQUIRE(result);
-	};
+	bench_program("radius * 2 + 1 < 20 ? (radius | format(1)) + 'px' : color_name + ' overflow'", false, "Mixed");
 
-	bench_assignment("radius = 15", "Simple assign (parse)", "Simple assign (execute)");
+	bench_program("radius = 15", true, "Simple assign");
 
-	bench_assignment("radius = radius*radius*3.14; color_name = 'image-color'", "Complex assign (parse)", "Complex assign (execute)");
+	bench_program("radius = radius*radius*3.14; color_name = 'image-color'", true, "Complex assign");
 }
@@ -30,6 +30,9 @@
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementText.h>
+#include <RmlUi/Core/Event.h>
+#include <RmlUi/Core/EventListener.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 #include <nanobench.h>
@@ -174,6 +177,16 @@ TEST_CASE("element.creation_and_destruction")
 		context->Update();
 	});
 
+	bool text_toggle = true;
+	auto text_element = rmlui_dynamic_cast<ElementText*>(child->GetChild(2)->GetChild(0));
+	REQUIRE(text_element);
+
+	bench.run("Update (text of single element)", [&] {
+		text_element->SetText(text_toggle ? "Unassigned" : "Assigned");
+		text_toggle = !text_toggle;
+		context->Update();
+	});
+
 	bench.run("Render", [&] { context->Render(); });
 
 	bench.run("SetInnerRML", [&] { el->SetInnerRML(rml); });
@@ -255,6 +268,212 @@ TEST_CASE("element.long_texts")
 	document->Close();
 }
 
+TEST_CASE("element.relayout_boundary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+	el->SetInnerRML(GenerateRml(50, DefaultRow));
+
+	Element* status = document->AppendChild(document->CreateElement("div"));
+	status->SetInnerRML("<span>0</span> units");
+	auto text_element = rmlui_dynamic_cast<ElementText*>(status->GetChild(0)->GetChild(0));
+	REQUIRE(text_element);
+
+	context->Update();
+	context->Render();
+
+	nanobench::Bench bench;
+	bench.title("Relayout boundary");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	int counter = 0;
+	auto update_counter = [&] {
+		text_element->SetText(ToString(counter++ % 1000));
+		context->Update();
+	};
+
+	// Without a fixed size, the status element is laid out as part of the document flow. Its siblings are still
+	// reused from the layout cache as long as they are unaffected.
+	bench.run("Update (text in flow)", update_counter);
+
+	// A fixed-size element establishing its own formatting context can be laid out in isolation.
+	status->SetProperty(PropertyId::Width, Property(200.f, Unit::PX));
+	status->SetProperty(PropertyId::Height, Property(30.f, Unit::PX));
+	status->SetProperty(PropertyId::OverflowX, Property(Style::Overflow::Hidden));
+	status->SetProperty(PropertyId::OverflowY, Property(Style::Overflow::Hidden));
+	context->Update();
+
+	bench.run("Update (text inside relayout boundary)", update_counter);
+
+	document->Close();
+}
+
+TEST_CASE("element.hit_test")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+	el->SetInnerRML(GenerateRml(200, DefaultRow));
+
+	context->Update();
+	context->Render();
+
+	nanobench::Bench bench;
+	bench.title("Hit test");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	// Sweep the mouse across the rows, so that the hover chain changes on most moves.
+	int counter = 0;
+	auto next_position = [&] {
+		counter = (counter + 1) % 1000;
+		return Vector2i(120 + (counter * 7) % 800, 80 + (counter * 13) % 500);
+	};
+
+	bench.run("GetElementAtPoint", [&] {
+		const Vector2i position = next_position();
+		nanobench::doNotOptimizeAway(context->GetElementAtPoint(Vector2f(position)));
+	});
+
+	bench.run("ProcessMouseMove", [&] {
+		const Vector2i position = next_position();
+		context->ProcessMouseMove(position.x, position.y, 0);
+	});
+
+	bench.run("ProcessMouseMove + Update", [&] {
+		const Vector2i position = next_position();
+		context->ProcessMouseMove(position.x, position.y, 0);
+		context->Update();
+	});
+
+	document->Close();
+}
+
+class MousePositionListener : public EventListener {
+public:
+	void ProcessEvent(Event& event) override { position += event.GetMousePosition() + Vector2f(float(event.GetKeyModifierState())); }
+	Vector2f position;
+};
+
+TEST_CASE("element.event_dispatch")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+	el->SetInnerRML(GenerateRml(50, DefaultRow));
+
+	MousePositionListener listener;
+	document->AddEventListener(EventId::Mousemove, &listener);
+	document->AddEventListener(EventId::Mousedown, &listener);
+	document->AddEventListener(EventId::Mouseup, &listener);
+	document->AddEventListener(EventId::Keydown, &listener, true);
+
+	context->Update();
+	context->Render();
+
+	nanobench::Bench bench;
+	bench.title("Event dispatch");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+	bench.minEpochIterations(100);
+
+	// Jitter the mouse by a single pixel, so that the hover chain stays the same and only the move events are dispatched.
+	int counter = 0;
+	bench.run("ProcessMouseMove", [&] {
+		counter = (counter + 1) % 2;
+		context->ProcessMouseMove(400 + counter, 150, 0);
+	});
+
+	bench.run("ProcessMouseButtonDown + Up", [&] {
+		context->ProcessMouseButtonDown(1, 0);
+		context->ProcessMouseButtonUp(1, 0);
+	});
+
+	bench.run("ProcessKeyDown", [&] { context->ProcessKeyDown(Input::KI_F5, Input::KM_SHIFT); });
+
+	Dictionary parameters = {{"mouse_x", Variant(400)}, {"mouse_y", Variant(150)}};
+	Element* target = context->GetHoverElement();
+	REQUIRE(target);
+	bench.run("DispatchEvent (dictionary)", [&] { target->DispatchEvent(EventId::Mousemove, parameters); });
+
+	nanobench::doNotOptimizeAway(listener.position);
+
+	document->RemoveEventListener(EventId::Mousemove, &listener);
+	document->RemoveEventListener(EventId::Mousedown, &listener);
+	document->RemoveEventListener(EventId::Mouseup, &listener);
+	document->RemoveEventListener(EventId::Keydown, &listener, true);
+	document->Close();
+}
+
+TEST_CASE("element.retained_rendering")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+	el->SetInnerRML(GenerateRml(50, DefaultRow));
+
+	context->Update();
+	context->Render();
+
+	nanobench::Bench bench;
+	bench.title("Retained rendering");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	bench.run("Render (immediate)", [&] { context->Render(); });
+
+	context->EnableRetainedRendering(true);
+	context->Render();
+
+	bench.run("Render (retained)", [&] { context->Render(); });
+
+	bool color_toggle = true;
+	Element* child = el->GetChild(25);
+	bench.run("Update + Render (retained, color of single element)", [&] {
+		child->SetProperty(PropertyId::BackgroundColor, Property(color_toggle ? Colourb(255, 0, 0) : Colourb(0, 0, 255), Unit::COLOUR));
+		color_toggle = !color_toggle;
+		context->Update();
+		context->Render();
+	});
+
+	context->EnableRetainedRendering(false);
+
+	bench.run("Update + Render (immediate, color of single element)", [&] {
+		child->SetProperty(PropertyId::BackgroundColor, Property(color_toggle ? Colourb(255, 0, 0) : Colourb(0, 0, 255), Unit::COLOUR));
+		color_toggle = !color_toggle;
+		context->Update();
+		context->Render();
+	});
+
+	document->Close();
+}
+
 TEST_CASE("element.asymptotic_complexity")
 {
 	Context* context = TestsShell::GetContext();
@@ -548,8 +548,8 @@ TEST_CASE("flexbox.chat")
 	// The flex items will essentially be formatted four times each:
 	//   - Two times during flex formatting, first to get their height, then to do their actual formatting.
 	//   - Then flex formatting is itself done twice, since the body adds a scrollbar, thereby modifying the available width.
-	// The long words take longer to format, since we do a naive approach to breaking up words in ElementText::GenerateLine, making us calculate
-	// string widths repeatedly. Removing the 'word-break' property should make the long word-case much faster.
+	// The long words need to be broken up in ElementText::GenerateLine. The break point is found by a binary search over the prefix widths of the
+	// word, which are measured once and cached by the font engine, so this case should be comparable to the short words.
 	ElementDocument* document = context->LoadDocumentFromMemory(rml_flexbox_chatbox);
 	Element* chat = document->GetElementById("chat");
 	chat->SetInnerRML(short_words + long_words);
@@ -668,3 +668,66 @@ TEST_CASE("flexbox.shrink-to-fit")
 
 	document->Close();
 }
+
+static const String rml_flexbox_nested = R"(
+<rml>
+<head>
+    <title>Flex - Nested</title>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { width: 1000px; }
+		.row, .column {
+			display: flex;
+			border: 1px #aac;
+			padding: 2px;
+		}
+		.row { flex-direction: row; }
+		.column { flex-direction: column; }
+		.item { flex: 1 1 auto; }
+	</style>
+</head>
+<body id="body"/>
+</rml>
+)";
+
+static String MakeNestedFlexRml(int depth)
+{
+	if (depth == 0)
+		return "<div class=\"item\">Lorem ipsum dolor sit amet</div>";
+
+	const String child = MakeNestedFlexRml(depth - 1);
+	return CreateString("<div class=\"item %s\">", depth % 2 == 0 ? "row" : "column") + child + child + "</div>";
+}
+
+TEST_CASE("flexbox.nested")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	nanobench::Bench bench;
+	bench.title("Flexbox nested");
+	bench.relative(true);
+
+	// Six levels of nested flex containers, alternating between row and column direction. Each flex container measures
+	// its items before formatting them, which recursively applies to all nested flex containers as well.
+	const String rml = MakeNestedFlexRml(6);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_flexbox_nested);
+	document->SetInnerRML(rml);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	bool toggle = false;
+	bench.run("Update (resize)", [&] {
+		document->SetProperty(PropertyId::Width, Property(toggle ? 1000.f : 900.f, Unit::PX));
+		toggle = !toggle;
+		context->Update();
+	});
+
+	bench.run("SetInnerRML + Update", [&] {
+		document->SetInnerRML(rml);
+		context->Update();
+	});
+
+	document->Close();
+}
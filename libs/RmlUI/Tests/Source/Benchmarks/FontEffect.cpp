@@ -28,6 +28,7 @@
 
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/ConvolutionFilter.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
 #include <RmlUi/Core/Types.h>
@@ -85,3 +86,60 @@ TEST_CASE("font_effect")
 
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("font_effect.convolution_filter")
+{
+	// Run the filters directly on a buffer the size of a large glyph atlas.
+	const Vector2i dimensions(512, 512);
+	constexpr int radius = 10;
+
+	Vector<byte> source(dimensions.x * dimensions.y);
+	for (int i = 0; i < (int)source.size(); i++)
+		source[i] = byte((i * 7919) % 251);
+
+	const Vector2i destination_dimensions = dimensions + Vector2i(2 * radius);
+	const int destination_stride = destination_dimensions.x * 4;
+	Vector<byte> destination(destination_stride * destination_dimensions.y);
+	Vector<byte> intermediate(destination_dimensions.x * destination_dimensions.y);
+
+	const float std_dev = .4f * float(radius);
+	auto Gaussian = [&](int x) { return Math::Exp(-float(x * x) / (2.f * std_dev * std_dev)); };
+
+	ConvolutionFilter blur_x, blur_y, blur_2d, outline;
+	blur_x.Initialise(Vector2i(radius, 0), FilterOperation::Sum);
+	blur_y.Initialise(Vector2i(0, radius), FilterOperation::Sum);
+	blur_2d.Initialise(radius, FilterOperation::Sum);
+	outline.Initialise(radius, FilterOperation::Dilation);
+	for (int y = -radius; y <= radius; y++)
+	{
+		blur_x[0][y + radius] = Gaussian(y) / (2.5f * std_dev);
+		blur_y[y + radius][0] = Gaussian(y) / (2.5f * std_dev);
+		for (int x = -radius; x <= radius; x++)
+		{
+			blur_2d[y + radius][x + radius] = Gaussian(x) * Gaussian(y) / (6.3f * std_dev * std_dev);
+			const float distance = Math::SquareRoot(float(x * x + y * y));
+			outline[y + radius][x + radius] = (distance > radius ? Math::Max((radius + 1) - distance, 0.f) : 1.f);
+		}
+	}
+
+	nanobench::Bench bench;
+	bench.title("Convolution filter");
+	bench.relative(true);
+
+	bench.run("Blur (horizontal + vertical)", [&]() {
+		blur_x.Run(intermediate.data(), destination_dimensions, destination_dimensions.x, ColorFormat::A8, source.data(), dimensions, Vector2i(radius),
+			ColorFormat::A8);
+		blur_y.Run(destination.data(), destination_dimensions, destination_stride, ColorFormat::RGBA8, intermediate.data(), destination_dimensions,
+			Vector2i(0), ColorFormat::A8);
+	});
+
+	bench.run("Blur (two-dimensional kernel)", [&]() {
+		blur_2d.Run(destination.data(), destination_dimensions, destination_stride, ColorFormat::RGBA8, source.data(), dimensions, Vector2i(radius),
+			ColorFormat::A8);
+	});
+
+	bench.run("Outline", [&]() {
+		outline.Run(destination.data(), destination_dimensions, destination_stride, ColorFormat::RGBA8, source.data(), dimensions, Vector2i(radius),
+			ColorFormat::A8);
+	});
+}
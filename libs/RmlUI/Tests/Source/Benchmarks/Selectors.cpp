@@ -293,3 +293,102 @@ TEST_CASE("Selectors")
 		context->Update();
 	}
 }
+
+TEST_CASE("Selectors.parallel")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rows = 1000;
+	const String rml = GenerateRml(num_rows);
+
+	String name;
+	String styles = GenerateRCSS(SelectorFlags(CLASS | PSEUDO_CLASS), String(), name);
+	styles += GenerateRCSS(NO_SELECTOR, ":nth-child(2n+3) div", name);
+	styles += GenerateRCSS(NO_SELECTOR, "[class~=col] div", name);
+	const String compiled_document_rml = Rml::CreateString(document_rml_template, styles.c_str());
+
+	ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	el->SetInnerRML(rml);
+	context->Update();
+	context->Render();
+
+	MESSAGE(Rml::CreateString("\nRestyle of %d descendant elements with style definitions resolved on worker threads.", GetNumDescendentElements(el)));
+
+	nanobench::Bench bench;
+	bench.title("Selectors (parallel)");
+	bench.timeUnit(std::chrono::milliseconds(1), "ms");
+	bench.relative(true);
+	bench.epochs(3);
+	bench.minEpochIterations(4);
+
+	bool hover_active = false;
+
+	for (int num_threads : {0, 1, 3, 7})
+	{
+		context->SetStyleThreadCount(num_threads);
+		bench.run(Rml::CreateString("Worker threads: %d", num_threads), [&] {
+			hover_active = !hover_active;
+			el->SetPseudoClass("hover", hover_active);
+			context->Update();
+		});
+	}
+
+	context->SetStyleThreadCount(0);
+	document->Close();
+	context->Update();
+}
+
+TEST_CASE("Selectors.descendant")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// A deeply nested document with descendant selectors that mostly fail to match. Without any way to rule them out early, each such selector
+	// needs to walk up the entire ancestor chain of every element, in search of an ancestor that does not exist.
+	constexpr int depth = 40;
+	String rml;
+	for (int i = 0; i < depth; i++)
+		rml += Rml::CreateString(R"(<div class="panel level%d" data-level="%d"><span>A</span><span class="row">B</span>)", i, i);
+	for (int i = 0; i < depth; i++)
+		rml += "</div>";
+
+	String styles;
+	for (int i = 0; i < num_rule_iterations * 10; i++)
+	{
+		styles += Rml::CreateString(".panel-%d .row span { color: #0f0; }\n", i);
+		styles += Rml::CreateString("#panel%d div span { color: #00f; }\n", i);
+		styles += Rml::CreateString(".panel .row%d > span { color: #ff0; }\n", i);
+		styles += Rml::CreateString(":custom%d { color: #f0f; }\n", i);
+		styles += Rml::CreateString("[data-custom%d] { color: #0ff; }\n", i);
+	}
+	const String compiled_document_rml = Rml::CreateString(document_rml_template, styles.c_str());
+
+	ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	el->SetInnerRML(rml);
+	context->Update();
+	context->Render();
+
+	MESSAGE(Rml::CreateString("\nRestyle of %d descendant elements, nested %d levels deep.", GetNumDescendentElements(el), depth));
+
+	nanobench::Bench bench;
+	bench.title("Selectors (descendant)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	bool hover_active = false;
+	bench.run("Deeply nested descendant selectors", [&] {
+		hover_active = !hover_active;
+		el->SetPseudoClass("hover", hover_active);
+		context->Update();
+	});
+
+	document->Close();
+	context->Update();
+}
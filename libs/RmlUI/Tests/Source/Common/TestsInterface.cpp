@@ -177,6 +177,12 @@ void TestsRenderInterface::ReleaseTexture(Rml::TextureHandle /*texture_handle*/)
 	counters.release_texture += 1;
 }
 
+Rml::TextureHandle TestsRenderInterface::SaveLayerAsTexture()
+{
+	counters.save_layer_as_texture += 1;
+	return 1;
+}
+
 void TestsRenderInterface::SetTransform(const Rml::Matrix4f* /*transform*/)
 {
 	counters.set_transform += 1;
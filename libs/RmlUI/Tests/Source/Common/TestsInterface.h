@@ -66,6 +66,7 @@ public:
 		size_t load_texture;
 		size_t generate_texture;
 		size_t release_texture;
+		size_t save_layer_as_texture;
 		size_t enable_scissor;
 		size_t set_scissor;
 		size_t enable_clip_mask;
@@ -86,6 +87,8 @@ public:
 	Rml::TextureHandle GenerateTexture(Rml::Span<const Rml::byte> source_data, Rml::Vector2i source_dimensions) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
+	Rml::TextureHandle SaveLayerAsTexture() override;
+
 	void EnableScissorRegion(bool enable) override;
 	void SetScissorRegion(Rml::Rectanglei region) override;
 
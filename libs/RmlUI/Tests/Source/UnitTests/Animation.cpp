@@ -29,6 +29,7 @@
 #include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include "../Common/TypesToString.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
@@ -651,3 +652,102 @@ TEST_CASE("animation.multiple_overlapping")
 	system_interface->SetTime(0.0);
 	TestsShell::ShutdownShell();
 }
+
+static const String document_animation_render_properties_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		@keyframes spin {
+			from { transform: rotate(0deg); }
+			to   { transform: rotate(90deg); }
+		}
+		body {
+			font-family: LatoLatin;
+		}
+		div {
+			width: 64px;
+			height: 64px;
+		}
+		#spin {
+			animation: spin 1s;
+		}
+	</style>
+</head>
+
+<body>
+	<div id="parent">text<div id="child"/><div id="opaque" style="opacity: 1"/></div>
+	<img id="image" src="/assets/high_scores_alien_1.tga"/>
+	<div id="spin"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("animation.render_properties")
+{
+	TestsSystemInterface* system_interface = TestsShell::GetTestsSystemInterface();
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	system_interface->SetTime(0.0);
+	ElementDocument* document = context->LoadDocumentFromMemory(document_animation_render_properties_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* parent = document->GetElementById("parent");
+	Element* child = document->GetElementById("child");
+	Element* opaque = document->GetElementById("opaque");
+	Element* image = document->GetElementById("image");
+	Element* spin = document->GetElementById("spin");
+
+	REQUIRE(parent->Animate("opacity", Property(0.f, Unit::NUMBER), 1.0f));
+	REQUIRE(image->Animate("image-color", Property(Colourb(0, 0, 0), Unit::COLOUR), 1.0f));
+
+	double t = 0.0;
+	auto advance_to = [&](double t_final) {
+		while (t < t_final - 0.01)
+		{
+			t += 0.1;
+			system_interface->SetTime(t);
+			context->Update();
+			context->Render();
+		}
+	};
+
+	// Animated values are applied to the computed values directly, and inherited by descendants without their own value.
+	advance_to(0.5);
+	const float opacity = parent->GetComputedValues().opacity();
+	CHECK(opacity > 0.3f);
+	CHECK(opacity < 0.7f);
+	CHECK(parent->GetProperty<float>("opacity") == opacity);
+	CHECK(parent->GetFirstChild()->GetComputedValues().opacity() == opacity);
+	CHECK(child->GetComputedValues().opacity() == opacity);
+	CHECK(opaque->GetComputedValues().opacity() == 1.f);
+
+	const Colourb image_color = image->GetComputedValues().image_color();
+	CHECK(image_color.red > 0);
+	CHECK(image_color.red < 255);
+	CHECK(image->GetProperty<Colourb>("image-color") == image_color);
+
+	CHECK(spin->GetComputedValues().has_local_transform());
+
+	// Resolving the style again for other reasons must give the same values.
+	parent->SetProperty("height", "65px");
+	context->Update();
+	CHECK(parent->GetComputedValues().opacity() == opacity);
+	CHECK(child->GetComputedValues().opacity() == opacity);
+
+	// Elements can be removed while they are being animated.
+	ElementPtr removed_spin = document->RemoveChild(spin);
+	advance_to(1.2);
+	removed_spin.reset();
+
+	CHECK(parent->GetComputedValues().opacity() == 0.f);
+	CHECK(child->GetComputedValues().opacity() == 0.f);
+	CHECK(image->GetComputedValues().image_color() == Colourb(0, 0, 0));
+
+	document->Close();
+	system_interface->SetTime(0.0);
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,146 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <RmlUi/Core/ConvolutionFilter.h>
+#include <RmlUi/Core/Math.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <random>
+
+using namespace Rml;
+
+namespace {
+struct Kernel {
+	Vector2i radii;
+	FilterOperation operation;
+	Function<float(int x, int y)> weight;
+};
+} // namespace
+
+// Straightforward evaluation of the convolution, used as a reference.
+static void RunReference(const Kernel& kernel, byte* destination, Vector2i destination_dimensions, int destination_stride, int destination_bpp,
+	const byte* source, Vector2i source_dimensions, Vector2i source_offset, int source_bpp)
+{
+	const int destination_alpha_offset = destination_bpp - 1;
+	const int source_alpha_offset = source_bpp - 1;
+
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		for (int x = 0; x < destination_dimensions.x; ++x)
+		{
+			float opacity = 0.f;
+			for (int kernel_y = -kernel.radii.y; kernel_y <= kernel.radii.y; ++kernel_y)
+			{
+				for (int kernel_x = -kernel.radii.x; kernel_x <= kernel.radii.x; ++kernel_x)
+				{
+					const int source_x = x - source_offset.x + kernel_x;
+					const int source_y = y - source_offset.y + kernel_y;
+					if (source_y >= 0 && source_y < source_dimensions.y && source_x >= 0 && source_x < source_dimensions.x)
+					{
+						const float value =
+							float(source[(source_y * source_dimensions.x + source_x) * source_bpp + source_alpha_offset]) * kernel.weight(kernel_x, kernel_y);
+						if (kernel.operation == FilterOperation::Sum)
+							opacity += value;
+						else
+							opacity = Math::Max(opacity, value);
+					}
+				}
+			}
+			destination[y * destination_stride + x * destination_bpp + destination_alpha_offset] = byte(Math::Min(255.f, opacity));
+		}
+	}
+}
+
+TEST_CASE("ConvolutionFilter")
+{
+	auto Gaussian = [](float x, float std_dev) { return Math::Exp(-x * x / (2.f * std_dev * std_dev)) / (Math::SquareRoot(2.f * Math::RMLUI_PI) * std_dev); };
+
+	auto Circle = [](int radius) {
+		return [radius](int x, int y) {
+			const float distance = Math::SquareRoot(float(x * x + y * y));
+			return distance > radius ? Math::Max((radius + 1) - distance, 0.f) : 1.f;
+		};
+	};
+
+	const Kernel kernels[] = {
+		{Vector2i(0), FilterOperation::Sum, [](int, int) { return 1.f; }},
+		{Vector2i(4, 0), FilterOperation::Sum, [&](int x, int) { return Gaussian(float(x), 1.6f); }},
+		{Vector2i(0, 4), FilterOperation::Sum, [&](int, int y) { return Gaussian(float(y), 1.6f); }},
+		{Vector2i(3), FilterOperation::Sum, [&](int x, int y) { return Gaussian(float(x), 1.2f) * Gaussian(float(y), 1.2f); }},
+		{Vector2i(2), FilterOperation::Sum, [](int x, int y) { return (x == y ? 0.2f : 0.01f); }},
+		{Vector2i(1), FilterOperation::Dilation, Circle(1)},
+		{Vector2i(4), FilterOperation::Dilation, Circle(4)},
+		{Vector2i(9), FilterOperation::Dilation, Circle(9)},
+		{Vector2i(3, 1), FilterOperation::Dilation, [](int x, int) { return x == 0 ? 0.5f : 1.f; }},
+	};
+
+	std::mt19937 generator(1);
+	std::uniform_int_distribution<int> distribution(0, 255);
+
+	for (const Kernel& kernel : kernels)
+	{
+		ConvolutionFilter filter;
+		REQUIRE(filter.Initialise(kernel.radii, kernel.operation));
+		for (int y = -kernel.radii.y; y <= kernel.radii.y; ++y)
+			for (int x = -kernel.radii.x; x <= kernel.radii.x; ++x)
+				filter[y + kernel.radii.y][x + kernel.radii.x] = kernel.weight(x, y);
+
+		for (const ColorFormat color_format : {ColorFormat::A8, ColorFormat::RGBA8})
+		{
+			const int bpp = (color_format == ColorFormat::RGBA8 ? 4 : 1);
+			const Vector2i source_dimensions(23, 17);
+			Vector<byte> source(source_dimensions.x * source_dimensions.y * bpp);
+			for (byte& value : source)
+				value = byte(distribution(generator));
+
+			for (const Vector2i source_offset : {kernel.radii, Vector2i(0), Vector2i(-3, 5)})
+			{
+				const Vector2i destination_dimensions = source_dimensions + 2 * kernel.radii;
+				const int destination_stride = destination_dimensions.x * 4 + 8;
+				Vector<byte> result(destination_stride * destination_dimensions.y, 0);
+				Vector<byte> expected = result;
+
+				filter.Run(result.data(), destination_dimensions, destination_stride, ColorFormat::RGBA8, source.data(), source_dimensions,
+					source_offset, color_format);
+				RunReference(kernel, expected.data(), destination_dimensions, destination_stride, 4, source.data(), source_dimensions, source_offset,
+					bpp);
+
+				// Two-dimensional sums may be evaluated in separate passes, allow for rounding differences.
+				const int tolerance = (kernel.operation == FilterOperation::Sum && kernel.radii.x > 0 && kernel.radii.y > 0 ? 1 : 0);
+				int max_difference = 0;
+				for (size_t i = 0; i < result.size(); i++)
+					max_difference = Math::Max(max_difference, Math::Absolute(int(result[i]) - int(expected[i])));
+
+				CAPTURE(kernel.radii);
+				CAPTURE(int(kernel.operation));
+				CAPTURE(source_offset);
+				CHECK(max_difference <= tolerance);
+			}
+		}
+	}
+}
@@ -32,6 +32,7 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/RenderManager.h>
 #include <Shell.h>
 #include <algorithm>
 #include <doctest.h>
@@ -458,3 +459,236 @@ TEST_CASE("core.RemoveContext")
 
 	Shell::Shutdown();
 }
+
+static const String document_retained_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+			font-family: LatoLatin;
+			font-size: 16px;
+		}
+		div {
+			height: 30px;
+			background-color: #336;
+			border: 2px #aaa;
+		}
+		#clip {
+			overflow: hidden;
+			height: 40px;
+		}
+		#transform {
+			transform: rotate(10deg);
+		}
+		#filter {
+			filter: opacity(0.5);
+		}
+	</style>
+</head>
+
+<body>
+	<div id="color">Color</div>
+	<div id="clip"><div>Clipped text</div><div>Clipped text</div></div>
+	<div id="transform">Transform <span>span</span></div>
+	<div id="filter">Filter</div>
+	<div id="last">Last</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.retained_rendering")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	const auto& counters = render_interface->GetCounters();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	const RenderStatistics& statistics = context->GetRenderManager().GetStatistics();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_retained_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	auto RenderFrame = [&]() {
+		const TestsRenderInterface::Counters before = counters;
+		TestsShell::RenderLoop();
+		TestsRenderInterface::Counters result = counters;
+		result.compile_geometry -= before.compile_geometry;
+		result.render_geometry -= before.render_geometry;
+		result.set_transform -= before.set_transform;
+		result.render_to_clip_mask -= before.render_to_clip_mask;
+		return result;
+	};
+
+	const TestsRenderInterface::Counters immediate = RenderFrame();
+	REQUIRE(immediate.render_geometry > 0);
+	REQUIRE(statistics.commands_replayed == 0);
+
+	context->EnableRetainedRendering(true);
+
+	// The first frame records the commands, while the following frames replay them.
+	for (int i = 0; i < 3; i++)
+	{
+		CAPTURE(i);
+		const TestsRenderInterface::Counters retained = RenderFrame();
+		CHECK(retained.render_geometry == immediate.render_geometry);
+		CHECK(retained.set_transform == immediate.set_transform);
+		CHECK(retained.render_to_clip_mask == immediate.render_to_clip_mask);
+		CHECK(retained.compile_geometry == 0);
+		CHECK(statistics.elements_drawn > 0);
+		if (i == 0)
+			CHECK(statistics.commands_replayed == 0);
+		else
+			CHECK(statistics.commands_replayed > 0);
+	}
+
+	SUBCASE("Color")
+	{
+		// Changing only the colors renders the affected elements again, and replays the commands of all other elements.
+		for (const char* id : {"color", "clip", "last"})
+		{
+			CAPTURE(id);
+			document->GetElementById(id)->SetProperty("background-color", "#a00");
+			const TestsRenderInterface::Counters retained = RenderFrame();
+			CHECK(retained.render_geometry == immediate.render_geometry);
+			CHECK(retained.render_to_clip_mask == immediate.render_to_clip_mask);
+			CHECK(retained.compile_geometry > 0);
+			CHECK(statistics.commands_replayed > 0);
+
+			const TestsRenderInterface::Counters next = RenderFrame();
+			CHECK(next.render_geometry == immediate.render_geometry);
+			CHECK(next.compile_geometry == 0);
+			CHECK(statistics.commands_replayed > 0);
+		}
+	}
+
+	SUBCASE("Layout")
+	{
+		// Any change to the layout records all the commands again.
+		document->GetElementById("color")->SetProperty("width", "200px");
+		RenderFrame();
+		CHECK(statistics.commands_replayed == 0);
+
+		const TestsRenderInterface::Counters retained = RenderFrame();
+		CHECK(retained.render_geometry == immediate.render_geometry);
+		CHECK(statistics.commands_replayed > 0);
+	}
+
+	SUBCASE("Disable")
+	{
+		context->EnableRetainedRendering(false);
+		const TestsRenderInterface::Counters result = RenderFrame();
+		CHECK(result.render_geometry == immediate.render_geometry);
+		CHECK(statistics.commands_replayed == 0);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_distance_field_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+			font-family: LatoLatin;
+		}
+		div {
+			display: inline-block;
+		}
+		#outline {
+			font-effect: outline(2px #a00);
+		}
+	</style>
+</head>
+
+<body>
+	<div style="font-size: 11px">Eleven pixels</div>
+	<div style="font-size: 16px">Sixteen pixels</div>
+	<div style="font-size: 27px">Twenty-seven pixels</div>
+	<div style="font-size: 40px">Forty pixels</div>
+	<div style="font-size: 72px">Seventy-two pixels</div>
+	<div id="outline" style="font-size: 20px">Outline effect</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.distance_field_glyphs")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	const auto& counters = render_interface->GetCounters();
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_distance_field_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto RenderFrame = [&]() {
+		const TestsRenderInterface::Counters before = counters;
+		TestsShell::RenderLoop();
+		TestsRenderInterface::Counters result = counters;
+		result.generate_texture -= before.generate_texture;
+		result.compile_shader -= before.compile_shader;
+		result.render_shader -= before.render_shader;
+		return result;
+	};
+
+	auto GetWidths = [&]() {
+		Vector<float> widths;
+		for (int i = 0; i < document->GetNumChildren(); i++)
+			widths.push_back(document->GetChild(i)->GetBox().GetSize().x);
+		return widths;
+	};
+
+	// Every font size and effect rasterizes its own glyphs.
+	const TestsRenderInterface::Counters bitmap = RenderFrame();
+	const Vector<float> bitmap_widths = GetWidths();
+	CHECK(bitmap.generate_texture >= 7);
+	CHECK(bitmap.render_shader == 0);
+
+	// With distance fields, all sizes and effects share the glyphs rendered once, while the layout stays the same.
+	Rml::SetFontDistanceFieldGlyphs(true);
+	const TestsRenderInterface::Counters distance_field = RenderFrame();
+	CHECK(distance_field.generate_texture >= 1);
+	CHECK(distance_field.generate_texture < bitmap.generate_texture);
+	CHECK(distance_field.compile_shader == 7);
+	CHECK(distance_field.render_shader >= 7);
+	CHECK(GetWidths() == bitmap_widths);
+
+	// New font sizes and characters reuse the same shared glyphs.
+	document->GetChild(0)->SetProperty("font-size", "13px");
+	const TestsRenderInterface::Counters resized = RenderFrame();
+	CHECK(resized.generate_texture == 0);
+	CHECK(resized.compile_shader == 1);
+
+	Rml::SetFontDistanceFieldGlyphs(false);
+	const TestsRenderInterface::Counters disabled = RenderFrame();
+	CHECK(disabled.render_shader == 0);
+	CHECK(disabled.generate_texture >= 7);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
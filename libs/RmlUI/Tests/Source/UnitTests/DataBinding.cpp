@@ -31,6 +31,7 @@
 #include <RmlUi/Core/DataModelHandle.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Elements/ElementFormControlSelect.h>
 #include <cmath>
 #include <doctest.h>
 
@@ -663,6 +664,202 @@ TEST_CASE("data_binding.dynamic_variables")
 	TestsShell::ShutdownShell();
 }
 
+static const String for_rows_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/template" href="/assets/window.rml"/>
+	<style>
+		body.window {
+			width: 500px;
+			height: 400px;
+		}
+	</style>
+</head>
+<body template="window">
+<div data-model="basics">
+<div id="rows">
+	<div class="row" data-for="value, i : arrays.a">
+		<span class="index">{{ i }}</span>
+		<span class="value" data-class-large="value > 10">{{ value }} &amp; more</span>
+		<p data-for="c : arrays.c">{{ c.val }}</p>
+	</div>
+</div>
+<div id="selects">
+	<div data-for="arrays.a"><select><option value="a">A</option><option value="b">B</option></select></div>
+</div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("data_binding.for_rows")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	REQUIRE(InitializeDataBindings(context));
+
+	ElementDocument* document = context->LoadDocumentFromMemory(for_rows_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	const Vector<int> array = Arrays{}.a;
+
+	ElementList rows;
+	document->QuerySelectorAll(rows, "#rows .row:not([data-for])");
+	REQUIRE(rows.size() == array.size());
+
+	for (size_t i = 0; i < rows.size(); i++)
+	{
+		Element* row = rows[i];
+		CHECK(row->QuerySelector(".index")->GetInnerRML() == Rml::ToString(i));
+		CHECK(row->QuerySelector(".value")->GetInnerRML() == Rml::ToString(array[i]) + " &amp; more");
+		CHECK(row->QuerySelector(".value")->IsClassSet("large") == (array[i] > 10));
+
+		// Generated rows are placed before the hidden data-for element itself.
+		ElementList nested;
+		row->QuerySelectorAll(nested, "p");
+		REQUIRE(nested.size() == 4);
+		CHECK(nested[2]->GetInnerRML() == "c3");
+	}
+
+	// Contents with custom node handlers are still constructed by the XML parser.
+	ElementList selects;
+	document->QuerySelectorAll(selects, "#selects select");
+	REQUIRE(selects.size() == array.size());
+	for (Element* select : selects)
+		CHECK(rmlui_static_cast<ElementFormControlSelect*>(select)->GetNumOptions() == 2);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String for_virtual_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/template" href="/assets/window.rml"/>
+	<style>
+		body.window {
+			width: 500px;
+			height: 400px;
+		}
+		#list {
+			height: 200px;
+			overflow-y: auto;
+		}
+		.row {
+			height: 20px;
+		}
+	</style>
+</head>
+<body template="window">
+<div data-model="virtual">
+<div id="list">
+	<div class="row" data-for-virtual="value, i : values"><span>{{ i }}</span>: {{ value }}</div>
+</div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("data_binding.for_virtual")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<int> values(10000);
+	for (int i = 0; i < (int)values.size(); i++)
+		values[i] = 2 * i;
+
+	DataModelConstructor constructor = context->CreateDataModel("virtual");
+	constructor.RegisterArray<Vector<int>>();
+	constructor.Bind("values", &values);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(for_virtual_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// The rows are measured after layout, allow for a few updates to settle.
+	auto UpdateAndGetRows = [&]() {
+		for (int i = 0; i < 4; i++)
+			context->Update();
+		ElementList rows;
+		document->QuerySelectorAll(rows, "#list .row:not([data-for-virtual])");
+		return rows;
+	};
+
+	Element* list = document->GetElementById("list");
+
+	ElementList rows = UpdateAndGetRows();
+	REQUIRE(!rows.empty());
+	CHECK(rows.size() < 20);
+	CHECK(rows.front()->GetInnerRML() == "<span>0</span>: 0");
+	CHECK(list->GetScrollHeight() == doctest::Approx(20.f * values.size()));
+
+	list->SetScrollTop(20.f * 5000);
+	rows = UpdateAndGetRows();
+	REQUIRE(!rows.empty());
+	CHECK(rows.size() < 20);
+	CHECK(list->GetScrollHeight() == doctest::Approx(20.f * values.size()));
+
+	// The row at the top of the viewport shows the entry scrolled to.
+	const Vector2f list_top = list->GetAbsoluteOffset(BoxArea::Padding);
+	Element* top_row = nullptr;
+	for (Element* row : rows)
+	{
+		if (row->GetAbsoluteOffset(BoxArea::Border).y == doctest::Approx(list_top.y))
+			top_row = row;
+	}
+	REQUIRE(top_row);
+	CHECK(top_row->GetInnerRML() == "<span>5000</span>: 10000");
+
+	// Scrolling by a single row only moves the row that left the window, the other rows keep their elements and contents.
+	ElementList row_contents;
+	for (Element* row : rows)
+		row_contents.push_back(row->GetFirstChild());
+
+	list->SetScrollTop(list->GetScrollTop() + 20.f);
+	ElementList scrolled_rows = UpdateAndGetRows();
+	REQUIRE(scrolled_rows.size() == rows.size());
+	for (size_t i = 0; i + 1 < rows.size(); i++)
+	{
+		CHECK(scrolled_rows[i] == rows[i + 1]);
+		CHECK(scrolled_rows[i]->GetFirstChild() == row_contents[i + 1]);
+	}
+	CHECK(scrolled_rows.back() == rows.front());
+	CHECK(scrolled_rows.back()->GetInnerRML() == CreateString("<span>%d</span>: %d", 5000 + (int)rows.size() - 2, 2 * (5000 + (int)rows.size() - 2)));
+	rows = scrolled_rows;
+
+	values.resize(10);
+	context->GetDataModel("virtual").GetModelHandle().DirtyVariable("values");
+	list->SetScrollTop(0.f);
+	rows = UpdateAndGetRows();
+	CHECK(rows.size() == 10);
+	CHECK(rows.back()->GetInnerRML() == "<span>9</span>: 18");
+
+	// The spacers are removed together with the data view.
+	auto NumSpacers = [&]() {
+		int num_spacers = 0;
+		for (int i = 0; i < list->GetNumChildren(); i++)
+			num_spacers += (list->GetChild(i)->GetTagName() == "#spacer");
+		return num_spacers;
+	};
+	CHECK(NumSpacers() == 2);
+	list->RemoveChild(list->QuerySelector("[data-for-virtual]"));
+	UpdateAndGetRows();
+	CHECK(NumSpacers() == 0);
+
+	document->Close();
+	context->RemoveDataModel("virtual");
+
+	TestsShell::ShutdownShell();
+}
+
 static const String set_enum_rml = R"(
 <rml>
 <head>
@@ -54,6 +54,17 @@ static String TestExpression(const String& expression)
 			result = interpreter.Result().Get<String>();
 		else
 			FAIL_CHECK("Could not execute expression: " << expression << "\n\n  Parsed program: \n" << DumpProgram(program));
+
+		// The compiled program must give the same result as the parsed program.
+		DataCompiler compiler(program, addresses, interface);
+		compiler.Compile();
+		VariableList variables = compiler.ReleaseVariables();
+		DataInterpreter compiled_interpreter(program, addresses, interface, &variables);
+
+		if (compiled_interpreter.Run())
+			CHECK_MESSAGE(compiled_interpreter.Result().Get<String>() == result, "Compiled program: \n" << DumpProgram(program));
+		else
+			FAIL_CHECK("Could not execute compiled expression: " << expression << "\n\n  Compiled program: \n" << DumpProgram(program));
 	}
 	else
 	{
@@ -73,11 +84,15 @@ static bool TestAssignment(const String& expression)
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
 
-		DataInterpreter interpreter(program, addresses, interface);
+		DataCompiler compiler(program, addresses, interface);
+		compiler.Compile();
+		VariableList variables = compiler.ReleaseVariables();
+
+		DataInterpreter interpreter(program, addresses, interface, &variables);
 		if (interpreter.Run())
 			result = true;
 		else
-			FAIL_CHECK("Could not execute assignment expression: " << expression << "\n\n  Parsed program: \n" << DumpProgram(program));
+			FAIL_CHECK("Could not execute assignment expression: " << expression << "\n\n  Compiled program: \n" << DumpProgram(program));
 	}
 	else
 	{
@@ -201,3 +216,53 @@ TEST_CASE("Data expressions")
 	CHECK(TestExpression("true ? num_multi[0] : num_multi[999]") == "left");
 	CHECK(TestExpression("false ? num_multi[999] : num_multi[1]") == "right");
 }
+
+static String CompileExpression(const String& expression)
+{
+	DataParser parser(expression, interface);
+	if (!parser.Parse(false))
+	{
+		FAIL_CHECK("Could not parse expression: " << expression);
+		return String();
+	}
+
+	Program program = parser.ReleaseProgram();
+	AddressList addresses = parser.ReleaseAddresses();
+	DataCompiler compiler(program, addresses, interface);
+	compiler.Compile();
+
+	String instructions;
+	for (const InstructionData& data : program)
+		instructions += char(data.instruction);
+	return instructions;
+}
+
+TEST_CASE("Data expressions compiler")
+{
+	float radius = 8.7f;
+	String color_name = "color";
+
+	DataModelConstructor constructor(&model);
+	constructor.Bind("compiler_radius", &radius);
+	constructor.Bind("compiler_color_name", &color_name);
+
+	// Constant expressions fold into a single literal.
+	CHECK(CompileExpression("2 * 2") == "D");
+	CHECK(CompileExpression("5.2 + 19 + 'px'") == "D");
+	CHECK(CompileExpression("!!10 - 1 ? 'hello' : 'world'") == "JDJD");
+	CHECK(CompileExpression("true || false ? 'yes' : 'no'") == "DDJD");
+
+	// Stack round-trips around single loads become register moves.
+	CHECK(CompileExpression("compiler_radius * 2") == "VMD*");
+	CHECK(CompileExpression("compiler_radius * (1 + 2)") == "VMD*");
+
+	// Typed instructions are selected when operand types are known.
+	CHECK(CompileExpression("compiler_radius * 2 + 1") == "VMD*MDa");
+	CHECK(CompileExpression("compiler_radius + 1") == "VMD+");
+	CHECK(CompileExpression("compiler_color_name + 'px'") == "VMDs");
+	CHECK(CompileExpression("compiler_color_name == 'color'") == "VMDq");
+	CHECK(CompileExpression("compiler_radius * 2 != 3") == "VMD*MDn");
+
+	// Branches may produce different types, so their results are not typed.
+	CHECK(CompileExpression("(compiler_radius > 1 ? 'a' : 2) + 1") == "VMD>ZDJDMD+");
+}
@@ -30,10 +30,14 @@
 #include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include "../Common/TypesToString.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementInstancer.h>
 #include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/RenderManager.h>
+#include <RmlUi/Core/StringUtilities.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -466,3 +470,324 @@ TEST_CASE("Element.ScrollIntoView")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+static const String document_hit_test_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 800px;
+			height: 600px;
+		}
+		.cell {
+			float: left;
+			width: 50px;
+			height: 30px;
+		}
+		#moved, #transformed, #scroll, #stack, #overflow {
+			position: absolute;
+			width: 50px;
+			height: 50px;
+		}
+		#moved { left: 0; top: 200px; }
+		#transformed { left: 300px; top: 400px; width: 100px; height: 20px; transform: rotate(90deg); }
+		#scroll { left: 600px; top: 300px; width: 100px; height: 100px; overflow: hidden; }
+		#scroll div { height: 100px; }
+		#stack { left: 100px; top: 500px; z-index: 1; }
+		#overflow { left: 100px; top: 0; }
+	</style>
+</head>
+
+<body>
+CELLS
+<div id="moved"/>
+<div id="transformed"/>
+<div id="scroll"><div id="first"/><div id="second"/></div>
+<div id="stack"><div id="overflow"/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.GetElementAtPoint")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_cells = 64;
+	constexpr int num_columns = 16;
+	String cells_rml;
+	for (int i = 0; i < num_cells; i++)
+		cells_rml += CreateString("<div class=\"cell\" id=\"cell%d\"/>\n", i);
+
+	const String document_rml = StringUtilities::Replace(document_hit_test_rml, "CELLS", cells_rml);
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	for (int i = 0; i < num_cells; i++)
+	{
+		const Vector2f point = {float(i % num_columns) * 50.f + 25.f, float(i / num_columns) * 30.f + 15.f};
+		CHECK(context->GetElementAtPoint(point) == document->GetElementById(CreateString("cell%d", i)));
+	}
+	CHECK(context->GetElementAtPoint({780, 580}) == document);
+
+	Element* moved = document->GetElementById("moved");
+	CHECK(context->GetElementAtPoint({25, 225}) == moved);
+	moved->SetProperty("left", "500px");
+	context->Update();
+	CHECK(context->GetElementAtPoint({25, 225}) == document);
+	CHECK(context->GetElementAtPoint({525, 225}) == moved);
+
+	Element* scroll = document->GetElementById("scroll");
+	CHECK(context->GetElementAtPoint({650, 310}) == document->GetElementById("first"));
+	scroll->SetScrollTop(100.f);
+	context->Update();
+	CHECK(context->GetElementAtPoint({650, 310}) == document->GetElementById("second"));
+
+	// The rotated element covers the area above and below its untransformed box. Transforms are resolved during rendering.
+	TestsShell::RenderLoop();
+	Element* transformed = document->GetElementById("transformed");
+	CHECK(context->GetElementAtPoint({350, 370}) == transformed);
+	CHECK(context->GetElementAtPoint({310, 410}) == document);
+
+	// Descendants of nested stacking contexts may be located outside their stacking context root.
+	CHECK(context->GetElementAtPoint({125, 525}) == document->GetElementById("stack"));
+	CHECK(context->GetElementAtPoint({225, 525}) == document->GetElementById("overflow"));
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_culling_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 400px;
+			height: 300px;
+		}
+		#scroll {
+			width: 200px;
+			height: 100px;
+			overflow: hidden;
+		}
+		#scroll div {
+			height: 50px;
+			background-color: #f00;
+		}
+	</style>
+</head>
+
+<body>
+<div id="scroll">ITEMS</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.RenderCulling")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_items = 20;
+	String items_rml;
+	for (int i = 0; i < num_items; i++)
+		items_rml += CreateString("<div id=\"item%d\"/>", i);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(StringUtilities::Replace(document_culling_rml, "ITEMS", items_rml));
+	REQUIRE(document);
+	document->Show();
+
+	const RenderStatistics& statistics = context->GetRenderManager().GetStatistics();
+	auto render = [&] {
+		context->Update();
+		context->Render();
+	};
+
+	// Only the first two items are located inside the scroll container, the remaining ones are clipped away.
+	render();
+	CHECK(statistics.elements_culled == num_items - 2);
+	const int num_drawn = statistics.elements_drawn;
+	CHECK(num_drawn >= 4);
+
+	document->GetElementById("scroll")->SetScrollTop(500.f);
+	render();
+	CHECK(statistics.elements_culled == num_items - 2);
+	CHECK(statistics.elements_drawn == num_drawn);
+
+	// Culled elements must not submit any geometry, while the visible ones are still rendered.
+	if (TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface())
+	{
+		render_interface->ResetCounters();
+		render();
+		const size_t num_render_calls = render_interface->GetCounters().render_geometry;
+		CHECK(num_render_calls >= 2);
+
+		document->GetElementById("item10")->SetProperty("background-color", "transparent");
+		document->GetElementById("item11")->SetProperty("background-color", "transparent");
+		render_interface->ResetCounters();
+		render();
+		CHECK(render_interface->GetCounters().render_geometry == num_render_calls - 2);
+	}
+
+	// Documents moved outside the window are culled entirely.
+	document->SetProperty("left", "-1000px");
+	render();
+	CHECK(statistics.elements_drawn == 0);
+	CHECK(statistics.elements_culled > num_items);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_update_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: 400px;
+			height: 300px;
+		}
+		.red counter {
+			width: 20px;
+		}
+	</style>
+</head>
+
+<body>
+	<div id="first"><counter id="a"/></div>
+	<div id="second" style="color: #f00"><counter id="b"/></div>
+</body>
+</rml>
+)";
+
+class ElementUpdateCounter : public Element {
+public:
+	ElementUpdateCounter(const String& tag) : Element(tag) {}
+	int num_updates = 0;
+
+protected:
+	void OnUpdate() override { num_updates += 1; }
+};
+
+TEST_CASE("Element.UpdateSkipping")
+{
+	ElementInstancerGeneric<ElementUpdateCounter> instancer;
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	Factory::RegisterElementInstancer("counter", &instancer);
+
+	// The skipping must also hold when definitions are resolved ahead of the update on the style threads.
+	int num_style_threads = 0;
+	SUBCASE("Serial") {}
+	SUBCASE("StyleThreads")
+	{
+		num_style_threads = 2;
+	}
+	context->SetStyleThreadCount(num_style_threads);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_update_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Update();
+
+	auto a = static_cast<ElementUpdateCounter*>(document->GetElementById("a"));
+	auto b = static_cast<ElementUpdateCounter*>(document->GetElementById("b"));
+	REQUIRE(a);
+	REQUIRE(b);
+
+	int a_updates = a->num_updates;
+	int b_updates = b->num_updates;
+	CHECK(a_updates > 0);
+	CHECK(b_updates > 0);
+
+	// Elements without any pending work are skipped.
+	context->Update();
+	CHECK(a->num_updates == a_updates);
+	CHECK(b->num_updates == b_updates);
+
+	SUBCASE("Properties")
+	{
+		a->SetProperty("height", "10px");
+		context->Update();
+		CHECK(a->num_updates == a_updates + 1);
+		CHECK(b->num_updates == b_updates);
+		CHECK(a->GetComputedValues().height().value == 10.f);
+	}
+
+	SUBCASE("InheritedProperties")
+	{
+		document->GetElementById("first")->SetProperty("color", "#0f0");
+		context->Update();
+		CHECK(a->num_updates == a_updates + 1);
+		CHECK(b->num_updates == b_updates);
+		CHECK(a->GetComputedValues().color() == Colourb(0, 255, 0));
+	}
+
+	SUBCASE("Definition")
+	{
+		document->GetElementById("first")->SetClass("red", true);
+		context->Update();
+		CHECK(a->num_updates == a_updates + 1);
+		CHECK(a->GetComputedValues().width().value == 20.f);
+	}
+
+	SUBCASE("RequestUpdate")
+	{
+		b->RequestUpdate();
+		context->Update();
+		CHECK(a->num_updates == a_updates);
+		CHECK(b->num_updates == b_updates + 1);
+		context->Update();
+		CHECK(b->num_updates == b_updates + 1);
+	}
+
+	SUBCASE("Reparent")
+	{
+		ElementPtr element = a->GetParentNode()->RemoveChild(a);
+		document->GetElementById("second")->AppendChild(std::move(element));
+		context->Update();
+		CHECK(a->num_updates == a_updates + 1);
+		CHECK(a->GetComputedValues().color() == Colourb(255, 0, 0));
+	}
+
+	SUBCASE("Animation")
+	{
+		TestsSystemInterface* system_interface = TestsShell::GetTestsSystemInterface();
+		system_interface->SetTime(0.0);
+		context->Update();
+		REQUIRE(a->Animate("height", Property(50.f, Unit::PX), 1.0f));
+
+		// Running animations keep the element updating until they are complete.
+		for (int i = 1; i <= 12; i++)
+		{
+			system_interface->SetTime(0.1 * i);
+			context->Update();
+		}
+		CHECK(a->GetComputedValues().height().value == 50.f);
+		CHECK(b->num_updates == b_updates);
+
+		a_updates = a->num_updates;
+		CHECK(a_updates >= 10);
+		context->Update();
+		CHECK(a->num_updates == a_updates);
+
+		system_interface->SetTime(0.0);
+	}
+
+	context->SetStyleThreadCount(0);
+	document->Close();
+	TestsShell::ShutdownShell();
+}
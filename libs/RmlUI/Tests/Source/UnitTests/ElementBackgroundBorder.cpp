@@ -102,6 +102,17 @@ TEST_CASE("ElementBackgroundBorder.render_stats")
 	if (!render_interface)
 		return;
 
+	// Rows outside the scroll region are culled, so scroll through all of them once to have their geometry generated.
+	for (int i = 0; i < num_rows; i++)
+	{
+		wrapper->SetScrollTop(110.f * float(i));
+		context->Update();
+		context->Render();
+	}
+	wrapper->SetScrollTop(0.f);
+	context->Update();
+	context->Render();
+
 	MESSAGE(TestsShell::GetRenderStats());
 	render_interface->Reset();
 
@@ -212,3 +223,79 @@ TEST_CASE("ElementBackgroundBorder.background_edges_line_up_with_relative_offset
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+static const String document_box_shadow_rml = R"(
+<rml>
+<head>
+<title>Demo</title>
+<link type="text/rcss" href="/assets/rml.rcss" />
+<link type="text/rcss" href="/../Tests/Data/style.rcss" />
+<style>
+	body {
+		width: 800px;
+		height: 800px;
+	}
+	div {
+		display: inline-block;
+		width: 200px;
+		height: 100px;
+		margin: 5px;
+		background-color: #fff;
+		border: 2px #ccc;
+		border-radius: 8px;
+		box-shadow: #000a 0 4px 12px, #0005 0 1px 3px 2px inset;
+	}
+	div.wide { width: 350px; }
+	div.small { width: 40px; height: 40px; }
+	div.blue { background-color: #00f; }
+</style>
+</head>
+<body>
+</body>
+</rml>
+)";
+
+TEST_CASE("ElementBackgroundBorder.box_shadow_shared_texture")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	struct TestCase {
+		String row_rml;
+		size_t expected_textures;
+	};
+	const TestCase test_cases[] = {
+		// Identical box-shadows should share a single texture.
+		{"<div/>", 1},
+		// Large boxes are nine-sliced, thus differently sized boxes can share the same texture.
+		{"<div/><div class='wide'/>", 1},
+		// Small boxes are rendered in full.
+		{"<div/><div class='small'/>", 2},
+		// The background is part of the texture.
+		{"<div/><div class='blue'/>", 2},
+	};
+
+	for (const TestCase& test_case : test_cases)
+	{
+		CAPTURE(test_case.row_rml);
+		ElementDocument* document = context->LoadDocumentFromMemory(document_box_shadow_rml);
+		REQUIRE(document);
+		document->SetInnerRML(GenerateRowsRml(8, test_case.row_rml));
+		document->Show();
+
+		render_interface->Reset();
+		context->Update();
+		context->Render();
+		CHECK(render_interface->GetCounters().save_layer_as_texture == test_case.expected_textures);
+
+		document->Close();
+		context->Update();
+		CHECK(render_interface->GetCounters().release_texture == test_case.expected_textures);
+	}
+
+	TestsShell::ShutdownShell();
+}
@@ -27,6 +27,7 @@
  */
 
 #include "../Common/TestsShell.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
@@ -84,3 +85,164 @@ TEST_CASE("elementstyle.inline_decorator_images")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_parallel_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		p { display: block; height: 1px; }
+		#list.on p { width: 10px; }
+		#list.on p:nth-child(3n) { width: 20px; }
+		#list.on p + p.odd { height: 2px; }
+		#list:not(.on) p.odd { width: 30px; }
+	</style>
+</head>
+
+<body>
+<div id="list"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.parallel_definitions")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_parallel_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* list = document->GetElementById("list");
+	String rml;
+	for (int i = 0; i < 1000; i++)
+		rml += (i % 2 ? "<p class='odd'/>" : "<p/>");
+	list->SetInnerRML(rml);
+	context->Update();
+
+	auto GetSizes = [&]() {
+		Vector<Vector2f> sizes;
+		for (int i = 0; i < list->GetNumChildren(); i++)
+		{
+			const Style::ComputedValues& values = list->GetChild(i)->GetComputedValues();
+			sizes.push_back(Vector2f(values.width().value, values.height().value));
+		}
+		return sizes;
+	};
+
+	list->SetClass("on", true);
+	context->Update();
+	const Vector<Vector2f> sizes_on = GetSizes();
+	list->SetClass("on", false);
+	context->Update();
+	const Vector<Vector2f> sizes_off = GetSizes();
+
+	CHECK(sizes_on[2] == Vector2f(20.f, 1.f));
+	CHECK(sizes_on[3] == Vector2f(10.f, 2.f));
+	CHECK(sizes_off[3] == Vector2f(30.f, 1.f));
+
+	context->SetStyleThreadCount(3);
+	CHECK(context->GetStyleThreadCount() == 3);
+
+	for (int i = 0; i < 3; i++)
+	{
+		list->SetClass("on", true);
+		context->Update();
+		CHECK(GetSizes() == sizes_on);
+
+		list->SetClass("on", false);
+		context->Update();
+		CHECK(GetSizes() == sizes_off);
+	}
+
+	context->SetStyleThreadCount(0);
+	CHECK(context->GetStyleThreadCount() == 0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_sharing_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 500px;
+			height: 500px;
+			font-family: LatoLatin;
+			font-size: 16px;
+		}
+		li { display: block; height: 1em; color: #0f0; }
+		li:hover { color: #f00; }
+		ul.large li { font-size: 2em; }
+	</style>
+</head>
+
+<body>
+<ul id="first"><li/><li/><li/></ul>
+<ul id="second"><li/><li/><li/></ul>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.style_sharing")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_sharing_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* first = document->GetElementById("first");
+	Element* second = document->GetElementById("second");
+	auto Shared = [](Element* a, Element* b) {
+		return a->GetComputedValues().GetSharedValues() == b->GetComputedValues().GetSharedValues();
+	};
+
+	// Siblings and cousins with identical styles share their values.
+	CHECK(Shared(first, second));
+	CHECK(Shared(first->GetChild(0), first->GetChild(1)));
+	CHECK(Shared(first->GetChild(0), second->GetChild(2)));
+	CHECK(!Shared(first, first->GetChild(0)));
+
+	// Elements with a different definition get their own values.
+	Element* hovered = first->GetChild(1);
+	hovered->SetPseudoClass("hover", true);
+	context->Update();
+	CHECK(!Shared(hovered, first->GetChild(0)));
+	CHECK(hovered->GetComputedValues().color() == Colourb(255, 0, 0));
+	CHECK(first->GetChild(0)->GetComputedValues().color() == Colourb(0, 255, 0));
+
+	hovered->SetPseudoClass("hover", false);
+	context->Update();
+	CHECK(Shared(hovered, first->GetChild(0)));
+
+	// Inline properties make the element's values diverge, without affecting the values it used to share.
+	Element* inline_style = second->GetChild(0);
+	inline_style->SetProperty("color", "#00f");
+	context->Update();
+	CHECK(!Shared(inline_style, second->GetChild(1)));
+	CHECK(inline_style->GetComputedValues().color() == Colourb(0, 0, 255));
+	CHECK(second->GetChild(1)->GetComputedValues().color() == Colourb(0, 255, 0));
+
+	// Changes to inherited values are resolved relative to the new parent values.
+	first->SetClass("large", true);
+	context->Update();
+	CHECK(!Shared(first->GetChild(0), second->GetChild(1)));
+	CHECK(Shared(first->GetChild(0), first->GetChild(2)));
+	CHECK(first->GetChild(0)->GetComputedValues().font_size() == 32.f);
+	CHECK(first->GetChild(0)->GetBox().GetSize().y == 32.f);
+	CHECK(second->GetChild(1)->GetComputedValues().font_size() == 16.f);
+	CHECK(second->GetChild(1)->GetBox().GetSize().y == 16.f);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -29,6 +29,7 @@
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Event.h>
 #include <RmlUi/Core/EventListener.h>
 #include <RmlUi/Core/EventListenerInstancer.h>
 #include <RmlUi/Core/Factory.h>
@@ -161,3 +162,160 @@ TEST_CASE("event_listener.replace_current_element")
 	Rml::Factory::RegisterEventListenerInstancer(nullptr);
 	TestsShell::ShutdownShell();
 }
+
+class CallbackEventListener : public Rml::EventListener {
+public:
+	CallbackEventListener(Function<void(Event&)> callback) : callback(std::move(callback)) {}
+	void ProcessEvent(Rml::Event& event) override { callback(event); }
+
+private:
+	Function<void(Event&)> callback;
+};
+
+TEST_CASE("event_listener.typed_parameters")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_decorator_rml, "assets/");
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* button = document->GetElementById("exit");
+	REQUIRE(button);
+
+	// Built-in events are dispatched with typed parameters, they should be available both through the typed accessors
+	// and through the parameter dictionary.
+	Dictionary parameters;
+	Vector2f mouse_position;
+	int mouse_button = 0;
+	Input::KeyIdentifier key_identifier = Input::KI_UNKNOWN;
+	int key_modifier_state = 0;
+	CallbackEventListener listener([&](Event& event) {
+		parameters = event.GetParameters();
+		mouse_position = event.GetMousePosition();
+		mouse_button = event.GetMouseButton();
+		key_identifier = event.GetKeyIdentifier();
+		key_modifier_state = event.GetKeyModifierState();
+	});
+
+	SUBCASE("mousemove")
+	{
+		document->AddEventListener(EventId::Mousemove, &listener);
+		context->ProcessMouseMove(10, 20, Input::KM_SHIFT);
+
+		CHECK(mouse_position == Vector2f(10, 20));
+		CHECK(mouse_button == -1);
+		CHECK(key_modifier_state == Input::KM_SHIFT);
+		CHECK(parameters.size() == 9);
+		CHECK(Get(parameters, "mouse_x", 0) == 10);
+		CHECK(Get(parameters, "mouse_y", 0) == 20);
+		CHECK(Get(parameters, "shift_key", 0) == 1);
+		CHECK(Get(parameters, "ctrl_key", -1) == 0);
+		CHECK(GetIf(parameters, "button") == nullptr);
+		document->RemoveEventListener(EventId::Mousemove, &listener);
+	}
+
+	SUBCASE("mousedown")
+	{
+		document->AddEventListener(EventId::Mousedown, &listener);
+		context->ProcessMouseMove(10, 20, 0);
+		context->ProcessMouseButtonDown(1, Input::KM_CTRL);
+
+		CHECK(mouse_position == Vector2f(10, 20));
+		CHECK(mouse_button == 1);
+		CHECK(key_modifier_state == Input::KM_CTRL);
+		CHECK(Get(parameters, "button", -1) == 1);
+		CHECK(Get(parameters, "ctrl_key", 0) == 1);
+		document->RemoveEventListener(EventId::Mousedown, &listener);
+		context->ProcessMouseButtonUp(1, 0);
+	}
+
+	SUBCASE("keydown")
+	{
+		document->AddEventListener(EventId::Keydown, &listener);
+		button->Focus();
+		context->ProcessKeyDown(Input::KI_A, Input::KM_ALT | Input::KM_CAPSLOCK);
+
+		CHECK(key_identifier == Input::KI_A);
+		CHECK(key_modifier_state == (Input::KM_ALT | Input::KM_CAPSLOCK));
+		CHECK(Get(parameters, "key_identifier", 0) == (int)Input::KI_A);
+		CHECK(Get(parameters, "alt_key", 0) == 1);
+		CHECK(Get(parameters, "caps_lock_key", 0) == 1);
+		CHECK(GetIf(parameters, "mouse_x") == nullptr);
+		document->RemoveEventListener(EventId::Keydown, &listener);
+	}
+
+	SUBCASE("mousescroll")
+	{
+		document->AddEventListener(EventId::Mousescroll, &listener);
+		context->ProcessMouseMove(10, 20, 0);
+		context->ProcessMouseWheel(Vector2f(0.f, 2.f), 0);
+
+		CHECK(mouse_position == Vector2f(10, 20));
+		CHECK(Get(parameters, "wheel_delta_x", -1.f) == 0.f);
+		CHECK(Get(parameters, "wheel_delta_y", -1.f) == 2.f);
+		document->RemoveEventListener(EventId::Mousescroll, &listener);
+	}
+
+	SUBCASE("dictionary")
+	{
+		// Custom events use the dictionary, the typed accessors should read from it.
+		document->AddEventListener("custom", &listener);
+		button->DispatchEvent("custom", {{"button", Variant(2)}, {"shift_key", Variant(1)}, {"value", Variant("hello")}});
+
+		CHECK(mouse_position == Vector2f(0, 0));
+		CHECK(mouse_button == 2);
+		CHECK(key_identifier == Input::KI_UNKNOWN);
+		CHECK(key_modifier_state == Input::KM_SHIFT);
+		CHECK(parameters.size() == 3);
+		CHECK(Get(parameters, "value", String()) == "hello");
+		document->RemoveEventListener("custom", &listener);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("event_listener.nested_dispatch")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_decorator_rml, "assets/");
+	REQUIRE(document);
+	document->Show();
+
+	Element* button = document->GetElementById("exit");
+	REQUIRE(button);
+
+	// Dispatching an event from within a listener should not disturb the propagation of the outer event.
+	String log;
+	CallbackEventListener outer_listener([&](Event& event) {
+		log += "outer(" + event.GetCurrentElement()->GetTagName() + ") ";
+		if (event.GetCurrentElement() == button)
+			button->DispatchEvent("inner", Dictionary());
+	});
+	CallbackEventListener inner_listener([&](Event& event) { log += "inner(" + event.GetCurrentElement()->GetTagName() + ") "; });
+
+	button->AddEventListener("outer", &outer_listener);
+	document->AddEventListener("outer", &outer_listener);
+	button->AddEventListener("inner", &inner_listener);
+	document->AddEventListener("inner", &inner_listener);
+
+	for (int i = 0; i < 2; i++)
+	{
+		log.clear();
+		button->DispatchEvent("outer", Dictionary());
+		CHECK(log == "outer(button) inner(button) inner(body) outer(body) ");
+	}
+
+	button->RemoveEventListener("outer", &outer_listener);
+	document->RemoveEventListener("outer", &outer_listener);
+	button->RemoveEventListener("inner", &inner_listener);
+	document->RemoveEventListener("inner", &inner_listener);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
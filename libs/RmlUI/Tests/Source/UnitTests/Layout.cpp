@@ -31,6 +31,8 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementUtilities.h>
+#include <RmlUi/Core/StringUtilities.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -138,3 +140,226 @@ TEST_CASE("Layout.Position.Relative")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_layout_cache_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: 500px;
+			height: 400px;
+			top: 50px;
+			left: 50px;
+			font-family: LatoLatin;
+			font-size: 16px;
+			overflow: auto;
+		}
+		.boundary {
+			width: 200px;
+			height: 40px;
+			overflow: hidden;
+		}
+		#visible_overflow {
+			width: 200px;
+			height: 40px;
+			display: flow-root;
+			white-space: nowrap;
+		}
+		#escaping {
+			position: absolute;
+			bottom: 0;
+			right: 0;
+		}
+		.float {
+			float: left;
+			width: 50px;
+		}
+		.inline-block {
+			display: inline-block;
+		}
+		#inline_boundary {
+			width: 100px;
+			height: 60px;
+		}
+		#flex {
+			display: flex;
+		}
+		#flex div {
+			flex: 1 1 auto;
+		}
+		#table {
+			display: table;
+		}
+		#table > div {
+			display: table-row;
+		}
+		#table > div > div {
+			display: table-cell;
+		}
+	</style>
+</head>
+
+<body>
+	<div class="boundary" id="boundary"><span id="counter">0</span> units</div>
+	<div id="visible_overflow">Overflow <span id="overflow_text">short</span></div>
+	<div class="boundary"><div id="escaping">Escaping</div> <span id="escaping_text">text</span></div>
+	<div><div class="float" id="float">Float</div>Text wrapping around the float.</div>
+	<p>Inline <div class="inline-block" id="inline_block">block</div> and text.</p>
+	<p>Baseline <div class="inline-block" id="inline_boundary">one</div> aligned.</p>
+	<div id="flex"><div id="flex_item">A</div><div>B</div></div>
+	<div id="table"><div><div id="cell">Cell</div><div>Other</div></div></div>
+</body>
+</rml>
+)";
+
+static void CheckLayoutEqual(Element* incremental, Element* fresh)
+{
+	CAPTURE(incremental->GetAddress());
+	CHECK(incremental->GetAbsoluteOffset(BoxArea::Border) == fresh->GetAbsoluteOffset(BoxArea::Border));
+	CHECK(incremental->GetBox().GetSize(BoxArea::Border) == fresh->GetBox().GetSize(BoxArea::Border));
+	CHECK(incremental->GetScrollWidth() == fresh->GetScrollWidth());
+	CHECK(incremental->GetScrollHeight() == fresh->GetScrollHeight());
+
+	REQUIRE(incremental->GetNumChildren() == fresh->GetNumChildren());
+	for (int i = 0; i < incremental->GetNumChildren(); i++)
+		CheckLayoutEqual(incremental->GetChild(i), fresh->GetChild(i));
+}
+
+TEST_CASE("Layout.Cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Each step modifies the document in a way that should only require a partial relayout. The result should be
+	// identical to a document formatted from scratch with the same modifications applied.
+	using Step = Function<void(ElementDocument* document)>;
+	const Vector<Step> steps = {
+		[](ElementDocument* document) { document->GetElementById("counter")->SetInnerRML("12345"); },
+		[](ElementDocument* document) { document->GetElementById("overflow_text")->SetInnerRML("long text that overflows both this element and the document body, which in turn needs to update its scrollbars"); },
+		[](ElementDocument* document) { document->GetElementById("escaping_text")->SetInnerRML("changed"); },
+		[](ElementDocument* document) { document->GetElementById("escaping")->SetInnerRML("Escaping and wider"); },
+		[](ElementDocument* document) { document->GetElementById("float")->SetProperty("height", "80px"); },
+		[](ElementDocument* document) { document->GetElementById("inline_block")->SetInnerRML("wider inline block"); },
+		[](ElementDocument* document) { document->GetElementById("inline_boundary")->SetInnerRML("one<br/>two"); },
+		[](ElementDocument* document) { document->GetElementById("flex_item")->SetInnerRML("A wider flex item"); },
+		[](ElementDocument* document) { document->GetElementById("cell")->SetInnerRML("A wider table cell"); },
+		[](ElementDocument* document) { document->GetElementById("boundary")->SetProperty("width", "250px"); },
+		[](ElementDocument* document) { document->SetProperty("width", "400px"); },
+	};
+
+	ElementDocument* incremental = context->LoadDocumentFromMemory(document_layout_cache_rml);
+	REQUIRE(incremental);
+	incremental->Show();
+	context->Update();
+
+	for (size_t num_steps = 1; num_steps <= steps.size(); num_steps++)
+	{
+		CAPTURE(num_steps);
+		steps[num_steps - 1](incremental);
+		context->Update();
+
+		ElementDocument* fresh = context->LoadDocumentFromMemory(document_layout_cache_rml);
+		REQUIRE(fresh);
+		for (size_t i = 0; i < num_steps; i++)
+			steps[i](fresh);
+		fresh->Show();
+		context->Update();
+
+		CheckLayoutEqual(incremental, fresh);
+
+		fresh->Close();
+		context->Update();
+	}
+
+	incremental->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_word_break_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: 500px;
+			height: 400px;
+			font-family: LatoLatin;
+			font-size: 16px;
+			line-height: 20px;
+		}
+		div {
+			width: 60px;
+			word-break: break-all;
+		}
+		#spacing {
+			letter-spacing: 2px;
+		}
+	</style>
+</head>
+
+<body>
+	<div id="ascii">AVAWAToWaYaLTaVoVaWoAVAWAToWaYaLTaVoVaWo</div>
+	<div id="unicode">ÆØÅæøåÆØÅæøåÆØÅæøåÆØÅæøåÆØÅæøå</div>
+	<div id="spacing">AVAWAToWaYaLTaVoVaWo</div>
+	<div id="narrow" style="width: 1px">AVAW</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Layout.WordBreak")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_word_break_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	for (const char* id : {"ascii", "unicode", "spacing", "narrow"})
+	{
+		CAPTURE(id);
+		Element* element = document->GetElementById(id);
+		REQUIRE(element);
+		Element* text_element = element->GetFirstChild();
+		REQUIRE(text_element);
+
+		const String text = element->GetInnerRML();
+		const float width = element->GetBox().GetSize().x;
+		const float height = element->GetBox().GetSize().y;
+
+		// The prefix widths must agree with measuring each prefix separately.
+		Vector<int> prefix_widths;
+		ElementUtilities::GetStringPrefixWidths(text_element, text, prefix_widths);
+		REQUIRE(prefix_widths.size() == StringUtilities::LengthUTF8(text) + 1);
+		int character_index = 0;
+		for (auto it = StringIteratorU8(text); it;)
+		{
+			++it;
+			++character_index;
+			CHECK(prefix_widths[character_index] == ElementUtilities::GetStringWidth(text_element, StringView(text.data(), text.data() + it.offset())));
+		}
+
+		// Greedily fill each line with as many characters as fit, which is what breaking the word should produce.
+		int num_lines = 0;
+		int line_begin = 0;
+		while (line_begin < (int)prefix_widths.size() - 1)
+		{
+			int line_end = line_begin + 1;
+			const int begin_width = prefix_widths[line_begin];
+			while (line_end + 1 < (int)prefix_widths.size() && float(prefix_widths[line_end + 1] - begin_width) <= width)
+				line_end++;
+			line_begin = line_end;
+			num_lines++;
+		}
+
+		CHECK(num_lines > 1);
+		CHECK(height == doctest::Approx(20.f * num_lines));
+		if (String(id) != "narrow")
+			CHECK(element->GetScrollWidth() <= width);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
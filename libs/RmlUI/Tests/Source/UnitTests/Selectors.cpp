@@ -180,6 +180,10 @@ static const Vector<QuerySelector> query_selectors =
 	{ ".hello.world, #P span, #I",   "Z D0 D1 F0 H I",  SelectorOp::RemoveClasses,        "world", "D0 D1 F0 I" },
 	{ "body * span",                 "D0 D1 F0" },
 	{ "D1 *",                        "" },
+	{ ".parent p span",              "D0 D1 F0",        SelectorOp::RemoveClasses,        "parent", "" },
+	{ "#E + p span",                 "F0" },
+	{ "#A ~ #D span",                "D0 D1" },
+	{ "#P h1 ~ p span",              "D0 D1 F0" },
 
 	{ "#E + #F",                     "F",               SelectorOp::InsertElementBefore,  "F",     "" },
 	{ "#E+#F",                       "F" },
@@ -539,3 +543,67 @@ TEST_CASE("Selectors")
 
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("Selectors.ClassesAndPseudoClasses")
+{
+	Context* context = TestsShell::GetContext();
+
+	const String document_string = doc_begin + R"(
+		div.first.second { width: 10px; }
+		div:custom-pseudo-70 { height: 20px; }
+	)" + doc_end;
+	ElementDocument* document = context->LoadDocumentFromMemory(document_string);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* element = document->GetElementById("X");
+	REQUIRE(element);
+
+	SUBCASE("Classes")
+	{
+		element->SetClass("second", true);
+		element->SetClass("first", true);
+		context->Update();
+		CHECK(element->IsClassSet("first"));
+		CHECK(element->IsClassSet("second"));
+		CHECK(element->GetClassNames() == "hello second first");
+		CHECK(element->GetProperty<float>("width") == 10.f);
+
+		element->SetClass("first", false);
+		context->Update();
+		CHECK(!element->IsClassSet("first"));
+		CHECK(!element->IsClassSet("never-used-class"));
+		CHECK(element->GetClassNames() == "hello second");
+		CHECK(element->GetProperty<float>("width") != 10.f);
+
+		element->SetClassNames("first second");
+		context->Update();
+		CHECK(element->GetProperty<float>("width") == 10.f);
+	}
+
+	SUBCASE("PseudoClasses")
+	{
+		// Set enough distinct pseudo classes to exceed what fits in a single word of the pseudo class bitset.
+		for (int i = 0; i < 100; i++)
+			element->SetPseudoClass(CreateString("custom-pseudo-%d", i), true);
+		context->Update();
+
+		CHECK(element->GetActivePseudoClasses().size() == 100);
+		CHECK(element->IsPseudoClassSet("custom-pseudo-99"));
+		CHECK(element->GetProperty<float>("height") == 20.f);
+
+		for (int i = 0; i < 100; i += 2)
+			element->SetPseudoClass(CreateString("custom-pseudo-%d", i), false);
+		context->Update();
+
+		CHECK(element->GetActivePseudoClasses().size() == 50);
+		CHECK(!element->IsPseudoClassSet("custom-pseudo-70"));
+		CHECK(element->IsPseudoClassSet("custom-pseudo-71"));
+		CHECK(!element->IsPseudoClassSet("never-used-pseudo-class"));
+		CHECK(element->GetProperty<float>("height") != 20.f);
+	}
+
+	context->UnloadDocument(document);
+	TestsShell::ShutdownShell();
+}
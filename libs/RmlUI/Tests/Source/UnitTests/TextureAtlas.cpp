@@ -0,0 +1,122 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../../Source/Core/TextureAtlas.cpp"
+#include <doctest.h>
+
+using namespace Rml;
+
+static bool Overlaps(const TextureAtlas::Entry& a, const TextureAtlas::Entry& b)
+{
+	if (a.page != b.page)
+		return false;
+	return a.position.x < b.position.x + b.dimensions.x && b.position.x < a.position.x + a.dimensions.x &&
+		a.position.y < b.position.y + b.dimensions.y && b.position.y < a.position.y + a.dimensions.y;
+}
+
+TEST_CASE("TextureAtlas.Insert")
+{
+	TextureAtlas atlas(256);
+
+	Vector<TextureAtlas::Entry> entries;
+	for (int i = 0; i < 100; i++)
+	{
+		TextureAtlas::Entry entry;
+		entry.id = i;
+		entry.dimensions = Vector2i(4 + (i * 7) % 20, 4 + (i * 13) % 24);
+		entries.push_back(entry);
+	}
+
+	REQUIRE(atlas.Insert(entries));
+	REQUIRE(atlas.GetNumPages() >= 1);
+
+	for (size_t i = 0; i < entries.size(); i++)
+	{
+		const TextureAtlas::Entry& entry = entries[i];
+		CAPTURE(i);
+		REQUIRE(entry.page >= 0);
+		const Vector2i page_dimensions = atlas.GetPageDimensions(entry.page);
+		CHECK(entry.position.x >= 0);
+		CHECK(entry.position.y >= 0);
+		CHECK(entry.position.x + entry.dimensions.x <= page_dimensions.x);
+		CHECK(entry.position.y + entry.dimensions.y <= page_dimensions.y);
+
+		for (size_t j = i + 1; j < entries.size(); j++)
+			CHECK(!Overlaps(entry, entries[j]));
+	}
+
+	TextureAtlas::Entry too_large;
+	too_large.dimensions = Vector2i(300, 10);
+	Vector<TextureAtlas::Entry> too_large_entries = {too_large};
+	CHECK(!atlas.Insert(too_large_entries));
+	CHECK(too_large_entries[0].page == -1);
+}
+
+TEST_CASE("TextureAtlas.Incremental")
+{
+	TextureAtlas atlas(512);
+
+	Vector<TextureAtlas::Entry> first(10);
+	for (TextureAtlas::Entry& entry : first)
+		entry.dimensions = Vector2i(16, 16);
+	REQUIRE(atlas.Insert(first));
+	REQUIRE(atlas.GetNumPages() == 1);
+
+	// Newly created pages are marked clean when uploaded in full.
+	atlas.MarkClean(0);
+	Vector<byte> region_data;
+	CHECK(!atlas.TakeDirtyRegion(0, region_data).Valid());
+
+	const Vector<TextureAtlas::Entry> first_placed = first;
+
+	Vector<TextureAtlas::Entry> second(1);
+	second[0].dimensions = Vector2i(8, 8);
+	REQUIRE(atlas.Insert(second));
+	REQUIRE(second[0].page == 0);
+
+	// Existing entries keep their place.
+	for (size_t i = 0; i < first.size(); i++)
+	{
+		CHECK(first[i].page == first_placed[i].page);
+		CHECK(first[i].position == first_placed[i].position);
+		CHECK(!Overlaps(first[i], second[0]));
+	}
+
+	byte* pixel = atlas.GetPageData(0, second[0].position);
+	pixel[0] = 255;
+
+	// Only the new entry needs to be uploaded.
+	const Rectanglei region = atlas.TakeDirtyRegion(0, region_data);
+	REQUIRE(region.Valid());
+	CHECK(region.Position() == second[0].position);
+	CHECK(region.Size() == second[0].dimensions);
+	REQUIRE(region_data.size() == size_t(8 * 8 * 4));
+	CHECK(region_data[0] == 255);
+
+	CHECK(!atlas.TakeDirtyRegion(0, region_data).Valid());
+}
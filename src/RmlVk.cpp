@@ -1,3 +1,597 @@
-//
-// Created by Kingscraft Studios on 9/26/2025.
-//
+#include "RmlVk.hpp"
+
+#include "lve_pipeline.hpp"
+#include "lve_swap_chain.hpp"
+
+// Precompiled SPIR-V shipped with the RmlUi Vulkan backend
+#include "RmlUi_Vulkan/ShadersCompiledSPV.h"
+
+#include <stb_image.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+namespace lve {
+
+    static constexpr uint32_t DESCRIPTOR_POOL_SETS = 256;
+    static constexpr VkDeviceSize INITIAL_VERTEX_BYTES = 64 * 1024 * sizeof(Rml::Vertex);
+    static constexpr VkDeviceSize INITIAL_INDEX_BYTES = 128 * 1024 * sizeof(uint32_t);
+    static constexpr VkDeviceSize INITIAL_UNIFORM_BLOCKS = 256;
+
+    static bool sameRect(const VkRect2D &a, const VkRect2D &b) {
+        return a.offset.x == b.offset.x && a.offset.y == b.offset.y &&
+               a.extent.width == b.extent.width && a.extent.height == b.extent.height;
+    }
+
+    std::unique_ptr<RmlVk> RmlVk::instance = nullptr;
+
+    void RmlVk::init(LveDevice &device, VkRenderPass renderPass) {
+        if (!instance) {
+            instance = std::make_unique<RmlVk>(device, renderPass);
+            std::cout << "RmlVk Initialized" << std::endl;
+        }
+    }
+
+    RmlVk &RmlVk::get() {
+        if (!instance) throw std::runtime_error("RmlVk Not Initialized");
+        return *instance;
+    }
+
+    RmlVk::RmlVk(LveDevice &device, VkRenderPass renderPass) : lveDevice{device} {
+        VkDeviceSize alignment = lveDevice.properties.limits.minUniformBufferOffsetAlignment;
+        alignment = std::max<VkDeviceSize>(alignment, 1);
+        uniformStride = (sizeof(UniformBlock) + alignment - 1) / alignment * alignment;
+
+        createDescriptorSetLayouts();
+        createPipelineLayout();
+        createPipeline(renderPass);
+
+        frames.resize(LveSwapChain::MAX_FRAMES_IN_FLIGHT);
+        for (auto &frameData: frames) {
+            createRingBuffer(frameData.vertices, INITIAL_VERTEX_BYTES, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+            createRingBuffer(frameData.indices, INITIAL_INDEX_BYTES, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+            createRingBuffer(frameData.uniforms, uniformStride * INITIAL_UNIFORM_BLOCKS,
+                             VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+            writeUniformSet(frameData);
+        }
+
+        // Untextured geometry samples a white texel so it can share the single textured pipeline
+        const unsigned char white[] = {255, 255, 255, 255};
+        whiteTexture = createTexture(white, 1, 1);
+    }
+
+    void RmlVk::cleanup() {
+        std::cout << "[RmlVk] Destroying render interface resources...\n";
+        for (auto &frameData: frames) {
+            releaseRetired(frameData);
+            destroyRingBuffer(frameData.vertices);
+            destroyRingBuffer(frameData.indices);
+            destroyRingBuffer(frameData.uniforms);
+        }
+        frames.clear();
+
+        for (auto &pair: textures) {
+            destroyTexture(*pair.second);
+        }
+        textures.clear();
+
+        for (auto pool: descriptorPools)
+            vkDestroyDescriptorPool(lveDevice.device(), pool, nullptr);
+        descriptorPools.clear();
+
+        vkDestroyPipeline(lveDevice.device(), pipeline, nullptr);
+        vkDestroyPipelineLayout(lveDevice.device(), pipelineLayout, nullptr);
+        vkDestroyDescriptorSetLayout(lveDevice.device(), uniformSetLayout, nullptr);
+        vkDestroyDescriptorSetLayout(lveDevice.device(), textureSetLayout, nullptr);
+    }
+
+    void RmlVk::recreatePipeline(VkRenderPass renderPass) {
+        vkDestroyPipeline(lveDevice.device(), pipeline, nullptr);
+        createPipeline(renderPass);
+    }
+
+    void RmlVk::createDescriptorSetLayouts() {
+        // Bindings follow the RmlUi shaders: set 0 binding 1 is the vertex transform, set 1 binding 2 the texture
+        VkDescriptorSetLayoutBinding uniformBinding{};
+        uniformBinding.binding = 1;
+        uniformBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        uniformBinding.descriptorCount = 1;
+        uniformBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.bindingCount = 1;
+        layoutInfo.pBindings = &uniformBinding;
+
+        if (vkCreateDescriptorSetLayout(lveDevice.device(), &layoutInfo, nullptr, &uniformSetLayout) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create RmlUi uniform descriptor set layout!");
+        }
+
+        VkDescriptorSetLayoutBinding samplerBinding{};
+        samplerBinding.binding = 2;
+        samplerBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        samplerBinding.descriptorCount = 1;
+        samplerBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+        layoutInfo.pBindings = &samplerBinding;
+
+        if (vkCreateDescriptorSetLayout(lveDevice.device(), &layoutInfo, nullptr, &textureSetLayout) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create RmlUi texture descriptor set layout!");
+        }
+    }
+
+    void RmlVk::createPipelineLayout() {
+        VkDescriptorSetLayout setLayouts[] = {uniformSetLayout, textureSetLayout};
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 2;
+        pipelineLayoutInfo.pSetLayouts = setLayouts;
+
+        if (vkCreatePipelineLayout(lveDevice.device(), &pipelineLayoutInfo, nullptr, &pipelineLayout) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create RmlUi pipeline layout!");
+        }
+    }
+
+    VkShaderModule RmlVk::createShaderModule(const unsigned char *code, size_t size) {
+        VkShaderModuleCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        createInfo.codeSize = size;
+        createInfo.pCode = reinterpret_cast<const uint32_t *>(code);
+
+        VkShaderModule shaderModule;
+        if (vkCreateShaderModule(lveDevice.device(), &createInfo, nullptr, &shaderModule) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create RmlUi shader module!");
+        }
+        return shaderModule;
+    }
+
+    void RmlVk::createPipeline(VkRenderPass renderPass) {
+        PipelineConfigInfo configInfo{};
+        LvePipeline::dafaultPipelineConfigInfo(configInfo);
+        configInfo.renderPass = renderPass;
+        configInfo.pipelineLayout = pipelineLayout;
+
+        // RmlUi hands us premultiplied alpha and draws on top of the scene without depth
+        configInfo.blendAttachmentState.blendEnable = VK_TRUE;
+        configInfo.blendAttachmentState.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+        configInfo.blendAttachmentState.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        configInfo.blendAttachmentState.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+        configInfo.blendAttachmentState.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        configInfo.depthStencilInfo.depthTestEnable = VK_FALSE;
+        configInfo.depthStencilInfo.depthWriteEnable = VK_FALSE;
+
+        VkShaderModule vertShaderModule = createShaderModule(shader_vert, sizeof(shader_vert));
+        VkShaderModule fragShaderModule = createShaderModule(shader_frag_texture, sizeof(shader_frag_texture));
+
+        VkPipelineShaderStageCreateInfo shaderStages[2]{};
+        shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+        shaderStages[0].module = vertShaderModule;
+        shaderStages[0].pName = "main";
+        shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+        shaderStages[1].module = fragShaderModule;
+        shaderStages[1].pName = "main";
+
+        VkVertexInputBindingDescription bindingDescription{};
+        bindingDescription.binding = 0;
+        bindingDescription.stride = sizeof(Rml::Vertex);
+        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+        VkVertexInputAttributeDescription attributeDescriptions[3]{};
+        attributeDescriptions[0].location = 0;
+        attributeDescriptions[0].format = VK_FORMAT_R32G32_SFLOAT;
+        attributeDescriptions[0].offset = offsetof(Rml::Vertex, position);
+        attributeDescriptions[1].location = 1;
+        attributeDescriptions[1].format = VK_FORMAT_R8G8B8A8_UNORM;
+        attributeDescriptions[1].offset = offsetof(Rml::Vertex, colour);
+        attributeDescriptions[2].location = 2;
+        attributeDescriptions[2].format = VK_FORMAT_R32G32_SFLOAT;
+        attributeDescriptions[2].offset = offsetof(Rml::Vertex, tex_coord);
+
+        VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
+        vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+        vertexInputInfo.vertexBindingDescriptionCount = 1;
+        vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
+        vertexInputInfo.vertexAttributeDescriptionCount = 3;
+        vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions;
+
+        VkGraphicsPipelineCreateInfo pipelineInfo{};
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        pipelineInfo.stageCount = 2;
+        pipelineInfo.pStages = shaderStages;
+        pipelineInfo.pVertexInputState = &vertexInputInfo;
+        pipelineInfo.pInputAssemblyState = &configInfo.inputAssemblyInfo;
+        pipelineInfo.pViewportState = &configInfo.viewportInfo;
+        pipelineInfo.pRasterizationState = &configInfo.rasterizationInfo;
+        pipelineInfo.pMultisampleState = &configInfo.multisampleInfo;
+        pipelineInfo.pColorBlendState = &configInfo.colorBlendInfo;
+        pipelineInfo.pDepthStencilState = &configInfo.depthStencilInfo;
+        pipelineInfo.pDynamicState = &configInfo.dynamicStateInfo;
+        pipelineInfo.layout = configInfo.pipelineLayout;
+        pipelineInfo.renderPass = configInfo.renderPass;
+        pipelineInfo.subpass = configInfo.subpass;
+        pipelineInfo.basePipelineIndex = -1;
+        pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+
+        VkResult result = vkCreateGraphicsPipelines(lveDevice.device(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr,
+                                                    &pipeline);
+
+        vkDestroyShaderModule(lveDevice.device(), vertShaderModule, nullptr);
+        vkDestroyShaderModule(lveDevice.device(), fragShaderModule, nullptr);
+
+        if (result != VK_SUCCESS) {
+            throw std::runtime_error("failed to create RmlUi graphics pipeline!");
+        }
+    }
+
+    VkDescriptorSet RmlVk::allocateDescriptorSet(VkDescriptorSetLayout layout, VkDescriptorPool &pool) {
+        VkDescriptorSetAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &layout;
+
+        VkDescriptorSet descriptorSet;
+        for (auto it = descriptorPools.rbegin(); it != descriptorPools.rend(); ++it) {
+            allocInfo.descriptorPool = *it;
+            if (vkAllocateDescriptorSets(lveDevice.device(), &allocInfo, &descriptorSet) == VK_SUCCESS) {
+                pool = *it;
+                return descriptorSet;
+            }
+        }
+
+        // Every pool is exhausted, add another one
+        VkDescriptorPoolSize poolSizes[2]{};
+        poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        poolSizes[0].descriptorCount = DESCRIPTOR_POOL_SETS;
+        poolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        poolSizes[1].descriptorCount = DESCRIPTOR_POOL_SETS;
+
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+        poolInfo.poolSizeCount = 2;
+        poolInfo.pPoolSizes = poolSizes;
+        poolInfo.maxSets = DESCRIPTOR_POOL_SETS;
+
+        VkDescriptorPool newPool;
+        if (vkCreateDescriptorPool(lveDevice.device(), &poolInfo, nullptr, &newPool) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create RmlUi descriptor pool!");
+        }
+        descriptorPools.push_back(newPool);
+
+        allocInfo.descriptorPool = newPool;
+        if (vkAllocateDescriptorSets(lveDevice.device(), &allocInfo, &descriptorSet) != VK_SUCCESS) {
+            throw std::runtime_error("failed to allocate RmlUi descriptor set!");
+        }
+        pool = newPool;
+        return descriptorSet;
+    }
+
+    void RmlVk::createRingBuffer(RingBuffer &ring, VkDeviceSize capacity, VkBufferUsageFlags usage) {
+        // Persistently mapped for the lifetime of the buffer
+        void *data;
+        lveDevice.createBuffer(
+                capacity,
+                usage,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                ring.buffer,
+                ring.allocation,
+                &data);
+        ring.mapped = static_cast<char *>(data);
+        ring.capacity = capacity;
+        ring.used = 0;
+    }
+
+    void RmlVk::destroyRingBuffer(RingBuffer &ring) {
+        if (ring.buffer == VK_NULL_HANDLE) return;
+        lveDevice.destroyBuffer(ring.buffer, ring.allocation);
+        ring = {};
+    }
+
+    void RmlVk::reserve(RingBuffer &ring, VkDeviceSize bytes, VkBufferUsageFlags usage) {
+        if (ring.used + bytes <= ring.capacity) return;
+
+        // Draws already recorded still reference the old buffer, so it is retired until this frame completes
+        flush();
+        frame->retiredBuffers.push_back(ring);
+        createRingBuffer(ring, std::max(ring.capacity * 2, bytes), usage);
+
+        if (&ring == &frame->uniforms) {
+            frame->retiredSets.emplace_back(frame->uniformPool, frame->uniformSet);
+            writeUniformSet(*frame);
+        }
+    }
+
+    void RmlVk::writeUniformSet(FrameData &frameData) {
+        frameData.uniformSet = allocateDescriptorSet(uniformSetLayout, frameData.uniformPool);
+
+        VkDescriptorBufferInfo bufferInfo{};
+        bufferInfo.buffer = frameData.uniforms.buffer;
+        bufferInfo.offset = 0;
+        bufferInfo.range = sizeof(UniformBlock);
+
+        VkWriteDescriptorSet descriptorWrite{};
+        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrite.dstSet = frameData.uniformSet;
+        descriptorWrite.dstBinding = 1;
+        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        descriptorWrite.descriptorCount = 1;
+        descriptorWrite.pBufferInfo = &bufferInfo;
+
+        vkUpdateDescriptorSets(lveDevice.device(), 1, &descriptorWrite, 0, nullptr);
+    }
+
+    void RmlVk::releaseRetired(FrameData &frameData) {
+        for (auto &ring: frameData.retiredBuffers)
+            destroyRingBuffer(ring);
+        frameData.retiredBuffers.clear();
+
+        for (auto &pair: frameData.retiredSets)
+            vkFreeDescriptorSets(lveDevice.device(), pair.first, 1, &pair.second);
+        frameData.retiredSets.clear();
+
+        for (auto &texture: frameData.retiredTextures)
+            destroyTexture(*texture);
+        frameData.retiredTextures.clear();
+    }
+
+    void RmlVk::destroyTexture(UiTexture &texture) {
+        vkFreeDescriptorSets(lveDevice.device(), texture.descriptorPool, 1, &texture.descriptorSet);
+        texture.texture->cleanup();
+    }
+
+    void RmlVk::beginFrame(VkCommandBuffer cmd, size_t index, VkExtent2D frameExtent) {
+        commandBuffer = cmd;
+        frameIndex = index;
+        frame = &frames[index];
+
+        // The fence of this frame slot was waited on in acquireNextImage, its old contents are free to reuse
+        releaseRetired(*frame);
+        frame->vertices.used = 0;
+        frame->indices.used = 0;
+        frame->uniforms.used = 0;
+
+        if (frameExtent.width != extent.width || frameExtent.height != extent.height) {
+            extent = frameExtent;
+
+            // https://matthewwellings.com/blog/the-new-vulkan-coordinate-system/
+            Rml::Matrix4f correction;
+            correction.SetColumns(Rml::Vector4f(1.0f, 0.0f, 0.0f, 0.0f), Rml::Vector4f(0.0f, -1.0f, 0.0f, 0.0f),
+                                  Rml::Vector4f(0.0f, 0.0f, 0.5f, 0.0f), Rml::Vector4f(0.0f, 0.0f, 0.5f, 1.0f));
+            projection = correction * Rml::Matrix4f::ProjectOrtho(0.0f, static_cast<float>(extent.width),
+                                                                  static_cast<float>(extent.height), 0.0f,
+                                                                  -10000.0f, 10000.0f);
+        }
+
+        transform = Rml::Matrix4f::Identity();
+        transformDirty = true;
+        scissorEnabled = false;
+        batch = {};
+        boundVertexBuffer = VK_NULL_HANDLE;
+        boundIndexBuffer = VK_NULL_HANDLE;
+        boundUniformSet = VK_NULL_HANDLE;
+        boundUniformOffset = UINT32_MAX;
+        boundTextureSet = VK_NULL_HANDLE;
+        scissorBound = false;
+        drawCallCount = 0;
+
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+
+        VkViewport viewport{};
+        viewport.width = static_cast<float>(extent.width);
+        viewport.height = static_cast<float>(extent.height);
+        viewport.minDepth = 0.0f;
+        viewport.maxDepth = 1.0f;
+        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+    }
+
+    void RmlVk::endFrame() {
+        flush();
+        commandBuffer = VK_NULL_HANDLE;
+        frame = nullptr;
+    }
+
+    void RmlVk::flush() {
+        if (batch.indexCount == 0) return;
+
+        if (boundVertexBuffer != frame->vertices.buffer) {
+            VkDeviceSize offset = 0;
+            vkCmdBindVertexBuffers(commandBuffer, 0, 1, &frame->vertices.buffer, &offset);
+            boundVertexBuffer = frame->vertices.buffer;
+        }
+        if (boundIndexBuffer != frame->indices.buffer) {
+            vkCmdBindIndexBuffer(commandBuffer, frame->indices.buffer, 0, VK_INDEX_TYPE_UINT32);
+            boundIndexBuffer = frame->indices.buffer;
+        }
+        if (boundUniformSet != frame->uniformSet || boundUniformOffset != batch.uniformOffset) {
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout,
+                                    0, 1, &frame->uniformSet, 1, &batch.uniformOffset);
+            boundUniformSet = frame->uniformSet;
+            boundUniformOffset = batch.uniformOffset;
+        }
+        if (boundTextureSet != batch.textureSet) {
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout,
+                                    1, 1, &batch.textureSet, 0, nullptr);
+            boundTextureSet = batch.textureSet;
+        }
+        if (!scissorBound || !sameRect(boundScissor, batch.scissor)) {
+            vkCmdSetScissor(commandBuffer, 0, 1, &batch.scissor);
+            boundScissor = batch.scissor;
+            scissorBound = true;
+        }
+
+        vkCmdDrawIndexed(commandBuffer, batch.indexCount, 1, batch.firstIndex, 0, 0);
+        drawCallCount++;
+        batch.indexCount = 0;
+    }
+
+    Rml::CompiledGeometryHandle RmlVk::CompileGeometry(Rml::Span<const Rml::Vertex> vertices,
+                                                       Rml::Span<const int> indices) {
+        // RmlUi keeps the data alive and immutable until ReleaseGeometry, it is copied into the ring at draw time
+        auto *geometry = new Geometry{vertices, indices};
+        return reinterpret_cast<Rml::CompiledGeometryHandle>(geometry);
+    }
+
+    void RmlVk::ReleaseGeometry(Rml::CompiledGeometryHandle geometry) {
+        delete reinterpret_cast<Geometry *>(geometry);
+    }
+
+    void RmlVk::RenderGeometry(Rml::CompiledGeometryHandle handle, Rml::Vector2f translation,
+                               Rml::TextureHandle texture) {
+        if (!frame) return;
+
+        const auto *geometry = reinterpret_cast<const Geometry *>(handle);
+        const auto *uiTexture = reinterpret_cast<const UiTexture *>(texture ? texture : whiteTexture);
+        const size_t vertexCount = geometry->vertices.size();
+        const size_t indexCount = geometry->indices.size();
+        if (vertexCount == 0 || indexCount == 0) return;
+
+        reserve(frame->vertices, vertexCount * sizeof(Rml::Vertex), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+        reserve(frame->indices, indexCount * sizeof(uint32_t), VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+
+        if (transformDirty) {
+            reserve(frame->uniforms, uniformStride, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+            UniformBlock block{projection * transform, Rml::Vector2f(0.0f, 0.0f)};
+            std::memcpy(frame->uniforms.mapped + frame->uniforms.used, &block, sizeof(block));
+            uniformOffset = static_cast<uint32_t>(frame->uniforms.used);
+            frame->uniforms.used += uniformStride;
+            transformDirty = false;
+        }
+
+        const VkRect2D activeScissor = scissorEnabled ? scissor : VkRect2D{{0, 0}, extent};
+        if (batch.indexCount > 0 &&
+            (batch.textureSet != uiTexture->descriptorSet || batch.uniformOffset != uniformOffset ||
+             !sameRect(batch.scissor, activeScissor))) {
+            flush();
+        }
+        if (batch.indexCount == 0) {
+            batch.textureSet = uiTexture->descriptorSet;
+            batch.scissor = activeScissor;
+            batch.uniformOffset = uniformOffset;
+            batch.firstIndex = static_cast<uint32_t>(frame->indices.used / sizeof(uint32_t));
+        }
+
+        // Translation is baked into the vertices so draws at different offsets still merge
+        const auto baseVertex = static_cast<uint32_t>(frame->vertices.used / sizeof(Rml::Vertex));
+        auto *dstVertices = reinterpret_cast<Rml::Vertex *>(frame->vertices.mapped + frame->vertices.used);
+        for (size_t i = 0; i < vertexCount; i++) {
+            dstVertices[i] = geometry->vertices[i];
+            dstVertices[i].position += translation;
+        }
+        frame->vertices.used += vertexCount * sizeof(Rml::Vertex);
+
+        auto *dstIndices = reinterpret_cast<uint32_t *>(frame->indices.mapped + frame->indices.used);
+        for (size_t i = 0; i < indexCount; i++) {
+            dstIndices[i] = baseVertex + static_cast<uint32_t>(geometry->indices[i]);
+        }
+        frame->indices.used += indexCount * sizeof(uint32_t);
+
+        batch.indexCount += static_cast<uint32_t>(indexCount);
+    }
+
+    Rml::TextureHandle RmlVk::createTexture(const unsigned char *pixels, uint32_t width, uint32_t height) {
+        auto uiTexture = std::make_unique<UiTexture>();
+        // RmlUi colours are already premultiplied in sRGB space, keep them unconverted
+        uiTexture->texture = std::make_unique<Texture>(lveDevice, pixels, width, height, VK_FORMAT_R8G8B8A8_UNORM);
+        uiTexture->descriptorSet = allocateDescriptorSet(textureSetLayout, uiTexture->descriptorPool);
+
+        VkDescriptorImageInfo imageInfo{};
+        imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        imageInfo.imageView = uiTexture->texture->getImageView();
+        imageInfo.sampler = uiTexture->texture->getSampler();
+
+        VkWriteDescriptorSet descriptorWrite{};
+        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrite.dstSet = uiTexture->descriptorSet;
+        descriptorWrite.dstBinding = 2;
+        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        descriptorWrite.descriptorCount = 1;
+        descriptorWrite.pImageInfo = &imageInfo;
+
+        vkUpdateDescriptorSets(lveDevice.device(), 1, &descriptorWrite, 0, nullptr);
+
+        auto handle = reinterpret_cast<Rml::TextureHandle>(uiTexture.get());
+        textures[handle] = std::move(uiTexture);
+        return handle;
+    }
+
+    Rml::TextureHandle RmlVk::LoadTexture(Rml::Vector2i &textureDimensions, const Rml::String &source) {
+        int texWidth, texHeight, texChannels;
+        stbi_uc *pixels = stbi_load(source.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+        if (!pixels) {
+            std::cerr << "[RmlVk] failed to load texture: " << source << std::endl;
+            return 0;
+        }
+
+        const size_t pixelCount = static_cast<size_t>(texWidth) * texHeight;
+        for (size_t i = 0; i < pixelCount; i++) {
+            stbi_uc *pixel = pixels + i * 4;
+            const unsigned int alpha = pixel[3];
+            pixel[0] = static_cast<stbi_uc>(pixel[0] * alpha / 255);
+            pixel[1] = static_cast<stbi_uc>(pixel[1] * alpha / 255);
+            pixel[2] = static_cast<stbi_uc>(pixel[2] * alpha / 255);
+        }
+
+        textureDimensions = Rml::Vector2i(texWidth, texHeight);
+        Rml::TextureHandle handle = createTexture(pixels, static_cast<uint32_t>(texWidth),
+                                                  static_cast<uint32_t>(texHeight));
+        stbi_image_free(pixels);
+        return handle;
+    }
+
+    Rml::TextureHandle RmlVk::GenerateTexture(Rml::Span<const Rml::byte> source, Rml::Vector2i sourceDimensions) {
+        if (sourceDimensions.x <= 0 || sourceDimensions.y <= 0 ||
+            source.size() < static_cast<size_t>(sourceDimensions.x) * sourceDimensions.y * 4) {
+            return 0;
+        }
+        return createTexture(source.data(), static_cast<uint32_t>(sourceDimensions.x),
+                             static_cast<uint32_t>(sourceDimensions.y));
+    }
+
+    void RmlVk::ReleaseTexture(Rml::TextureHandle texture) {
+        auto it = textures.find(texture);
+        if (it == textures.end()) return;
+
+        // Frames already recorded may still sample it
+        frames[frameIndex].retiredTextures.push_back(std::move(it->second));
+        textures.erase(it);
+    }
+
+    void RmlVk::EnableScissorRegion(bool enable) {
+        scissorEnabled = enable;
+    }
+
+    void RmlVk::SetScissorRegion(Rml::Rectanglei region) {
+        const int left = std::clamp(region.Left(), 0, static_cast<int>(extent.width));
+        const int top = std::clamp(region.Top(), 0, static_cast<int>(extent.height));
+        const int right = std::clamp(region.Right(), left, static_cast<int>(extent.width));
+        const int bottom = std::clamp(region.Bottom(), top, static_cast<int>(extent.height));
+
+        scissor.offset = {left, top};
+        scissor.extent = {static_cast<uint32_t>(right - left), static_cast<uint32_t>(bottom - top)};
+    }
+
+    void RmlVk::SetTransform(const Rml::Matrix4f *newTransform) {
+        transform = newTransform ? *newTransform : Rml::Matrix4f::Identity();
+        transformDirty = true;
+    }
+
+    bool RmlVk::UpdateTexture(Rml::TextureHandle texture, Rml::Span<const Rml::byte> source,
+                              Rml::Rectanglei region) {
+        auto it = textures.find(texture);
+        if (it == textures.end() || region.Width() <= 0 || region.Height() <= 0 ||
+            source.size() < static_cast<size_t>(region.Width()) * region.Height() * 4) {
+            return false;
+        }
+
+        // Glyphs are only ever added to free space, so draws already recorded against this texture stay valid
+        it->second->texture->update(source.data(), region.Left(), region.Top(),
+                                    static_cast<uint32_t>(region.Width()), static_cast<uint32_t>(region.Height()));
+        return true;
+    }
+}
@@ -1,7 +1,17 @@
 #include "TextureManager.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <stb_image.h>
+
 namespace lve {
 
+    // Upload memory shared by all in-flight batches; a few full-screen RGBA8 images fit at once
+    static constexpr VkDeviceSize STAGING_RING_SIZE = 32ull * 1024 * 1024;
+    // Keeps every copy source offset a multiple of the texel size
+    static constexpr VkDeviceSize STAGING_ALIGNMENT = 16;
+    static constexpr unsigned MAX_DECODE_WORKERS = 4;
+
     // TextureManager::~TextureManager() {
     //     std::cout << "[TextureManager] Cleaning up textures..." << std::endl;
     //     for (auto &texPair : textures) {
@@ -14,6 +24,59 @@ namespace lve {
     // Initialize static singleton pointer
     std::unique_ptr<TextureManager> TextureManager::instance_ = nullptr;
 
+    TextureManager::TextureManager(LveDevice& device) : lveDevice(device) {
+        const unsigned char transparent[4] = {0, 0, 0, 0};
+        placeholder = std::make_unique<Texture>(lveDevice, transparent, 1, 1);
+
+        createUploadResources();
+
+        unsigned workerCount = std::clamp(std::thread::hardware_concurrency(), 2u, MAX_DECODE_WORKERS + 1) - 1;
+        for (unsigned i = 0; i < workerCount; i++) {
+            workers.emplace_back(&TextureManager::workerLoop, this);
+        }
+    }
+
+    // Worker threads must be joined even if cleanup() was never reached
+    TextureManager::~TextureManager() {
+        stopWorkers();
+    }
+
+    void TextureManager::createUploadResources() {
+        QueueFamilyIndices queueFamilyIndices = lveDevice.findPhysicalQueueFamilies();
+
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.queueFamilyIndex = queueFamilyIndices.transferFamily;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+        if (vkCreateCommandPool(lveDevice.device(), &poolInfo, nullptr, &transferCommandPool) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create transfer command pool!");
+        }
+
+        VkSemaphoreTypeCreateInfo timelineInfo{};
+        timelineInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        timelineInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        timelineInfo.initialValue = 0;
+
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext = &timelineInfo;
+
+        if (vkCreateSemaphore(lveDevice.device(), &semaphoreInfo, nullptr, &uploadSemaphore) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create upload timeline semaphore!");
+        }
+
+        void* mapped;
+        lveDevice.createBuffer(STAGING_RING_SIZE,
+                               VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                               staging.buffer,
+                               staging.allocation,
+                               &mapped);
+        staging.mapped = static_cast<char*>(mapped);
+        staging.capacity = STAGING_RING_SIZE;
+    }
+
     // Load texture or return cached one
     Texture& TextureManager::loadTexture(const std::string& filepath) {
         auto it = textures.find(filepath);
@@ -30,13 +93,349 @@ namespace lve {
         return *texPtr;
     }
 
+    TextureId TextureManager::loadTextureAsync(const std::string& filepath) {
+        auto it = asyncIds.find(filepath);
+        if (it != asyncIds.end()) {
+            return it->second;
+        }
+
+        TextureId id = static_cast<TextureId>(asyncTextures.size());
+        asyncTextures.push_back({filepath, nullptr});
+        asyncIds[filepath] = id;
+
+        // Already loaded synchronously → resident right away
+        auto loaded = textures.find(filepath);
+        if (loaded != textures.end()) {
+            asyncTextures[id].texture = loaded->second.get();
+            return id;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            decodeJobs.push_back({id, filepath});
+        }
+        jobAvailable.notify_one();
+        return id;
+    }
+
+    Texture& TextureManager::getTexture(TextureId id) {
+        Texture* texture = asyncTextures.at(id).texture;
+        return texture ? *texture : *placeholder;
+    }
+
+    void TextureManager::workerLoop() {
+        while (true) {
+            DecodeJob job;
+            {
+                std::unique_lock<std::mutex> lock(queueMutex);
+                jobAvailable.wait(lock, [this] { return stopping || !decodeJobs.empty(); });
+                if (stopping) {
+                    return;
+                }
+                job = std::move(decodeJobs.front());
+                decodeJobs.pop_front();
+            }
+
+            int texWidth, texHeight, texChannels;
+            stbi_uc* pixels = stbi_load(job.filepath.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+            if (!pixels) {
+                // Stays on the placeholder
+                std::cerr << "[TextureManager] failed to load texture image: " << job.filepath << std::endl;
+                continue;
+            }
+
+            std::lock_guard<std::mutex> lock(queueMutex);
+            decodedImages.push_back({job.id, pixels, static_cast<uint32_t>(texWidth),
+                                     static_cast<uint32_t>(texHeight)});
+        }
+    }
+
+    void TextureManager::stopWorkers() {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            stopping = true;
+        }
+        jobAvailable.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+    }
+
+    void TextureManager::update() {
+        retireCompletedUploads();
+        submitDecodedImages();
+    }
+
+    bool TextureManager::allocateStaging(VkDeviceSize size, VkDeviceSize& offset, VkDeviceSize& consumed) {
+        size = (size + STAGING_ALIGNMENT - 1) & ~(STAGING_ALIGNMENT - 1);
+        if (staging.used == 0) {
+            staging.head = 0;
+        }
+
+        VkDeviceSize available = staging.capacity - staging.used;
+        VkDeviceSize toEnd = staging.capacity - staging.head;
+        if (size <= toEnd) {
+            if (size > available) {
+                return false;
+            }
+            offset = staging.head;
+            consumed = size;
+        } else {
+            // Skip the tail of the buffer and wrap to the start
+            if (toEnd + size > available) {
+                return false;
+            }
+            offset = 0;
+            consumed = toEnd + size;
+        }
+
+        staging.head = (offset + size) % staging.capacity;
+        staging.used += consumed;
+        return true;
+    }
+
+    void TextureManager::retireCompletedUploads() {
+        if (uploadsInFlight.empty()) {
+            return;
+        }
+
+        uint64_t signalled;
+        if (vkGetSemaphoreCounterValue(lveDevice.device(), uploadSemaphore, &signalled) != VK_SUCCESS) {
+            throw std::runtime_error("failed to query upload timeline semaphore!");
+        }
+
+        // Batches signal increasing values, so they complete in submission order
+        while (!uploadsInFlight.empty() && uploadsInFlight.front().timelineValue <= signalled) {
+            UploadBatch& batch = uploadsInFlight.front();
+
+            for (auto& [id, texture] : batch.textures) {
+                AsyncTexture& entry = asyncTextures[id];
+                auto loaded = textures.find(entry.filepath);
+                if (loaded != textures.end()) {
+                    // Loaded synchronously while this upload was in flight
+                    texture->cleanup();
+                    entry.texture = loaded->second.get();
+                } else {
+                    entry.texture = texture.get();
+                    textures[entry.filepath] = std::move(texture);
+                }
+            }
+
+            for (auto& [buffer, allocation] : batch.dedicatedStaging) {
+                lveDevice.destroyBuffer(buffer, allocation);
+            }
+            staging.used -= batch.stagingBytes;
+            vkFreeCommandBuffers(lveDevice.device(), transferCommandPool, 1, &batch.commandBuffer);
+
+            completedUploadValue = batch.timelineValue;
+            uploadsInFlight.pop_front();
+        }
+    }
+
+    void TextureManager::submitDecodedImages() {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            pendingUploads.insert(pendingUploads.end(), decodedImages.begin(), decodedImages.end());
+            decodedImages.clear();
+        }
+        if (pendingUploads.empty()) {
+            return;
+        }
+
+        QueueFamilyIndices queueFamilyIndices = lveDevice.findPhysicalQueueFamilies();
+        uint32_t sharedFamilies[] = {queueFamilyIndices.graphicsFamily, queueFamilyIndices.transferFamily};
+        bool concurrent = queueFamilyIndices.graphicsFamily != queueFamilyIndices.transferFamily;
+
+        struct Copy {
+            VkBuffer source;
+            VkImage image;
+            VkBufferImageCopy region;
+        };
+
+        UploadBatch batch;
+        std::vector<Copy> copies;
+        std::vector<VkImageMemoryBarrier> toTransfer;
+        std::vector<VkImageMemoryBarrier> toShaderRead;
+
+        while (!pendingUploads.empty()) {
+            const DecodedImage& image = pendingUploads.front();
+            VkDeviceSize imageSize = static_cast<VkDeviceSize>(image.width) * image.height * 4;
+
+            VkBuffer source;
+            VkDeviceSize sourceOffset = 0;
+            if (imageSize > staging.capacity) {
+                VmaAllocation allocation;
+                void* data;
+                lveDevice.createStagingBuffer(imageSize, source, allocation, &data);
+                memcpy(data, image.pixels, static_cast<size_t>(imageSize));
+                batch.dedicatedStaging.emplace_back(source, allocation);
+            } else {
+                VkDeviceSize consumed;
+                if (!allocateStaging(imageSize, sourceOffset, consumed)) {
+                    // Ring is full: the rest goes out once earlier batches have completed
+                    break;
+                }
+                memcpy(staging.mapped + sourceOffset, image.pixels, static_cast<size_t>(imageSize));
+                batch.stagingBytes += consumed;
+                source = staging.buffer;
+            }
+
+            // Shared with the graphics family so no queue ownership transfer is needed
+            VkImageCreateInfo imageInfo{};
+            imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+            imageInfo.imageType = VK_IMAGE_TYPE_2D;
+            imageInfo.extent = {image.width, image.height, 1};
+            imageInfo.mipLevels = 1;
+            imageInfo.arrayLayers = 1;
+            imageInfo.format = VK_FORMAT_R8G8B8A8_SRGB;
+            imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+            imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+            imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+            imageInfo.sharingMode = concurrent ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE;
+            imageInfo.queueFamilyIndexCount = concurrent ? 2 : 0;
+            imageInfo.pQueueFamilyIndices = concurrent ? sharedFamilies : nullptr;
+
+            VkImage vkImage;
+            VmaAllocation imageAllocation;
+            lveDevice.createImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vkImage, imageAllocation);
+
+            VkImageMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = vkImage;
+            barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+
+            barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            toTransfer.push_back(barrier);
+
+            // The fragment-shader dependency comes from the graphics submit waiting on the timeline semaphore
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = 0;
+            toShaderRead.push_back(barrier);
+
+            VkBufferImageCopy region{};
+            region.bufferOffset = sourceOffset;
+            region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+            region.imageExtent = {image.width, image.height, 1};
+            copies.push_back({source, vkImage, region});
+
+            batch.textures.emplace_back(image.id, std::make_unique<Texture>(lveDevice, vkImage, imageAllocation,
+                                                                            VK_FORMAT_R8G8B8A8_SRGB,
+                                                                            image.width, image.height));
+            stbi_image_free(image.pixels);
+            pendingUploads.pop_front();
+        }
+
+        if (batch.textures.empty()) {
+            return;
+        }
+
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandPool = transferCommandPool;
+        allocInfo.commandBufferCount = 1;
+
+        if (vkAllocateCommandBuffers(lveDevice.device(), &allocInfo, &batch.commandBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("failed to allocate upload command buffer!");
+        }
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        if (vkBeginCommandBuffer(batch.commandBuffer, &beginInfo) != VK_SUCCESS) {
+            throw std::runtime_error("failed to begin recording upload command buffer!");
+        }
+
+        vkCmdPipelineBarrier(batch.commandBuffer,
+                             VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0,
+                             0, nullptr,
+                             0, nullptr,
+                             static_cast<uint32_t>(toTransfer.size()), toTransfer.data());
+        for (const auto& copy : copies) {
+            vkCmdCopyBufferToImage(batch.commandBuffer, copy.source, copy.image,
+                                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copy.region);
+        }
+        vkCmdPipelineBarrier(batch.commandBuffer,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                             0,
+                             0, nullptr,
+                             0, nullptr,
+                             static_cast<uint32_t>(toShaderRead.size()), toShaderRead.data());
+
+        if (vkEndCommandBuffer(batch.commandBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("failed to record upload command buffer!");
+        }
+
+        batch.timelineValue = ++submittedUploadValue;
+
+        VkTimelineSemaphoreSubmitInfo timelineInfo{};
+        timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineInfo.signalSemaphoreValueCount = 1;
+        timelineInfo.pSignalSemaphoreValues = &batch.timelineValue;
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext = &timelineInfo;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &batch.commandBuffer;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &uploadSemaphore;
+
+        if (vkQueueSubmit(lveDevice.transferQueue(), 1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
+            throw std::runtime_error("failed to submit texture upload!");
+        }
+
+        uploadsInFlight.push_back(std::move(batch));
+    }
+
     void TextureManager::cleanup() {
         std::cout << "[TextureManager] Cleaning up textures...\n";
+        stopWorkers();
+
+        // Let outstanding uploads finish so their textures and staging memory can be released
+        if (submittedUploadValue > 0) {
+            VkSemaphoreWaitInfo waitInfo{};
+            waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+            waitInfo.semaphoreCount = 1;
+            waitInfo.pSemaphores = &uploadSemaphore;
+            waitInfo.pValues = &submittedUploadValue;
+            if (vkWaitSemaphores(lveDevice.device(), &waitInfo, UINT64_MAX) != VK_SUCCESS) {
+                throw std::runtime_error("failed to wait for texture uploads!");
+            }
+        }
+        retireCompletedUploads();
+
+        for (auto& image : pendingUploads) {
+            stbi_image_free(image.pixels);
+        }
+        pendingUploads.clear();
+        for (auto& image : decodedImages) {
+            stbi_image_free(image.pixels);
+        }
+        decodedImages.clear();
+
         for (auto& pair : textures) {
             auto& tex = pair.second;
             tex->cleanup();  // Each Texture knows how to destroy itself
         }
         textures.clear();
+        asyncTextures.clear();
+        asyncIds.clear();
+        placeholder->cleanup();
+
+        lveDevice.destroyBuffer(staging.buffer, staging.allocation);
+        vkDestroySemaphore(lveDevice.device(), uploadSemaphore, nullptr);
+        vkDestroyCommandPool(lveDevice.device(), transferCommandPool, nullptr);
         std::cout << "[TextureManager] Cleanup complete\n";
     }
 
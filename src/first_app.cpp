@@ -9,23 +9,29 @@ namespace lve {
         LveWindow::init(800, 600, "First App");
         LveDevice::init(LveWindow::get());
         TextureManager::init(LveDevice::get());
-        auto& tex = TextureManager::get().loadTexture("resources/textures/main_menu/800x600.png");
-        std::cout << "Texture loaded: " << tex.getImageView() << ", " << tex.getSampler() << std::endl;
+        // Streams in while the first frames draw the placeholder, see drawFrame()
+        backgroundTexture = TextureManager::get().loadTextureAsync("resources/textures/main_menu/800x600.png");
         loadModels();
         createDescriptorSetLayout();
         createDescriptorPool();
         createDescriptorSet();
         updateDescriptorSet();
         createPipelineLayout();
+        createFrameResources();
         recreateSwapChain();
-        createCommandBuffers();
+        initRmlUi();
     }
 
     FirstApp::~FirstApp() {
         std::cout << "[FirstApp] Mega Destructor Started\n";
 
+        // RmlUi releases its textures and geometry through the render interface on shutdown
+        Rml::Shutdown();
+        RmlVk::get().cleanup();
+
         // Call cleanup directly on singletons
         TextureManager::get().cleanup();
+        destroyFrameResources();
         LveModel::get().cleanup();
         LvePipeline::get().cleanup();
         LveSwapChain::get().cleanup();
@@ -48,6 +54,7 @@ namespace lve {
     void FirstApp::run() {
         while (!LveWindow::get().shouldClose()) {
             glfwPollEvents();
+            rmlContext->Update();
             drawFrame();
         }
         vkDeviceWaitIdle(LveDevice::get().device());
@@ -70,6 +77,21 @@ namespace lve {
         std::cout << "Vertex count: " << LveModel::get().getVertexCount() << std::endl;
     }
 
+    void FirstApp::initRmlUi() {
+        RmlVk::init(LveDevice::get(), LveSwapChain::get().getRenderPass());
+        Rml::SetRenderInterface(&RmlVk::get());
+        if (!Rml::Initialise()) {
+            throw std::runtime_error("failed to initialise RmlUi!");
+        }
+
+        auto extent = LveSwapChain::get().getSwapChainExtent();
+        rmlContext = Rml::CreateContext("main", Rml::Vector2i(static_cast<int>(extent.width),
+                                                              static_cast<int>(extent.height)));
+        if (!rmlContext) {
+            throw std::runtime_error("failed to create RmlUi context!");
+        }
+    }
+
     void FirstApp::createDescriptorPool() {
         VkDescriptorPoolSize poolSize{};
         poolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
@@ -99,8 +121,8 @@ namespace lve {
     }
 
     void FirstApp::updateDescriptorSet() {
-        auto& tex = TextureManager::get().loadTexture("resources/textures/main_menu/800x600.png");
-        std::cout << "Texture loaded From Cache: " << tex.getImageView() << ", " << tex.getSampler() << std::endl;
+        auto& tex = TextureManager::get().getTexture(backgroundTexture);
+        std::cout << "Background texture: " << tex.getImageView() << ", " << tex.getSampler() << std::endl;
         VkImageView imageView = tex.getImageView();
         VkSampler sampler = tex.getSampler();
         VkDescriptorImageInfo imageInfo{};
@@ -178,64 +200,89 @@ namespace lve {
         LveSwapChain::init(LveDevice::get(), extent);
         std::cout << "SwapChain image count: " << LveSwapChain::get().imageCount() << std::endl;
 
-        // Sync command buffers if image count changed
-        if (LveSwapChain::get().imageCount() != commandBuffers.size()) {
-            freeCommandBuffers();
-            createCommandBuffers();
-        }
-
         // Recreate pipeline since swapchain/framebuffer changed
         createPipeline();
+        recordStaticCommands();
+
+        if (rmlContext) {
+            RmlVk::get().recreatePipeline(LveSwapChain::get().getRenderPass());
+            rmlContext->SetDimensions(Rml::Vector2i(static_cast<int>(extent.width),
+                                                    static_cast<int>(extent.height)));
+        }
     }
 
-    void FirstApp::createCommandBuffers() {
-        commandBuffers.resize(LveSwapChain::get().imageCount());
+    void FirstApp::createFrameResources() {
+        QueueFamilyIndices queueFamilyIndices = LveDevice::get().findPhysicalQueueFamilies();
+
+        for (auto& frame : frames) {
+            VkCommandPoolCreateInfo poolInfo{};
+            poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.queueFamilyIndex = queueFamilyIndices.graphicsFamily;
+            poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+            if (vkCreateCommandPool(LveDevice::get().device(), &poolInfo, nullptr, &frame.commandPool) != VK_SUCCESS) {
+                throw std::runtime_error("failed to create frame command pool!");
+            }
+
+            VkCommandBufferAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.commandPool = frame.commandPool;
+            allocInfo.commandBufferCount = 1;
+
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            if (vkAllocateCommandBuffers(LveDevice::get().device(), &allocInfo, &frame.primary) != VK_SUCCESS) {
+                throw std::runtime_error("failed to allocate command buffers!");
+            }
+
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            if (vkAllocateCommandBuffers(LveDevice::get().device(), &allocInfo, &frame.ui) != VK_SUCCESS) {
+                throw std::runtime_error("failed to allocate command buffers!");
+            }
+        }
+
         VkCommandBufferAllocateInfo allocInfo{};
         allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
         allocInfo.commandPool = LveDevice::get().getCommandPool();
-        allocInfo.commandBufferCount = static_cast<uint32_t>(commandBuffers.size());
-
-        std::cout << "Command buffers size: " << commandBuffers.size() << std::endl;
+        allocInfo.commandBufferCount = 1;
 
-        if (vkAllocateCommandBuffers(LveDevice::get().device(), &allocInfo, commandBuffers.data()) != VK_SUCCESS) {
+        if (vkAllocateCommandBuffers(LveDevice::get().device(), &allocInfo, &staticCommands) != VK_SUCCESS) {
             throw std::runtime_error("failed to allocate command buffers!");
         }
+
+        std::cout << "Frames in flight: " << frames.size() << std::endl;
     }
 
-    void FirstApp::freeCommandBuffers() {
-        if (!commandBuffers.empty()) {
-            vkFreeCommandBuffers(LveDevice::get().device(),
-                                 LveDevice::get().getCommandPool(),
-                                 static_cast<uint32_t>(commandBuffers.size()),
-                                 commandBuffers.data());
-            commandBuffers.clear();
+    void FirstApp::destroyFrameResources() {
+        // Destroying a pool frees the command buffers allocated from it
+        for (auto& frame : frames) {
+            vkDestroyCommandPool(LveDevice::get().device(), frame.commandPool, nullptr);
+            frame = {};
         }
+        vkFreeCommandBuffers(LveDevice::get().device(), LveDevice::get().getCommandPool(), 1, &staticCommands);
+        staticCommands = VK_NULL_HANDLE;
     }
 
-    void FirstApp::recordCommandBuffer(int imageIndex) {
+    void FirstApp::recordStaticCommands() {
+        // Framebuffer is left unspecified so the same commands run against every swap chain image
+        VkCommandBufferInheritanceInfo inheritanceInfo{};
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.renderPass = LveSwapChain::get().getRenderPass();
+        inheritanceInfo.subpass = 0;
+        inheritanceInfo.framebuffer = VK_NULL_HANDLE;
+
+        // Executed by several frames that may be in flight together
         VkCommandBufferBeginInfo beginInfo{};
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT |
+                          VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+        beginInfo.pInheritanceInfo = &inheritanceInfo;
 
-        if (vkBeginCommandBuffer(commandBuffers[imageIndex], &beginInfo) != VK_SUCCESS) {
+        if (vkBeginCommandBuffer(staticCommands, &beginInfo) != VK_SUCCESS) {
             throw std::runtime_error("failed to begin recording command buffer!");
         }
 
-        VkRenderPassBeginInfo renderPassInfo{};
-        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassInfo.renderPass = LveSwapChain::get().getRenderPass();
-        renderPassInfo.framebuffer = LveSwapChain::get().getFrameBuffer(imageIndex);
-        renderPassInfo.renderArea.offset = {0, 0};
-        renderPassInfo.renderArea.extent = LveSwapChain::get().getSwapChainExtent();
-
-        std::array<VkClearValue, 2> clearValues{};
-        clearValues[0].color = {0.1f, 0.1f, 0.1f, 1.0f};
-        clearValues[1].depthStencil = {1.0f, 0};
-        renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
-        renderPassInfo.pClearValues = clearValues.data();
-
-        vkCmdBeginRenderPass(commandBuffers[imageIndex], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
-
+        // Secondary command buffers do not inherit dynamic state
         VkViewport viewport{};
         viewport.x = 0.0f;
         viewport.y = 0.0f;
@@ -244,22 +291,85 @@ namespace lve {
         viewport.minDepth = 0.0f;
         viewport.maxDepth = 1.0f;
         VkRect2D scissor{{0, 0}, LveSwapChain::get().getSwapChainExtent()};
-        vkCmdSetViewport(commandBuffers[imageIndex], 0, 1, &viewport);
-        vkCmdSetScissor(commandBuffers[imageIndex], 0, 1, &scissor);
+        vkCmdSetViewport(staticCommands, 0, 1, &viewport);
+        vkCmdSetScissor(staticCommands, 0, 1, &scissor);
 
-        LvePipeline::get().bind(commandBuffers[imageIndex]);
-        LveModel::get().bind(commandBuffers[imageIndex]);
+        LvePipeline::get().bind(staticCommands);
+        LveModel::get().bind(staticCommands);
         vkCmdBindDescriptorSets(
-                commandBuffers[imageIndex],
+                staticCommands,
                 VK_PIPELINE_BIND_POINT_GRAPHICS,
                 pipelineLayout,
                 0, 1, &descriptorSet,
                 0, nullptr
         );
-        LveModel::get().draw(commandBuffers[imageIndex]);
+        LveModel::get().draw(staticCommands);
 
-        vkCmdEndRenderPass(commandBuffers[imageIndex]);
-        if (vkEndCommandBuffer(commandBuffers[imageIndex]) != VK_SUCCESS) {
+        if (vkEndCommandBuffer(staticCommands) != VK_SUCCESS) {
+            throw std::runtime_error("failed to record command buffer!");
+        }
+    }
+
+    void FirstApp::recordCommandBuffer(FrameResources& frame, uint32_t imageIndex) {
+        // The frame slot's fence was waited on in acquireNextImage, so all its buffers can go at once
+        vkResetCommandPool(LveDevice::get().device(), frame.commandPool, 0);
+
+        // UI is the only per-frame work; RmlVk binds its own pipeline, viewport and scissor
+        VkCommandBufferInheritanceInfo inheritanceInfo{};
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.renderPass = LveSwapChain::get().getRenderPass();
+        inheritanceInfo.subpass = 0;
+        inheritanceInfo.framebuffer = LveSwapChain::get().getFrameBuffer(imageIndex);
+
+        VkCommandBufferBeginInfo uiBeginInfo{};
+        uiBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        uiBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT |
+                            VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        uiBeginInfo.pInheritanceInfo = &inheritanceInfo;
+
+        if (vkBeginCommandBuffer(frame.ui, &uiBeginInfo) != VK_SUCCESS) {
+            throw std::runtime_error("failed to begin recording command buffer!");
+        }
+
+        // The ring buffer slot follows the frame in flight
+        RmlVk::get().beginFrame(frame.ui, LveSwapChain::get().getCurrentFrame(),
+                                LveSwapChain::get().getSwapChainExtent());
+        rmlContext->Render();
+        RmlVk::get().endFrame();
+
+        if (vkEndCommandBuffer(frame.ui) != VK_SUCCESS) {
+            throw std::runtime_error("failed to record command buffer!");
+        }
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        if (vkBeginCommandBuffer(frame.primary, &beginInfo) != VK_SUCCESS) {
+            throw std::runtime_error("failed to begin recording command buffer!");
+        }
+
+        VkRenderPassBeginInfo renderPassInfo{};
+        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        renderPassInfo.renderPass = LveSwapChain::get().getRenderPass();
+        renderPassInfo.framebuffer = LveSwapChain::get().getFrameBuffer(imageIndex);
+        renderPassInfo.renderArea.offset = {0, 0};
+        renderPassInfo.renderArea.extent = LveSwapChain::get().getSwapChainExtent();
+
+        std::array<VkClearValue, 2> clearValues{};
+        clearValues[0].color = {0.1f, 0.1f, 0.1f, 1.0f};
+        clearValues[1].depthStencil = {1.0f, 0};
+        renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
+        renderPassInfo.pClearValues = clearValues.data();
+
+        vkCmdBeginRenderPass(frame.primary, &renderPassInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+
+        // Background first, UI on top
+        VkCommandBuffer secondaries[] = {staticCommands, frame.ui};
+        vkCmdExecuteCommands(frame.primary, 2, secondaries);
+
+        vkCmdEndRenderPass(frame.primary);
+        if (vkEndCommandBuffer(frame.primary) != VK_SUCCESS) {
             throw std::runtime_error("failed to record command buffer!");
         }
     }
@@ -276,8 +386,19 @@ namespace lve {
         if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
             throw std::runtime_error("failed to acquire swap chain image!");
         }
-        recordCommandBuffer(imageIndex);
-        result = LveSwapChain::get().submitCommandBuffers(&commandBuffers[imageIndex], &imageIndex);
+        TextureManager::get().update();
+        if (!backgroundResident && TextureManager::get().isResident(backgroundTexture)) {
+            // The descriptor set is bound by the static commands of every frame in flight, so it can only change once they are done
+            vkDeviceWaitIdle(LveDevice::get().device());
+            updateDescriptorSet();
+            recordStaticCommands();
+            backgroundResident = true;
+        }
+        FrameResources& frame = frames[LveSwapChain::get().getCurrentFrame()];
+        recordCommandBuffer(frame, imageIndex);
+        result = LveSwapChain::get().submitCommandBuffers(&frame.primary, &imageIndex,
+                                                          TextureManager::get().getUploadSemaphore(),
+                                                          TextureManager::get().getCompletedUploadValue());
         if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || LveWindow::get().wasWindowResized()) {
             LveWindow::get().resetWindowResizedFlag();
             recreateSwapChain();
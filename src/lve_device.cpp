@@ -1,3 +1,4 @@
+#define VMA_IMPLEMENTATION
 #include "lve_device.hpp"
 
 // std headers
@@ -8,6 +9,11 @@
 
 namespace lve {
 
+    // Long-lived images and buffers are carved out of blocks of this size (TLSF inside each block)
+    static constexpr VkDeviceSize DEVICE_BLOCK_SIZE = 64ull * 1024 * 1024;
+    // Staging uploads are freed right after the copy, so a linear pool is enough for them
+    static constexpr VkDeviceSize STAGING_BLOCK_SIZE = 32ull * 1024 * 1024;
+
 // local callback functions
     static VKAPI_ATTR VkBool32 VKAPI_CALL debugCallback(
             VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
@@ -68,6 +74,7 @@ namespace lve {
         createSurface();
         pickPhysicalDevice();
         createLogicalDevice();
+        createAllocator();
         createCommandPool();
     }
 
@@ -94,6 +101,11 @@ namespace lve {
         std::cout << "[LveDevice] Destroying command pool..." << std::endl;
         vkDestroyCommandPool(device_, commandPool, nullptr);
 
+        std::cout << "[LveDevice] Destroying memory allocator..." << std::endl;
+        printMemoryStatistics();
+        vmaDestroyPool(allocator_, stagingPool);
+        vmaDestroyAllocator(allocator_);
+
         std::cout << "[LveDevice] Destroying device..." << std::endl;
         vkDestroyDevice(device_, nullptr);
 
@@ -123,7 +135,8 @@ namespace lve {
         appInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
         appInfo.pEngineName = "No Engine";
         appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-        appInfo.apiVersion = VK_API_VERSION_1_0;
+        // 1.2 for timeline semaphores, which order TextureManager's transfer-queue uploads
+        appInfo.apiVersion = VK_API_VERSION_1_2;
 
         VkInstanceCreateInfo createInfo = {};
         createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
@@ -181,7 +194,8 @@ namespace lve {
         QueueFamilyIndices indices = findQueueFamilies(physicalDevice);
 
         std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
-        std::set<uint32_t> uniqueQueueFamilies = {indices.graphicsFamily, indices.presentFamily};
+        std::set<uint32_t> uniqueQueueFamilies = {indices.graphicsFamily, indices.presentFamily,
+                                                  indices.transferFamily};
 
         float queuePriority = 1.0f;
         for (uint32_t queueFamily: uniqueQueueFamilies) {
@@ -196,8 +210,13 @@ namespace lve {
         VkPhysicalDeviceFeatures deviceFeatures = {};
         deviceFeatures.samplerAnisotropy = VK_TRUE;
 
+        VkPhysicalDeviceVulkan12Features vulkan12Features = {};
+        vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vulkan12Features.timelineSemaphore = VK_TRUE;
+
         VkDeviceCreateInfo createInfo = {};
         createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        createInfo.pNext = &vulkan12Features;
 
         createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
         createInfo.pQueueCreateInfos = queueCreateInfos.data();
@@ -221,6 +240,7 @@ namespace lve {
 
         vkGetDeviceQueue(device_, indices.graphicsFamily, 0, &graphicsQueue_);
         vkGetDeviceQueue(device_, indices.presentFamily, 0, &presentQueue_);
+        vkGetDeviceQueue(device_, indices.transferFamily, 0, &transferQueue_);
     }
 
     void LveDevice::createCommandPool() {
@@ -237,9 +257,46 @@ namespace lve {
         }
     }
 
+    void LveDevice::createAllocator() {
+        VmaAllocatorCreateInfo allocatorInfo{};
+        allocatorInfo.vulkanApiVersion = VK_API_VERSION_1_2;
+        allocatorInfo.instance = instance;
+        allocatorInfo.physicalDevice = physicalDevice;
+        allocatorInfo.device = device_;
+        allocatorInfo.preferredLargeHeapBlockSize = DEVICE_BLOCK_SIZE;
+
+        if (vmaCreateAllocator(&allocatorInfo, &allocator_) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create memory allocator!");
+        }
+
+        VkBufferCreateInfo stagingBufferInfo{};
+        stagingBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        stagingBufferInfo.size = 1;
+        stagingBufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        stagingBufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        VmaAllocationCreateInfo stagingAllocInfo{};
+        stagingAllocInfo.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+        uint32_t memoryTypeIndex;
+        if (vmaFindMemoryTypeIndexForBufferInfo(allocator_, &stagingBufferInfo, &stagingAllocInfo,
+                                                &memoryTypeIndex) != VK_SUCCESS) {
+            throw std::runtime_error("failed to find staging memory type!");
+        }
+
+        VmaPoolCreateInfo poolInfo{};
+        poolInfo.memoryTypeIndex = memoryTypeIndex;
+        poolInfo.flags = VMA_POOL_CREATE_LINEAR_ALGORITHM_BIT;
+        poolInfo.blockSize = STAGING_BLOCK_SIZE;
+
+        if (vmaCreatePool(allocator_, &poolInfo, &stagingPool) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create staging memory pool!");
+        }
+    }
+
     void LveDevice::createImage(uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling,
                                 VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage &image,
-                                VkDeviceMemory &imageMemory) {
+                                VmaAllocation &imageAllocation) {
         VkImageCreateInfo imageInfo{};
         imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
         imageInfo.imageType = VK_IMAGE_TYPE_2D;
@@ -255,24 +312,11 @@ namespace lve {
         imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
         imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-        if (vkCreateImage(device_, &imageInfo, nullptr, &image) != VK_SUCCESS) {
-            throw std::runtime_error("failed to create image!");
-        }
-
-        VkMemoryRequirements memRequirements;
-        vkGetImageMemoryRequirements(device_, image, &memRequirements);
-
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
-
-        if (vkAllocateMemory(device_, &allocInfo, nullptr, &imageMemory) != VK_SUCCESS) {
-            throw std::runtime_error("failed to allocate image memory!");
-        }
-
-        vkBindImageMemory(device_, image, imageMemory, 0);
+        createImageWithInfo(imageInfo, properties, image, imageAllocation);
+    }
 
+    void LveDevice::destroyImage(VkImage image, VmaAllocation imageAllocation) {
+        vmaDestroyImage(allocator_, image, imageAllocation);
     }
 
     VkImageView LveDevice::createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags) {
@@ -299,7 +343,12 @@ namespace lve {
     void LveDevice::transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout,
                                           VkImageLayout newLayout) {
         VkCommandBuffer commandBuffer = beginSingleTimeCommands();
+        transitionImageLayout(commandBuffer, image, oldLayout, newLayout);
+        endSingleTimeCommands(commandBuffer);
+    }
 
+    void LveDevice::transitionImageLayout(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout oldLayout,
+                                          VkImageLayout newLayout) {
         VkImageMemoryBarrier barrier{};
         barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
         barrier.oldLayout = oldLayout;
@@ -330,6 +379,14 @@ namespace lve {
 
             sourceStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
             destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        } else if (oldLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL &&
+                   newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
+            // Rewriting part of an image that earlier draws may still be sampling
+            barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+            sourceStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
         } else {
             throw std::invalid_argument("unsupported layout transition!");
         }
@@ -341,9 +398,6 @@ namespace lve {
                 0, nullptr,
                 0, nullptr,
                 1, &barrier);
-
-        endSingleTimeCommands(commandBuffer);
-
     }
 
     void LveDevice::createSurface() { window.createWindowSurface(instance, &surface_); }
@@ -359,11 +413,19 @@ namespace lve {
             swapChainAdequate = !swapChainSupport.formats.empty() && !swapChainSupport.presentModes.empty();
         }
 
-        VkPhysicalDeviceFeatures supportedFeatures;
-        vkGetPhysicalDeviceFeatures(device, &supportedFeatures);
+        VkPhysicalDeviceVulkan12Features supported12Features{};
+        supported12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        VkPhysicalDeviceFeatures2 supportedFeatures{};
+        supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        supportedFeatures.pNext = &supported12Features;
+        vkGetPhysicalDeviceFeatures2(device, &supportedFeatures);
+
+        VkPhysicalDeviceProperties deviceProperties;
+        vkGetPhysicalDeviceProperties(device, &deviceProperties);
 
         return indices.isComplete() && extensionsSupported && swapChainAdequate &&
-               supportedFeatures.samplerAnisotropy;
+               supportedFeatures.features.samplerAnisotropy &&
+               deviceProperties.apiVersion >= VK_API_VERSION_1_2 && supported12Features.timelineSemaphore;
     }
 
     void LveDevice::populateDebugMessengerCreateInfo(
@@ -498,6 +560,21 @@ namespace lve {
             i++;
         }
 
+        // Prefer a transfer-only family so texture uploads run on the copy engine beside rendering
+        for (uint32_t family = 0; family < queueFamilyCount; family++) {
+            const auto &queueFamily = queueFamilies[family];
+            if (queueFamily.queueCount > 0 && (queueFamily.queueFlags & VK_QUEUE_TRANSFER_BIT) &&
+                !(queueFamily.queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT))) {
+                indices.transferFamily = family;
+                indices.transferFamilyHasValue = true;
+                break;
+            }
+        }
+        if (!indices.transferFamilyHasValue && indices.graphicsFamilyHasValue) {
+            indices.transferFamily = indices.graphicsFamily;
+            indices.transferFamilyHasValue = true;
+        }
+
         return indices;
     }
 
@@ -561,30 +638,61 @@ namespace lve {
             VkBufferUsageFlags usage,
             VkMemoryPropertyFlags properties,
             VkBuffer &buffer,
-            VkDeviceMemory &bufferMemory) {
+            VmaAllocation &bufferAllocation,
+            void **mappedData) {
         VkBufferCreateInfo bufferInfo{};
         bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         bufferInfo.size = size;
         bufferInfo.usage = usage;
         bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-        if (vkCreateBuffer(device_, &bufferInfo, nullptr, &buffer) != VK_SUCCESS) {
-            throw std::runtime_error("failed to create vertex buffer!");
+        VmaAllocationCreateInfo allocInfo{};
+        allocInfo.requiredFlags = properties;
+        if (mappedData) {
+            allocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
         }
 
-        VkMemoryRequirements memRequirements;
-        vkGetBufferMemoryRequirements(device_, buffer, &memRequirements);
+        VmaAllocationInfo allocationInfo{};
+        if (vmaCreateBuffer(allocator_, &bufferInfo, &allocInfo, &buffer, &bufferAllocation, &allocationInfo) !=
+            VK_SUCCESS) {
+            throw std::runtime_error("failed to create buffer!");
+        }
 
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
+        if (mappedData) {
+            *mappedData = allocationInfo.pMappedData;
+        }
+    }
 
-        if (vkAllocateMemory(device_, &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS) {
-            throw std::runtime_error("failed to allocate vertex buffer memory!");
+    void LveDevice::createStagingBuffer(
+            VkDeviceSize size,
+            VkBuffer &buffer,
+            VmaAllocation &bufferAllocation,
+            void **mappedData) {
+        VkBufferCreateInfo bufferInfo{};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = size;
+        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        VmaAllocationCreateInfo allocInfo{};
+        allocInfo.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        allocInfo.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        // Uploads larger than a pool block get their own memory
+        if (size <= STAGING_BLOCK_SIZE) {
+            allocInfo.pool = stagingPool;
+        }
+
+        VmaAllocationInfo allocationInfo{};
+        if (vmaCreateBuffer(allocator_, &bufferInfo, &allocInfo, &buffer, &bufferAllocation, &allocationInfo) !=
+            VK_SUCCESS) {
+            throw std::runtime_error("failed to create staging buffer!");
         }
 
-        vkBindBufferMemory(device_, buffer, bufferMemory, 0);
+        *mappedData = allocationInfo.pMappedData;
+    }
+
+    void LveDevice::destroyBuffer(VkBuffer buffer, VmaAllocation bufferAllocation) {
+        vmaDestroyBuffer(allocator_, buffer, bufferAllocation);
     }
 
     VkCommandBuffer LveDevice::beginSingleTimeCommands() {
@@ -634,7 +742,13 @@ namespace lve {
     void LveDevice::copyBufferToImage(
             VkBuffer buffer, VkImage image, uint32_t width, uint32_t height, uint32_t layerCount) {
         VkCommandBuffer commandBuffer = beginSingleTimeCommands();
+        copyBufferToImage(commandBuffer, buffer, image, width, height, layerCount);
+        endSingleTimeCommands(commandBuffer);
+    }
 
+    void LveDevice::copyBufferToImage(
+            VkCommandBuffer commandBuffer,
+            VkBuffer buffer, VkImage image, uint32_t width, uint32_t height, uint32_t layerCount) {
         VkBufferImageCopy region{};
         region.bufferOffset = 0;
         region.bufferRowLength = 0;
@@ -655,32 +769,49 @@ namespace lve {
                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                 1,
                 &region);
-        endSingleTimeCommands(commandBuffer);
     }
 
     void LveDevice::createImageWithInfo(
             const VkImageCreateInfo &imageInfo,
             VkMemoryPropertyFlags properties,
             VkImage &image,
-            VkDeviceMemory &imageMemory) {
-        if (vkCreateImage(device_, &imageInfo, nullptr, &image) != VK_SUCCESS) {
+            VmaAllocation &imageAllocation) {
+        VmaAllocationCreateInfo allocInfo{};
+        allocInfo.requiredFlags = properties;
+
+        if (vmaCreateImage(allocator_, &imageInfo, &allocInfo, &image, &imageAllocation, nullptr) != VK_SUCCESS) {
             throw std::runtime_error("failed to create image!");
         }
+    }
 
-        VkMemoryRequirements memRequirements;
-        vkGetImageMemoryRequirements(device_, image, &memRequirements);
+    std::vector<MemoryHeapStats> LveDevice::getMemoryStatistics() {
+        const VkPhysicalDeviceMemoryProperties *memProperties;
+        vmaGetMemoryProperties(allocator_, &memProperties);
 
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
+        std::vector<VmaBudget> budgets(memProperties->memoryHeapCount);
+        vmaGetHeapBudgets(allocator_, budgets.data());
 
-        if (vkAllocateMemory(device_, &allocInfo, nullptr, &imageMemory) != VK_SUCCESS) {
-            throw std::runtime_error("failed to allocate image memory!");
+        std::vector<MemoryHeapStats> heaps(memProperties->memoryHeapCount);
+        for (uint32_t i = 0; i < memProperties->memoryHeapCount; i++) {
+            heaps[i].heapIndex = i;
+            heaps[i].flags = memProperties->memoryHeaps[i].flags;
+            heaps[i].blockCount = budgets[i].statistics.blockCount;
+            heaps[i].allocationCount = budgets[i].statistics.allocationCount;
+            heaps[i].blockBytes = budgets[i].statistics.blockBytes;
+            heaps[i].allocationBytes = budgets[i].statistics.allocationBytes;
+            heaps[i].budget = budgets[i].budget;
         }
+        return heaps;
+    }
 
-        if (vkBindImageMemory(device_, image, imageMemory, 0) != VK_SUCCESS) {
-            throw std::runtime_error("failed to bind image memory!");
+    void LveDevice::printMemoryStatistics() {
+        constexpr double MiB = 1024.0 * 1024.0;
+        for (const auto &heap: getMemoryStatistics()) {
+            std::cout << "[LveDevice] Heap " << heap.heapIndex
+                      << ((heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) ? " (device local)" : " (host)")
+                      << ": " << heap.blockCount << " blocks / " << heap.blockBytes / MiB << " MiB reserved, "
+                      << heap.allocationCount << " allocations / " << heap.allocationBytes / MiB << " MiB used, "
+                      << "budget " << heap.budget / MiB << " MiB" << std::endl;
         }
     }
 
@@ -35,8 +35,7 @@ namespace lve {
 
     void LveModel::cleanup() {
         std::cout << "[LveModel] Destroying vertex buffer: " << vertexBuffer << "\n";
-        vkDestroyBuffer(lveDevice.device(), vertexBuffer, nullptr);
-        vkFreeMemory(lveDevice.device(), vertexBufferMemory, nullptr);
+        lveDevice.destroyBuffer(vertexBuffer, vertexBufferAllocation);
     }
 
 
@@ -44,18 +43,17 @@ namespace lve {
         vertexCount = static_cast<uint32_t>(vertices.size());
         assert(vertexCount >= 3 && "vertex count must be atleast 3");
         VkDeviceSize bufferSize = sizeof(vertices[0]) * vertexCount;
+        void *data;
         lveDevice.createBuffer(
                 bufferSize,
                 VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
                 vertexBuffer,
-                vertexBufferMemory
+                vertexBufferAllocation,
+                &data
         );
 
-        void *data;
-        vkMapMemory(lveDevice.device(), vertexBufferMemory, 0, bufferSize, 0, &data);
         memcpy(data, vertices.data(), static_cast<size_t>(bufferSize));
-        vkUnmapMemory(lveDevice.device(), vertexBufferMemory);
     }
 
     void LveModel::draw(VkCommandBuffer commandBuffer) {
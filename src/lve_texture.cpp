@@ -14,6 +14,21 @@ namespace lve {
         createTextureSampler();
     }
 
+    Texture::Texture(LveDevice &device, const unsigned char *pixels, uint32_t width, uint32_t height,
+                     VkFormat format) : lveDevice(device), imageFormat(format) {
+        createTextureImage(pixels, width, height);
+        createTextureImageView();
+        createTextureSampler();
+    }
+
+    Texture::Texture(LveDevice &device, VkImage image, VmaAllocation allocation, VkFormat format, uint32_t width,
+                     uint32_t height)
+            : lveDevice(device), textureImage(image), textureImageAllocation(allocation), imageFormat(format),
+              width(width), height(height) {
+        createTextureImageView();
+        createTextureSampler();
+    }
+
     // Texture::~Texture() {
     //     std::cout << "[Texture] Destroying sampler: " << textureSampler << std::endl;
     //     vkDestroySampler(lveDevice.device(), textureSampler, nullptr);
@@ -37,10 +52,7 @@ namespace lve {
         vkDestroyImageView(lveDevice.device(), textureImageView, nullptr);
 
         std::cout << "[Texture] Destroying image: " << textureImage << "\n";
-        vkDestroyImage(lveDevice.device(), textureImage, nullptr);
-
-        std::cout << "[Texture] Freeing memory: " << textureImageMemory << "\n";
-        vkFreeMemory(lveDevice.device(), textureImageMemory, nullptr);
+        lveDevice.destroyImage(textureImage, textureImageAllocation);
     }
 
 
@@ -52,62 +64,87 @@ namespace lve {
             throw std::runtime_error("failed to load texture image!");
         }
 
-        VkDeviceSize imageSize = texWidth * texHeight * 4;
+        createTextureImage(pixels, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
+        stbi_image_free(pixels);
+    }
+
+    void Texture::createTextureImage(const unsigned char *pixels, uint32_t texWidth, uint32_t texHeight) {
+        width = texWidth;
+        height = texHeight;
+        VkDeviceSize imageSize = static_cast<VkDeviceSize>(texWidth) * texHeight * 4;
 
         VkBuffer stagingBuffer;
-        VkDeviceMemory stagingBufferMemory;
+        VmaAllocation stagingBufferAllocation;
 
         // Create staging buffer with CPU visible memory
-        lveDevice.createBuffer(
-                imageSize,
-                VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                stagingBuffer,
-                stagingBufferMemory);
+        void *data;
+        lveDevice.createStagingBuffer(imageSize, stagingBuffer, stagingBufferAllocation, &data);
 
         // Copy pixel data to staging buffer memory
-        void *data;
-        vkMapMemory(lveDevice.device(), stagingBufferMemory, 0, imageSize, 0, &data);
         memcpy(data, pixels, static_cast<size_t>(imageSize));
-        vkUnmapMemory(lveDevice.device(), stagingBufferMemory);
-
-        stbi_image_free(pixels);
 
         // Create GPU local image with transfer destination & sampled usage
         lveDevice.createImage(
                 texWidth,
                 texHeight,
-                VK_FORMAT_R8G8B8A8_SRGB,
+                imageFormat,
                 VK_IMAGE_TILING_OPTIMAL,
                 VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
                 VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
                 textureImage,
-                textureImageMemory);
+                textureImageAllocation);
 
-        // Transition image layout to receive data
-        lveDevice.transitionImageLayout(textureImage,
-                                        VK_FORMAT_R8G8B8A8_SRGB,
+        // Transition, copy and transition again in a single submission instead of waiting on each step
+        VkCommandBuffer commandBuffer = lveDevice.beginSingleTimeCommands();
+        lveDevice.transitionImageLayout(commandBuffer,
+                                        textureImage,
                                         VK_IMAGE_LAYOUT_UNDEFINED,
                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        lveDevice.copyBufferToImage(commandBuffer, stagingBuffer, textureImage, texWidth, texHeight, 1);
+        lveDevice.transitionImageLayout(commandBuffer,
+                                        textureImage,
+                                        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        lveDevice.endSingleTimeCommands(commandBuffer);
 
-        // Copy buffer (CPU side) to image (GPU side)
-        lveDevice.copyBufferToImage(stagingBuffer, textureImage,
-                                    static_cast<uint32_t>(texWidth),
-                                    static_cast<uint32_t>(texHeight), 1);
+        lveDevice.destroyBuffer(stagingBuffer, stagingBufferAllocation);
+    }
+
+    void Texture::update(const unsigned char *pixels, int32_t x, int32_t y, uint32_t regionWidth,
+                         uint32_t regionHeight) {
+        VkDeviceSize regionSize = static_cast<VkDeviceSize>(regionWidth) * regionHeight * 4;
 
-        // Transition image layout for shader read access
-        lveDevice.transitionImageLayout(textureImage,
-                                        VK_FORMAT_R8G8B8A8_SRGB,
+        VkBuffer stagingBuffer;
+        VmaAllocation stagingBufferAllocation;
+        void *data;
+        lveDevice.createStagingBuffer(regionSize, stagingBuffer, stagingBufferAllocation, &data);
+        memcpy(data, pixels, static_cast<size_t>(regionSize));
+
+        VkBufferImageCopy region{};
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = {x, y, 0};
+        region.imageExtent = {regionWidth, regionHeight, 1};
+
+        VkCommandBuffer commandBuffer = lveDevice.beginSingleTimeCommands();
+        lveDevice.transitionImageLayout(commandBuffer,
+                                        textureImage,
+                                        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        vkCmdCopyBufferToImage(commandBuffer, stagingBuffer, textureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
+                               &region);
+        lveDevice.transitionImageLayout(commandBuffer,
+                                        textureImage,
                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        lveDevice.endSingleTimeCommands(commandBuffer);
 
-        vkDestroyBuffer(lveDevice.device(), stagingBuffer, nullptr);
-        vkFreeMemory(lveDevice.device(), stagingBufferMemory, nullptr);
+        lveDevice.destroyBuffer(stagingBuffer, stagingBufferAllocation);
     }
 
     void Texture::createTextureImageView() {
         textureImageView = lveDevice.createImageView(textureImage,
-                                                     VK_FORMAT_R8G8B8A8_SRGB,
+                                                     imageFormat,
                                                      VK_IMAGE_ASPECT_COLOR_BIT);
     }
 